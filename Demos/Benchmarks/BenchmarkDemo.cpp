@@ -318,6 +318,11 @@ void BenchmarkDemo::displayCallback(void)
 
 
 
+int	BenchmarkDemo::scaledCount(int count) const
+{
+	return btMax(1,int(count*m_sizeScale+btScalar(0.5)));
+}
+
 void	BenchmarkDemo::initPhysics()
 {
 
@@ -325,7 +330,7 @@ void	BenchmarkDemo::initPhysics()
 
 	///collision configuration contains default setup for memory, collision setup
 	btDefaultCollisionConstructionInfo cci;
-	cci.m_defaultMaxPersistentManifoldPoolSize = 32768;
+	cci.m_defaultMaxPersistentManifoldPoolSize = btMax(32768,scaledCount(32768));
 	m_collisionConfiguration = new btDefaultCollisionConfiguration(cci);
 
 	///use the default collision dispatcher. For parallel processing you can use a diffent dispatcher (see Extras/BulletMultiThreaded)
@@ -354,7 +359,7 @@ void	BenchmarkDemo::initPhysics()
 	btVector3 worldAabbMax(1000,1000,1000);
 	
 	btHashedOverlappingPairCache* pairCache = new btHashedOverlappingPairCache();
-	m_overlappingPairCache = new btAxisSweep3(worldAabbMin,worldAabbMax,3500,pairCache);
+	m_overlappingPairCache = new btAxisSweep3(worldAabbMin,worldAabbMax,btMax(3500,scaledCount(3500)),pairCache);
 //	m_overlappingPairCache = new btSimpleBroadphase();
 //	m_overlappingPairCache = new btDbvtBroadphase();
 	
@@ -485,7 +490,8 @@ void	BenchmarkDemo::createTest1()
 	btTransform trans;
 	trans.setIdentity();
 
-	for(int k=0;k<47;k++) {
+	int numLayers = scaledCount(47);
+	for(int k=0;k<numLayers;k++) {
 		for(int j=0;j<size;j++) {
 			pos[2] = offset + (float)j * (cubeSize * 2.0f + spacing);
 			for(int i=0;i<size;i++) {
@@ -634,11 +640,12 @@ void	BenchmarkDemo::createTest2()
 	setCameraDistance(btScalar(50.));
 	const float cubeSize = 1.0f;
 
-	createPyramid(btVector3(-20.0f,0.0f,0.0f),12,btVector3(cubeSize,cubeSize,cubeSize));
-	createWall(btVector3(-2.0f,0.0f,0.0f),12,btVector3(cubeSize,cubeSize,cubeSize));
-	createWall(btVector3(4.0f,0.0f,0.0f),12,btVector3(cubeSize,cubeSize,cubeSize));
-	createWall(btVector3(10.0f,0.0f,0.0f),12,btVector3(cubeSize,cubeSize,cubeSize));
-	createTowerCircle(btVector3(25.0f,0.0f,0.0f),8,24,btVector3(cubeSize,cubeSize,cubeSize));
+	int stackSize = scaledCount(12);
+	createPyramid(btVector3(-20.0f,0.0f,0.0f),stackSize,btVector3(cubeSize,cubeSize,cubeSize));
+	createWall(btVector3(-2.0f,0.0f,0.0f),stackSize,btVector3(cubeSize,cubeSize,cubeSize));
+	createWall(btVector3(4.0f,0.0f,0.0f),stackSize,btVector3(cubeSize,cubeSize,cubeSize));
+	createWall(btVector3(10.0f,0.0f,0.0f),stackSize,btVector3(cubeSize,cubeSize,cubeSize));
+	createTowerCircle(btVector3(25.0f,0.0f,0.0f),scaledCount(8),24,btVector3(cubeSize,cubeSize,cubeSize));
 	
 }
 
@@ -924,7 +931,7 @@ void	BenchmarkDemo::createTest3()
 {
 	setCameraDistance(btScalar(50.));
 
-	int size = 16;
+	int size = scaledCount(16);
 
 	float sizeX = 1.f;
 	float sizeY = 1.f;
@@ -981,7 +988,8 @@ void	BenchmarkDemo::createTest4()
 	btVector3 localInertia(0,0,0);
 	convexHullShape->calculateLocalInertia(mass,localInertia);
 
-	for(int k=0;k<15;k++) {
+	int numLayers = scaledCount(15);
+	for(int k=0;k<numLayers;k++) {
 		for(int j=0;j<size;j++) {
 			pos[2] = offset + (float)j * (cubeSize * 2.0f + spacing);
 			for(int i=0;i<size;i++) {
@@ -1112,7 +1120,7 @@ void	BenchmarkDemo::createTest5()
 
 	{
 		int size = 10;
-		int height = 10;
+		int height = scaledCount(10);
 
 		const float cubeSize = boxSize[0];
 		float spacing = 2.0f;
@@ -1193,7 +1201,7 @@ void	BenchmarkDemo::createTest6()
 
 	{
 		int size = 10;
-		int height = 10;
+		int height = scaledCount(10);
 
 		const float cubeSize = boxSize[0];
 		float spacing = 2.0f;
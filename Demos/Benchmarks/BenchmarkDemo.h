@@ -19,6 +19,11 @@ subject to the following restrictions:
 #include "LinearMath/btAlignedObjectArray.h"
 #include "LinearMath/btTransform.h"
 
+#ifdef BT_HEADLESS_BENCHMARK
+///bullet_bench runs the scenes without any windowing or OpenGL dependencies
+#undef USE_GRAPHICAL_BENCHMARK
+#endif //BT_HEADLESS_BENCHMARK
+
 class btDynamicsWorld;
 
 #define NUMRAYS 500
@@ -44,7 +49,8 @@ protected:
 
 public:
 	DemoApplication()
-	:m_defaultContactProcessingThreshold(BT_LARGE_FLOAT)
+	:m_dynamicsWorld(0),
+	m_defaultContactProcessingThreshold(BT_LARGE_FLOAT)
 	{
 	}
 	virtual void myinit() {}
@@ -97,6 +103,11 @@ class BenchmarkDemo : public PlatformDemoApplication
 	
 	int	m_benchmark;
 
+	///scales the number of objects in each scene, 1 gives the default sizes
+	btScalar	m_sizeScale;
+
+	int	scaledCount(int count) const;
+
 	void	createTest1();
 	void	createTest2();
 	void	createTest3();
@@ -120,7 +131,8 @@ class BenchmarkDemo : public PlatformDemoApplication
 	public:
 
 	BenchmarkDemo(int benchmark)
-	:m_benchmark(benchmark)
+	:m_benchmark(benchmark),
+	m_sizeScale(btScalar(1.))
 	{
 	}
 	virtual ~BenchmarkDemo()
@@ -134,6 +146,16 @@ class BenchmarkDemo : public PlatformDemoApplication
 	virtual void clientMoveAndDisplay();
 
 	virtual void displayCallback();
+
+	///setSizeScale must be called before initPhysics
+	void	setSizeScale(btScalar scale)
+	{
+		m_sizeScale = scale;
+	}
+	btScalar	getSizeScale() const
+	{
+		return m_sizeScale;
+	}
 	
 
 
@@ -0,0 +1,331 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+///bullet_bench runs the BenchmarkDemo scenes without graphics, for a fixed number of steps and a fixed random seed.
+///It reports per-stage timings collected by btDiscreteDynamicsWorld (see btSimulationStats), can write the
+///results to a JSON file and compare them against a previously written baseline, to catch performance regressions.
+///
+///usage: bullet_bench [--steps N] [--seed S] [--size F] [--scene K] [--json out.json] [--baseline base.json] [--tolerance percent]
+
+#include "BenchmarkDemo.h"
+#include "btBulletDynamicsCommon.h"
+#include "BulletDynamics/Dynamics/btSimulationStats.h"
+#include "LinearMath/btQuickprof.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_DEMOS 7
+
+extern bool gDisableDeactivation;
+
+static const char* sDemoNames[NUM_DEMOS] = {"3000 fall", "1000 stack", "136 ragdolls","1000 convex", "prim-trimesh", "convex-trimesh","raytests"};
+
+struct btBenchmarkSettings
+{
+	int		m_numSteps;
+	unsigned int	m_seed;
+	float	m_sizeScale;
+	int		m_scene;
+	const char*	m_jsonFileName;
+	const char*	m_baselineFileName;
+	float	m_tolerance;
+
+	btBenchmarkSettings()
+		:m_numSteps(200),
+		m_seed(1),
+		m_sizeScale(1.f),
+		m_scene(0),
+		m_jsonFileName(0),
+		m_baselineFileName(0),
+		m_tolerance(10.f)
+	{
+	}
+};
+
+struct btBenchmarkResult
+{
+	const char*	m_name;
+	int		m_numBodies;
+	double	m_totalTime;
+	float	m_minStepTime;
+	float	m_maxStepTime;
+	double	m_stageTime[BT_NUM_SIMULATION_STAGES];
+	double	m_numPairs;
+	double	m_numContacts;
+	double	m_checksum;
+
+	btBenchmarkResult()
+		:m_name(""),
+		m_numBodies(0),
+		m_totalTime(0),
+		m_minStepTime(BT_LARGE_FLOAT),
+		m_maxStepTime(0.f),
+		m_numPairs(0),
+		m_numContacts(0),
+		m_checksum(0)
+	{
+		for (int i=0;i<BT_NUM_SIMULATION_STAGES;i++)
+			m_stageTime[i] = 0;
+	}
+};
+
+static void	runBenchmark(int scene, const btBenchmarkSettings& settings, btBenchmarkResult& result)
+{
+	//scenes use rand(), reseed so each scene is built the same way, independent of the scenes that ran before
+	srand(settings.m_seed);
+
+	BenchmarkDemo* demo = new BenchmarkDemo(scene);
+	demo->setSizeScale(settings.m_sizeScale);
+	demo->initPhysics();
+
+	btDiscreteDynamicsWorld* world = (btDiscreteDynamicsWorld*)demo->getDynamicsWorld();
+	world->setCollectSimulationStats(true);
+
+	result.m_name = sDemoNames[scene-1];
+	result.m_numBodies = world->getNumCollisionObjects();
+
+	btClock clock;
+	for (int i=0;i<settings.m_numSteps;i++)
+	{
+		clock.reset();
+		demo->clientMoveAndDisplay();
+		float stepTime = float(clock.getTimeNanoseconds())*1e-6f;
+
+		result.m_totalTime += stepTime;
+		result.m_minStepTime = btMin(result.m_minStepTime,stepTime);
+		result.m_maxStepTime = btMax(result.m_maxStepTime,stepTime);
+
+		const btSimulationStats& stats = world->getSimulationStats();
+		for (int s=0;s<BT_NUM_SIMULATION_STAGES;s++)
+			result.m_stageTime[s] += stats.m_stageTime[s];
+		result.m_numPairs += stats.m_numOverlappingPairs;
+		result.m_numContacts += stats.m_numContacts;
+	}
+
+	///the checksum of the final body positions shows whether two runs simulated the same thing
+	for (int j=0;j<world->getNumCollisionObjects();j++)
+	{
+		const btVector3& pos = world->getCollisionObjectArray()[j]->getWorldTransform().getOrigin();
+		result.m_checksum += double(pos.getX())+double(pos.getY())+double(pos.getZ());
+	}
+
+	demo->exitPhysics();
+	delete demo;
+}
+
+static bool	writeJson(const char* fileName, const btBenchmarkSettings& settings, const btAlignedObjectArray<btBenchmarkResult>& results)
+{
+	FILE* f = fopen(fileName,"w");
+	if (!f)
+		return false;
+
+	double invSteps = 1./double(settings.m_numSteps);
+	fprintf(f,"{\n\t\"steps\": %d,\n\t\"seed\": %u,\n\t\"size\": %f,\n\t\"scenes\": [\n",settings.m_numSteps,settings.m_seed,settings.m_sizeScale);
+	for (int i=0;i<results.size();i++)
+	{
+		const btBenchmarkResult& r = results[i];
+		fprintf(f,"\t\t{\n\t\t\t\"name\": \"%s\",\n",r.m_name);
+		fprintf(f,"\t\t\t\"bodies\": %d,\n",r.m_numBodies);
+		fprintf(f,"\t\t\t\"meanStepMs\": %f,\n",r.m_totalTime*invSteps);
+		fprintf(f,"\t\t\t\"minStepMs\": %f,\n",r.m_minStepTime);
+		fprintf(f,"\t\t\t\"maxStepMs\": %f,\n",r.m_maxStepTime);
+		fprintf(f,"\t\t\t\"stagesMs\": {\n");
+		for (int s=0;s<BT_NUM_SIMULATION_STAGES;s++)
+		{
+			fprintf(f,"\t\t\t\t\"%s\": %f%s\n",btSimulationStats::getStageName(s),r.m_stageTime[s]*invSteps,(s<BT_NUM_SIMULATION_STAGES-1)?",":"");
+		}
+		fprintf(f,"\t\t\t},\n");
+		fprintf(f,"\t\t\t\"meanPairs\": %f,\n",r.m_numPairs*invSteps);
+		fprintf(f,"\t\t\t\"meanContacts\": %f,\n",r.m_numContacts*invSteps);
+		fprintf(f,"\t\t\t\"checksum\": %f\n",r.m_checksum);
+		fprintf(f,"\t\t}%s\n",(i<results.size()-1)?",":"");
+	}
+	fprintf(f,"\t]\n}\n");
+	fclose(f);
+	return true;
+}
+
+static bool	readFile(const char* fileName, btAlignedObjectArray<char>& buffer)
+{
+	FILE* f = fopen(fileName,"rb");
+	if (!f)
+		return false;
+	char chunk[4096];
+	size_t numRead;
+	while ((numRead = fread(chunk,1,sizeof(chunk),f))>0)
+	{
+		for (size_t i=0;i<numRead;i++)
+			buffer.push_back(chunk[i]);
+	}
+	buffer.push_back(0);
+	fclose(f);
+	return true;
+}
+
+///only understands the files written by writeJson: finds the value of key after position start
+static bool	findJsonNumber(const char* json, const char* start, const char* key, double& value)
+{
+	char pattern[128];
+	sprintf(pattern,"\"%s\":",key);
+	const char* pos = strstr(start ? start : json,pattern);
+	if (!pos)
+		return false;
+	return sscanf(pos+strlen(pattern),"%lf",&value)==1;
+}
+
+static const char*	findJsonScene(const char* json, const char* name)
+{
+	char pattern[128];
+	sprintf(pattern,"\"name\": \"%s\"",name);
+	return strstr(json,pattern);
+}
+
+///returns the number of scenes that got slower than the tolerance allows
+static int	compareBaseline(const char* fileName, const btBenchmarkSettings& settings, const btAlignedObjectArray<btBenchmarkResult>& results)
+{
+	btAlignedObjectArray<char> buffer;
+	if (!readFile(fileName,buffer))
+	{
+		printf("cannot read baseline %s\n",fileName);
+		return 0;
+	}
+	const char* json = &buffer[0];
+
+	double steps=0,size=0;
+	if (!findJsonNumber(json,0,"steps",steps) || !findJsonNumber(json,0,"size",size))
+	{
+		printf("baseline %s is not a bullet_bench result file\n",fileName);
+		return 0;
+	}
+	if (int(steps)!=settings.m_numSteps || btFabs(btScalar(size-settings.m_sizeScale))>btScalar(1e-4))
+	{
+		printf("warning: baseline was recorded with --steps %d --size %f\n",int(steps),size);
+	}
+
+	printf("\nComparison against baseline %s (tolerance %.1f%%):\n",fileName,settings.m_tolerance);
+	int numRegressions = 0;
+	for (int i=0;i<results.size();i++)
+	{
+		const btBenchmarkResult& r = results[i];
+		const char* scene = findJsonScene(json,r.m_name);
+		double baseMean=0,baseChecksum=0;
+		if (!scene || !findJsonNumber(json,scene,"meanStepMs",baseMean))
+		{
+			printf("  %-16s not in baseline\n",r.m_name);
+			continue;
+		}
+		double mean = r.m_totalTime/double(settings.m_numSteps);
+		double change = baseMean>0 ? 100.*(mean-baseMean)/baseMean : 0;
+		bool regressed = change > settings.m_tolerance;
+		if (regressed)
+			numRegressions++;
+		printf("  %-16s %10.3f ms  baseline %10.3f ms  %+7.1f%%%s\n",r.m_name,mean,baseMean,change,regressed?"  REGRESSION":"");
+
+		if (findJsonNumber(json,scene,"checksum",baseChecksum) && btFabs(btScalar(baseChecksum-r.m_checksum))>btScalar(1e-3)*btMax(btScalar(1.),btFabs(btScalar(baseChecksum))))
+		{
+			printf("  %-16s checksum %f differs from baseline %f, the simulation is not the same\n","",r.m_checksum,baseChecksum);
+		}
+	}
+	return numRegressions;
+}
+
+static void	printUsage()
+{
+	printf("usage: bullet_bench [--steps N] [--seed S] [--size F] [--scene K] [--json out.json] [--baseline base.json] [--tolerance percent]\n");
+	printf("  --steps N        number of steps per scene (default 200)\n");
+	printf("  --seed S         random seed used to build the scenes (default 1)\n");
+	printf("  --size F         scales the number of objects in each scene (default 1)\n");
+	printf("  --scene K        only run scene K in 1..%d (default all)\n",NUM_DEMOS);
+	printf("  --json file      write the results as JSON\n");
+	printf("  --baseline file  compare against a JSON file written by --json, exit code 1 on regressions\n");
+	printf("  --tolerance P    allowed slowdown in percent before a scene counts as regressed (default 10)\n");
+}
+
+static bool	parseArguments(int argc, char** argv, btBenchmarkSettings& settings)
+{
+	for (int i=1;i<argc;i++)
+	{
+		const char* arg = argv[i];
+		const char* value = (i+1<argc) ? argv[i+1] : 0;
+		if (!value)
+			return false;
+
+		if (!strcmp(arg,"--steps"))
+			settings.m_numSteps = atoi(value);
+		else if (!strcmp(arg,"--seed"))
+			settings.m_seed = (unsigned int)strtoul(value,0,10);
+		else if (!strcmp(arg,"--size"))
+			settings.m_sizeScale = (float)atof(value);
+		else if (!strcmp(arg,"--scene"))
+			settings.m_scene = atoi(value);
+		else if (!strcmp(arg,"--json"))
+			settings.m_jsonFileName = value;
+		else if (!strcmp(arg,"--baseline"))
+			settings.m_baselineFileName = value;
+		else if (!strcmp(arg,"--tolerance"))
+			settings.m_tolerance = (float)atof(value);
+		else
+			return false;
+		i++;
+	}
+	return settings.m_numSteps>0 && settings.m_sizeScale>0.f && settings.m_scene>=0 && settings.m_scene<=NUM_DEMOS;
+}
+
+int main(int argc,char** argv)
+{
+	btBenchmarkSettings settings;
+	if (!parseArguments(argc,argv,settings))
+	{
+		printUsage();
+		return 2;
+	}
+
+	gDisableDeactivation = true;
+
+	btAlignedObjectArray<btBenchmarkResult> results;
+	for (int d=1;d<=NUM_DEMOS;d++)
+	{
+		if (settings.m_scene && settings.m_scene!=d)
+			continue;
+
+		btBenchmarkResult result;
+		runBenchmark(d,settings,result);
+		results.push_back(result);
+
+		printf("\n%s: %d bodies, %d steps, mean %.3f ms, min %.3f ms, max %.3f ms\n",result.m_name,result.m_numBodies,settings.m_numSteps,
+			result.m_totalTime/settings.m_numSteps,result.m_minStepTime,result.m_maxStepTime);
+		for (int s=0;s<BT_NUM_SIMULATION_STAGES;s++)
+		{
+			printf("  %-36s %10.3f ms\n",btSimulationStats::getStageName(s),result.m_stageTime[s]/settings.m_numSteps);
+		}
+	}
+
+	if (settings.m_jsonFileName)
+	{
+		if (!writeJson(settings.m_jsonFileName,settings,results))
+		{
+			printf("cannot write %s\n",settings.m_jsonFileName);
+			return 2;
+		}
+	}
+
+	int numRegressions = 0;
+	if (settings.m_baselineFileName)
+	{
+		numRegressions = compareBaseline(settings.m_baselineFileName,settings,results);
+	}
+	return numRegressions ? 1 : 0;
+}
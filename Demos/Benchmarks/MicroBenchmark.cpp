@@ -0,0 +1,647 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+///bullet_microbench measures the throughput of individual LinearMath and collision kernels over randomized inputs.
+///The build configuration (single/double precision, SSE/NEON/scalar btVector3) is part of the output,
+///so the JSON written by builds with different settings can be compared directly.
+///
+///usage: bullet_microbench [--filter substring] [--repeat R] [--json out.json]
+
+#include "btBulletCollisionCommon.h"
+#include "LinearMath/btAabbUtil2.h"
+#include "LinearMath/btQuickprof.h"
+#include "BulletCollision/BroadphaseCollision/btDbvt.h"
+#include "BulletCollision/CollisionDispatch/btBoxBoxDetector.h"
+#include "BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h"
+#include "BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h"
+#include "BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.h"
+#include "BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+///number of randomized inputs each kernel cycles through
+#define NUM_INPUTS 1024
+
+///small deterministic generator, so that every build sees the same inputs
+struct btMicroRandom
+{
+	unsigned int	m_state;
+
+	btMicroRandom(unsigned int seed)
+		:m_state(seed)
+	{
+	}
+	///returns a value in [0,1)
+	btScalar	next()
+	{
+		m_state = m_state*1664525u+1013904223u;
+		return btScalar(m_state>>8)*btScalar(1./16777216.);
+	}
+	btScalar	range(btScalar lo, btScalar hi)
+	{
+		return lo+(hi-lo)*next();
+	}
+	btVector3	vector(btScalar lo, btScalar hi)
+	{
+		btScalar x = range(lo,hi);
+		btScalar y = range(lo,hi);
+		btScalar z = range(lo,hi);
+		return btVector3(x,y,z);
+	}
+	btTransform	transform(btScalar extent)
+	{
+		btVector3 axis = vector(-1,1);
+		if (axis.length2()<btScalar(1e-4))
+			axis.setValue(0,1,0);
+		btQuaternion orn(axis.normalized(),range(0,SIMD_2_PI));
+		return btTransform(orn,vector(-extent,extent));
+	}
+};
+
+///stores every contact point, the kernels only use the count and depth to keep the work observable
+struct btMicroBenchmarkResult : public btDiscreteCollisionDetectorInterface::Result
+{
+	int		m_numContacts;
+	btScalar	m_depthSum;
+
+	btMicroBenchmarkResult()
+		:m_numContacts(0),
+		m_depthSum(0)
+	{
+	}
+	virtual void setShapeIdentifiersA(int partId0,int index0)
+	{
+	}
+	virtual void setShapeIdentifiersB(int partId1,int index1)
+	{
+	}
+	virtual void addContactPoint(const btVector3& normalOnBInWorld,const btVector3& pointInWorld,btScalar depth)
+	{
+		m_numContacts++;
+		m_depthSum += depth;
+	}
+};
+
+class btMicroBenchmark
+{
+protected:
+	const char*	m_name;
+
+public:
+	///accumulates results, so that the compiler cannot remove the measured work
+	btScalar	m_sink;
+
+	btMicroBenchmark(const char* name)
+		:m_name(name),
+		m_sink(0)
+	{
+	}
+	virtual ~btMicroBenchmark()
+	{
+	}
+	const char*	getName() const
+	{
+		return m_name;
+	}
+	///runs the kernel over all inputs and returns the number of operations performed
+	virtual int	run() = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// LinearMath
+
+class btMaxDotBenchmark : public btMicroBenchmark
+{
+	btAlignedObjectArray<btVector3>	m_points;
+	btAlignedObjectArray<btVector3>	m_directions;
+	int		m_numPoints;
+	bool	m_reference;
+
+public:
+	btMaxDotBenchmark(const char* name, int numPoints, bool reference)
+		:btMicroBenchmark(name),
+		m_numPoints(numPoints),
+		m_reference(reference)
+	{
+		btMicroRandom rng(1);
+		m_points.resize(numPoints);
+		for (int i=0;i<numPoints;i++)
+			m_points[i] = rng.vector(-1,1);
+		m_directions.resize(64);
+		for (int j=0;j<m_directions.size();j++)
+			m_directions[j] = rng.vector(-1,1);
+	}
+
+	virtual int	run()
+	{
+		int numOps = 0;
+		for (int j=0;j<m_directions.size();j++)
+		{
+			const btVector3& dir = m_directions[j];
+			btScalar dot;
+			long index;
+			if (m_reference)
+			{
+				///plain loop, the same as the small-array path of btVector3::maxDot
+				dot = -SIMD_INFINITY;
+				index = -1;
+				for (int i=0;i<m_numPoints;i++)
+				{
+					btScalar d = m_points[i].dot(dir);
+					if (d > dot)
+					{
+						dot = d;
+						index = i;
+					}
+				}
+			} else
+			{
+				index = dir.maxDot(&m_points[0],m_numPoints,dot);
+			}
+			m_sink += dot+btScalar(index);
+			numOps += m_numPoints;
+		}
+		return numOps;
+	}
+};
+
+class btMatrixBenchmark : public btMicroBenchmark
+{
+public:
+	enum Op
+	{
+		MULTIPLY,
+		TRANSPOSE_TIMES,
+		INVERSE,
+		TIMES_VECTOR
+	};
+
+private:
+	btAlignedObjectArray<btMatrix3x3>	m_matrices;
+	btAlignedObjectArray<btVector3>	m_vectors;
+	Op		m_op;
+
+public:
+	btMatrixBenchmark(const char* name, Op op)
+		:btMicroBenchmark(name),
+		m_op(op)
+	{
+		btMicroRandom rng(2);
+		m_matrices.resize(NUM_INPUTS);
+		m_vectors.resize(NUM_INPUTS);
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			m_matrices[i] = rng.transform(1).getBasis().scaled(rng.vector(btScalar(0.5),2));
+			m_vectors[i] = rng.vector(-1,1);
+		}
+	}
+
+	virtual int	run()
+	{
+		btMatrix3x3 acc = btMatrix3x3::getIdentity();
+		btVector3 v(0,0,0);
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			const btMatrix3x3& a = m_matrices[i];
+			const btMatrix3x3& b = m_matrices[(i+1)&(NUM_INPUTS-1)];
+			switch (m_op)
+			{
+			case MULTIPLY:
+				acc = a*b;
+				break;
+			case TRANSPOSE_TIMES:
+				acc = a.transposeTimes(b);
+				break;
+			case INVERSE:
+				acc = a.inverse();
+				break;
+			case TIMES_VECTOR:
+				v += a*m_vectors[i];
+				break;
+			}
+			v += acc[i%3];
+		}
+		m_sink += v.getX()+v.getY()+v.getZ();
+		return NUM_INPUTS;
+	}
+};
+
+class btAabbBenchmark : public btMicroBenchmark
+{
+public:
+	enum Op
+	{
+		AABB_AABB,
+		RAY_AABB,
+		QUANTIZED_AABB_AABB
+	};
+
+private:
+	btAlignedObjectArray<btVector3>	m_aabbs;
+	btAlignedObjectArray<btVector3>	m_rays;
+	btAlignedObjectArray<unsigned short>	m_quantized;
+	Op		m_op;
+
+public:
+	btAabbBenchmark(const char* name, Op op)
+		:btMicroBenchmark(name),
+		m_op(op)
+	{
+		btMicroRandom rng(3);
+		m_aabbs.resize(NUM_INPUTS*2);
+		m_rays.resize(NUM_INPUTS*2);
+		m_quantized.resize(NUM_INPUTS*6);
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			btVector3 center = rng.vector(-10,10);
+			btVector3 extent = rng.vector(btScalar(0.5),3);
+			m_aabbs[i*2] = center-extent;
+			m_aabbs[i*2+1] = center+extent;
+			m_rays[i*2] = rng.vector(-20,20);
+			m_rays[i*2+1] = rng.vector(-20,20);
+			for (int j=0;j<3;j++)
+			{
+				unsigned short lo = (unsigned short)(rng.next()*60000);
+				m_quantized[i*6+j] = lo;
+				m_quantized[i*6+3+j] = lo+(unsigned short)(rng.next()*5000);
+			}
+		}
+	}
+
+	virtual int	run()
+	{
+		int numHits = 0;
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			int k = (i+1)&(NUM_INPUTS-1);
+			switch (m_op)
+			{
+			case AABB_AABB:
+				numHits += TestAabbAgainstAabb2(m_aabbs[i*2],m_aabbs[i*2+1],m_aabbs[k*2],m_aabbs[k*2+1]) ? 1 : 0;
+				break;
+			case RAY_AABB:
+				{
+					btVector3 rayDir = m_rays[i*2+1]-m_rays[i*2];
+					btVector3 rayInvDir(rayDir[0] == btScalar(0.0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1.0) / rayDir[0],
+						rayDir[1] == btScalar(0.0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1.0) / rayDir[1],
+						rayDir[2] == btScalar(0.0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1.0) / rayDir[2]);
+					unsigned int signs[3] = { rayInvDir[0] < 0.0, rayInvDir[1] < 0.0, rayInvDir[2] < 0.0};
+					btScalar tmin;
+					numHits += btRayAabb2(m_rays[i*2],rayInvDir,signs,&m_aabbs[k*2],tmin,0,1) ? 1 : 0;
+				}
+				break;
+			case QUANTIZED_AABB_AABB:
+				numHits += testQuantizedAabbAgainstQuantizedAabb(&m_quantized[i*6],&m_quantized[i*6+3],&m_quantized[k*6],&m_quantized[k*6+3]) ? 1 : 0;
+				break;
+			}
+		}
+		m_sink += btScalar(numHits);
+		return NUM_INPUTS;
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// narrowphase
+
+///random transform pairs close enough that most shapes overlap or nearly touch
+struct btMicroBenchmarkPairs
+{
+	btAlignedObjectArray<btTransform>	m_transformsA;
+	btAlignedObjectArray<btTransform>	m_transformsB;
+
+	btMicroBenchmarkPairs(unsigned int seed, btScalar extent)
+	{
+		btMicroRandom rng(seed);
+		m_transformsA.resize(NUM_INPUTS);
+		m_transformsB.resize(NUM_INPUTS);
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			m_transformsA[i] = rng.transform(0);
+			m_transformsB[i] = rng.transform(extent);
+		}
+	}
+};
+
+static btConvexHullShape*	createRandomHull(btMicroRandom& rng, int numPoints)
+{
+	btConvexHullShape* hull = new btConvexHullShape();
+	for (int i=0;i<numPoints;i++)
+	{
+		btVector3 dir = rng.vector(-1,1);
+		if (dir.length2()<btScalar(1e-4))
+			dir.setValue(1,0,0);
+		hull->addPoint(dir.normalized(),false);
+	}
+	hull->recalcLocalAabb();
+	hull->initializePolyhedralFeatures();
+	return hull;
+}
+
+class btBoxBoxBenchmark : public btMicroBenchmark
+{
+	btBoxShape	m_boxA;
+	btBoxShape	m_boxB;
+	btMicroBenchmarkPairs	m_pairs;
+
+public:
+	btBoxBoxBenchmark(const char* name)
+		:btMicroBenchmark(name),
+		m_boxA(btVector3(1,btScalar(0.5),btScalar(0.75))),
+		m_boxB(btVector3(btScalar(0.5),1,btScalar(0.5))),
+		m_pairs(4,2)
+	{
+	}
+
+	virtual int	run()
+	{
+		btMicroBenchmarkResult result;
+		btBoxBoxDetector detector(&m_boxA,&m_boxB);
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			btDiscreteCollisionDetectorInterface::ClosestPointInput input;
+			input.m_transformA = m_pairs.m_transformsA[i];
+			input.m_transformB = m_pairs.m_transformsB[i];
+			detector.getClosestPoints(input,result,0);
+		}
+		m_sink += result.m_depthSum+btScalar(result.m_numContacts);
+		return NUM_INPUTS;
+	}
+};
+
+class btGjkBenchmark : public btMicroBenchmark
+{
+	btConvexHullShape*	m_hullA;
+	btConvexHullShape*	m_hullB;
+	btMicroBenchmarkPairs	m_pairs;
+	btVoronoiSimplexSolver	m_simplexSolver;
+	btGjkEpaPenetrationDepthSolver	m_penetrationSolver;
+
+public:
+	btGjkBenchmark(const char* name, int numPoints)
+		:btMicroBenchmark(name),
+		m_pairs(5,3)
+	{
+		btMicroRandom rng(6);
+		m_hullA = createRandomHull(rng,numPoints);
+		m_hullB = createRandomHull(rng,numPoints);
+	}
+	virtual ~btGjkBenchmark()
+	{
+		delete m_hullA;
+		delete m_hullB;
+	}
+
+	virtual int	run()
+	{
+		btMicroBenchmarkResult result;
+		btGjkPairDetector detector(m_hullA,m_hullB,&m_simplexSolver,&m_penetrationSolver);
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			btDiscreteCollisionDetectorInterface::ClosestPointInput input;
+			input.m_transformA = m_pairs.m_transformsA[i];
+			input.m_transformB = m_pairs.m_transformsB[i];
+			detector.getClosestPoints(input,result,0);
+		}
+		m_sink += result.m_depthSum+btScalar(result.m_numContacts);
+		return NUM_INPUTS;
+	}
+};
+
+class btPolyhedralClippingBenchmark : public btMicroBenchmark
+{
+	btConvexHullShape*	m_hullA;
+	btConvexHullShape*	m_hullB;
+	btMicroBenchmarkPairs	m_pairs;
+
+public:
+	btPolyhedralClippingBenchmark(const char* name, int numPoints)
+		:btMicroBenchmark(name),
+		m_pairs(7,btScalar(1.5))
+	{
+		btMicroRandom rng(8);
+		m_hullA = createRandomHull(rng,numPoints);
+		m_hullB = createRandomHull(rng,numPoints);
+	}
+	virtual ~btPolyhedralClippingBenchmark()
+	{
+		delete m_hullA;
+		delete m_hullB;
+	}
+
+	virtual int	run()
+	{
+		btMicroBenchmarkResult result;
+		const btConvexPolyhedron& polyA = *m_hullA->getConvexPolyhedron();
+		const btConvexPolyhedron& polyB = *m_hullB->getConvexPolyhedron();
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			const btTransform& transA = m_pairs.m_transformsA[i];
+			const btTransform& transB = m_pairs.m_transformsB[i];
+			btVector3 sep;
+			if (btPolyhedralContactClipping::findSeparatingAxis(polyA,polyB,transA,transB,sep,result))
+			{
+				btPolyhedralContactClipping::clipHullAgainstHull(sep,polyA,polyB,transA,transB,btScalar(-1e30),btScalar(0.02),result);
+			}
+		}
+		m_sink += result.m_depthSum+btScalar(result.m_numContacts);
+		return NUM_INPUTS;
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// btDbvt
+
+struct btMicroBenchmarkDbvtCollide : btDbvt::ICollide
+{
+	int		m_numHits;
+
+	btMicroBenchmarkDbvtCollide()
+		:m_numHits(0)
+	{
+	}
+	void	Process(const btDbvtNode* leaf)
+	{
+		m_numHits++;
+	}
+};
+
+class btDbvtBenchmark : public btMicroBenchmark
+{
+	btDbvt	m_tree;
+	btAlignedObjectArray<btDbvtVolume>	m_queries;
+	btAlignedObjectArray<btVector3>	m_rays;
+	bool	m_rayTest;
+
+public:
+	btDbvtBenchmark(const char* name, int numLeaves, bool rayTest)
+		:btMicroBenchmark(name),
+		m_rayTest(rayTest)
+	{
+		btMicroRandom rng(9);
+		for (int i=0;i<numLeaves;i++)
+		{
+			btVector3 center = rng.vector(-100,100);
+			btVector3 extent = rng.vector(btScalar(0.5),2);
+			m_tree.insert(btDbvtVolume::FromCE(center,extent),0);
+		}
+		m_tree.optimizeTopDown();
+		m_queries.resize(NUM_INPUTS);
+		m_rays.resize(NUM_INPUTS*2);
+		for (int j=0;j<NUM_INPUTS;j++)
+		{
+			m_queries[j] = btDbvtVolume::FromCE(rng.vector(-100,100),rng.vector(1,8));
+			m_rays[j*2] = rng.vector(-100,100);
+			m_rays[j*2+1] = m_rays[j*2]+rng.vector(-20,20);
+		}
+	}
+
+	virtual int	run()
+	{
+		btMicroBenchmarkDbvtCollide collide;
+		for (int i=0;i<NUM_INPUTS;i++)
+		{
+			if (m_rayTest)
+				btDbvt::rayTest(m_tree.m_root,m_rays[i*2],m_rays[i*2+1],collide);
+			else
+				m_tree.collideTV(m_tree.m_root,m_queries[i],collide);
+		}
+		m_sink += btScalar(collide.m_numHits);
+		return NUM_INPUTS;
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+static const char*	getPrecisionName()
+{
+#ifdef BT_USE_DOUBLE_PRECISION
+	return "double";
+#else
+	return "single";
+#endif
+}
+
+static const char*	getSimdName()
+{
+#if defined (BT_USE_SSE) && defined (BT_USE_SIMD_VECTOR3) && defined (BT_USE_SSE_IN_API)
+	return "sse";
+#elif defined (BT_USE_NEON)
+	return "neon";
+#else
+	return "scalar";
+#endif
+}
+
+struct btMicroBenchmarkTiming
+{
+	const char*	m_name;
+	int		m_numOps;
+	double	m_nsPerOp;
+};
+
+int main(int argc,char** argv)
+{
+	const char* filter = 0;
+	const char* jsonFileName = 0;
+	int numRepeats = 20;
+	for (int a=1;a<argc;a++)
+	{
+		if (!strcmp(argv[a],"--filter") && a+1<argc)
+			filter = argv[++a];
+		else if (!strcmp(argv[a],"--json") && a+1<argc)
+			jsonFileName = argv[++a];
+		else if (!strcmp(argv[a],"--repeat") && a+1<argc)
+			numRepeats = btMax(1,atoi(argv[++a]));
+		else
+		{
+			printf("usage: bullet_microbench [--filter substring] [--repeat R] [--json out.json]\n");
+			return 2;
+		}
+	}
+
+	btAlignedObjectArray<btMicroBenchmark*> benchmarks;
+	benchmarks.push_back(new btMaxDotBenchmark("btVector3::maxDot n=8",8,false));
+	benchmarks.push_back(new btMaxDotBenchmark("btVector3::maxDot n=64",64,false));
+	benchmarks.push_back(new btMaxDotBenchmark("btVector3::maxDot n=1024",1024,false));
+	benchmarks.push_back(new btMaxDotBenchmark("maxDot scalar reference n=1024",1024,true));
+	benchmarks.push_back(new btMatrixBenchmark("btMatrix3x3 multiply",btMatrixBenchmark::MULTIPLY));
+	benchmarks.push_back(new btMatrixBenchmark("btMatrix3x3::transposeTimes",btMatrixBenchmark::TRANSPOSE_TIMES));
+	benchmarks.push_back(new btMatrixBenchmark("btMatrix3x3::inverse",btMatrixBenchmark::INVERSE));
+	benchmarks.push_back(new btMatrixBenchmark("btMatrix3x3 times vector",btMatrixBenchmark::TIMES_VECTOR));
+	benchmarks.push_back(new btAabbBenchmark("TestAabbAgainstAabb2",btAabbBenchmark::AABB_AABB));
+	benchmarks.push_back(new btAabbBenchmark("btRayAabb2",btAabbBenchmark::RAY_AABB));
+	benchmarks.push_back(new btAabbBenchmark("testQuantizedAabbAgainstQuantizedAabb",btAabbBenchmark::QUANTIZED_AABB_AABB));
+	benchmarks.push_back(new btBoxBoxBenchmark("btBoxBoxDetector"));
+	benchmarks.push_back(new btGjkBenchmark("btGjkPairDetector hull32",32));
+	benchmarks.push_back(new btPolyhedralClippingBenchmark("btPolyhedralContactClipping hull16",16));
+	benchmarks.push_back(new btDbvtBenchmark("btDbvt::collideTV n=4096",4096,false));
+	benchmarks.push_back(new btDbvtBenchmark("btDbvt::rayTest n=4096",4096,true));
+
+	printf("precision %s, simd %s\n",getPrecisionName(),getSimdName());
+
+	btAlignedObjectArray<btMicroBenchmarkTiming> timings;
+	btClock clock;
+	btScalar sink = 0;
+	for (int i=0;i<benchmarks.size();i++)
+	{
+		btMicroBenchmark* bench = benchmarks[i];
+		if (filter && !strstr(bench->getName(),filter))
+			continue;
+
+		//warm up caches, then keep the fastest of numRepeats runs
+		int numOps = bench->run();
+		unsigned long long int bestTime = ~0ull;
+		for (int r=0;r<numRepeats;r++)
+		{
+			clock.reset();
+			numOps = bench->run();
+			unsigned long long int t = clock.getTimeNanoseconds();
+			if (t < bestTime)
+				bestTime = t;
+		}
+		sink += bench->m_sink;
+
+		btMicroBenchmarkTiming timing;
+		timing.m_name = bench->getName();
+		timing.m_numOps = numOps;
+		timing.m_nsPerOp = double(bestTime)/double(btMax(numOps,1));
+		timings.push_back(timing);
+		printf("%-40s %12.2f ns/op %12.4f Mops/s\n",timing.m_name,timing.m_nsPerOp,timing.m_nsPerOp>0 ? 1e3/timing.m_nsPerOp : 0.);
+	}
+	printf("(checksum %f)\n",sink);
+
+	for (int j=0;j<benchmarks.size();j++)
+		delete benchmarks[j];
+
+	if (jsonFileName)
+	{
+		FILE* f = fopen(jsonFileName,"w");
+		if (!f)
+		{
+			printf("cannot write %s\n",jsonFileName);
+			return 2;
+		}
+		fprintf(f,"{\n\t\"precision\": \"%s\",\n\t\"simd\": \"%s\",\n\t\"repeat\": %d,\n\t\"benchmarks\": [\n",getPrecisionName(),getSimdName(),numRepeats);
+		for (int k=0;k<timings.size();k++)
+		{
+			const btMicroBenchmarkTiming& t = timings[k];
+			fprintf(f,"\t\t{ \"name\": \"%s\", \"ops\": %d, \"nsPerOp\": %f }%s\n",t.m_name,t.m_numOps,t.m_nsPerOp,(k<timings.size()-1)?",":"");
+		}
+		fprintf(f,"\t]\n}\n");
+		fclose(f);
+	}
+	return 0;
+}
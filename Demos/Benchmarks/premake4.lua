@@ -20,3 +20,8 @@ files {
 	"**.h",
 }
 
+
+excludes {
+	"HeadlessBenchmark.cpp",
+	"MicroBenchmark.cpp"
+}
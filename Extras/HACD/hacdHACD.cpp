@@ -24,6 +24,9 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
+#ifdef _OPENMP
+#include <omp.h>
+#endif //_OPENMP
 
 bool gCancelRequest=false;
 namespace HACD
@@ -195,7 +198,7 @@ namespace HACD
         {
 			if (m_callBack) (*m_callBack)("+ InitializeDualGraph\n", f, m_nTriangles, 0);
 			
-			if (gCancelRequest)
+			if ((f & 1023) == 0 && !ReportProgress(10.0 * f / m_nTriangles))
 				return;
 
             i = m_triangles[f].X();
@@ -364,6 +367,10 @@ namespace HACD
         m_facePoints = 0;
         m_faceNormals = 0;
         m_ccConnectDist = 30;
+		m_progressCallBack = 0;
+		m_progressUserData = 0;
+		m_nThreads = 0;
+		m_canceled = false;
 	}																
 	HACD::~HACD(void)
 	{
@@ -374,7 +381,41 @@ namespace HACD
         delete [] m_faceNormals;
 	}
 	int iteration = 0;
+    bool HACD::ReportProgress(double progress)
+    {
+		if (m_canceled || gCancelRequest)
+		{
+			m_canceled = true;
+		}
+		else if (m_progressCallBack && !(*m_progressCallBack)(progress, m_progressUserData))
+		{
+			m_canceled = true;
+		}
+		return !m_canceled;
+    }
     void HACD::ComputeEdgeCost(size_t e)
+    {
+		PrepareEdgeCost(e);
+		EvaluateEdgeCost(e);
+	}
+    void HACD::ComputeEdgeCosts(const std::vector<long> & edges)
+    {
+		const long nEdges = static_cast<long>(edges.size());
+		// copying the vertices' convex-hulls is serial, the convex-hulls and concavities are computed concurrently
+		for(long i = 0; i < nEdges; ++i)
+		{
+			PrepareEdgeCost(edges[i]);
+		}
+#ifdef _OPENMP
+		const int nThreads = (m_nThreads > 0)? static_cast<int>(m_nThreads) : omp_get_max_threads();
+		#pragma omp parallel for schedule(dynamic) num_threads(nThreads) if(nEdges > 1)
+#endif //_OPENMP
+		for(long i = 0; i < nEdges; ++i)
+		{
+			EvaluateEdgeCost(edges[i]);
+		}
+	}
+    void HACD::PrepareEdgeCost(size_t e)
     {
 		GraphEdge & gE = m_graph.m_edges[e];
         long v1 = gE.m_v1;
@@ -425,6 +466,15 @@ namespace HACD
 		}
 		
 		ch->SetDistPoints(&gE.m_distPoints);
+	}
+    void HACD::EvaluateEdgeCost(size_t e)
+    {
+		GraphEdge & gE = m_graph.m_edges[e];
+        long v1 = gE.m_v1;
+        long v2 = gE.m_v2;
+		GraphVertex & gV1 = m_graph.m_vertices[v1];
+		GraphVertex & gV2 = m_graph.m_vertices[v2];
+        ICHull  * ch = gE.m_convexHull;
         // create the convex-hull
         while (ch->Process() == ICHullErrorInconsistent)		// if we face problems when constructing the visual-hull. really ugly!!!!
 		{
@@ -547,10 +597,26 @@ namespace HACD
     bool HACD::InitializePriorityQueue()
     {
 		m_pqueue.reserve(m_graph.m_nE + 100);
-        for (size_t e=0; e < m_graph.m_nE; ++e) 
+		// the edges are evaluated in batches, between which the progress is reported
+		const size_t batchSize = 1024;
+		std::vector<long> edges;
+		edges.reserve(batchSize);
+        for (size_t e0=0; e0 < m_graph.m_nE; e0 += batchSize) 
         {
-            ComputeEdgeCost(static_cast<long>(e));
-			m_pqueue.push(GraphEdgePriorityQueue(static_cast<long>(e), m_graph.m_edges[e].m_error));
+			if (!ReportProgress(10.0 + 30.0 * e0 / m_graph.m_nE))
+			{
+				return false;
+			}
+			edges.clear();
+			for (size_t e = e0; e < m_graph.m_nE && e < e0 + batchSize; ++e)
+			{
+				edges.push_back(static_cast<long>(e));
+			}
+			ComputeEdgeCosts(edges);
+			for (size_t i = 0; i < edges.size(); ++i)
+			{
+				m_pqueue.push(GraphEdgePriorityQueue(edges[i], m_graph.m_edges[edges[i]].m_error));
+			}
         }
 		return true;
     }
@@ -568,10 +634,17 @@ namespace HACD
 				(m_graph.GetNEdges() > 0)) 
 		{
             progress = 100.0-m_graph.GetNVertices() * 100.0 / m_nTriangles;
-            if (fabs(progress-progressOld) > ptgStep && m_callBack)
+            if (fabs(progress-progressOld) > ptgStep)
             {
-				sprintf(msg, "%3.2f %% V = %lu \t C = %f \t \t \r", progress, static_cast<unsigned long>(m_graph.GetNVertices()), globalConcavity);
-				(*m_callBack)(msg, progress, globalConcavity,  m_graph.GetNVertices());
+				if (!ReportProgress(40.0 + 0.55 * progress))
+				{
+					break;
+				}
+				if (m_callBack)
+				{
+					sprintf(msg, "%3.2f %% V = %lu \t C = %f \t \t \r", progress, static_cast<unsigned long>(m_graph.GetNVertices()), globalConcavity);
+					(*m_callBack)(msg, progress, globalConcavity,  m_graph.GetNVertices());
+				}
                 progressOld = progress;
 				if (progress > 99.0)
 				{
@@ -606,27 +679,29 @@ namespace HACD
 				v1 = m_graph.m_edges[currentEdge.m_name].m_v1;
 				v2 = m_graph.m_edges[currentEdge.m_name].m_v2;	
 				// update vertex info
-				m_graph.m_vertices[v1].m_error     = m_graph.m_edges[currentEdge.m_name].m_error;
-				m_graph.m_vertices[v1].m_surf	   = m_graph.m_edges[currentEdge.m_name].m_surf;
-				m_graph.m_vertices[v1].m_volume	   = m_graph.m_edges[currentEdge.m_name].m_volume;
-				m_graph.m_vertices[v1].m_concavity = m_graph.m_edges[currentEdge.m_name].m_concavity;
-				m_graph.m_vertices[v1].m_perimeter = m_graph.m_edges[currentEdge.m_name].m_perimeter;
-                m_graph.m_vertices[v1].m_distPoints   = m_graph.m_edges[currentEdge.m_name].m_distPoints;
-                (*m_graph.m_vertices[v1].m_convexHull) = (*m_graph.m_edges[currentEdge.m_name].m_convexHull);
-				(m_graph.m_vertices[v1].m_convexHull)->SetDistPoints(&(m_graph.m_vertices[v1].m_distPoints));
-				m_graph.m_vertices[v1].m_boudaryEdges   = m_graph.m_edges[currentEdge.m_name].m_boudaryEdges;
+				GraphEdge & gE = m_graph.m_edges[currentEdge.m_name];
+				GraphVertex & gV1 = m_graph.m_vertices[v1];
+				gV1.m_error     = gE.m_error;
+				gV1.m_surf	    = gE.m_surf;
+				gV1.m_volume	= gE.m_volume;
+				gV1.m_concavity = gE.m_concavity;
+				gV1.m_perimeter = gE.m_perimeter;
+				// the vertex takes over the convex-hull, distance points and boundary computed for the edge instead of copying them,
+				// the edge gets the vertex's old ones and is deleted by EdgeCollapse()
+                gV1.m_distPoints.swap(gE.m_distPoints);
+                std::swap(gV1.m_convexHull, gE.m_convexHull);
+				gV1.m_convexHull->SetDistPoints(&gV1.m_distPoints);
+				gV1.m_boudaryEdges.swap(gE.m_boudaryEdges);
 				
 				// We apply the optimal ecol
 //				std::cout << "v1 " << v1 << " v2 " << v2 << std::endl;
 				m_graph.EdgeCollapse(v1, v2);
 				// recompute the adjacent edges costs
-				std::set<long>::const_iterator itE(m_graph.m_vertices[v1].m_edges.begin()), 
-								   			   itEEnd(m_graph.m_vertices[v1].m_edges.end());
-				for(; itE != itEEnd; ++itE)
+				std::vector<long> edges(m_graph.m_vertices[v1].m_edges.begin(), m_graph.m_vertices[v1].m_edges.end());
+				ComputeEdgeCosts(edges);
+				for(size_t i = 0; i < edges.size(); ++i)
 				{
-					size_t e = *itE;
-					ComputeEdgeCost(static_cast<long>(e));
-					m_pqueue.push(GraphEdgePriorityQueue(static_cast<long>(e), m_graph.m_edges[e].m_error));
+					m_pqueue.push(GraphEdgePriorityQueue(edges[i], m_graph.m_edges[edges[i]].m_error));
 				}
 			}
             else
@@ -667,11 +742,16 @@ namespace HACD
     bool HACD::Compute(bool fullCH, bool exportDistPoints)
     {
 		gCancelRequest = false;
+		m_canceled = false;
 
 		if ( !m_points || !m_triangles || !m_nPoints || !m_nTriangles)
 		{
 			return false;
 		}
+		// a canceled decomposition has no clusters
+		delete [] m_convexHulls;
+		m_convexHulls = 0;
+		m_nClusters = 0;
 		size_t nV = m_nTriangles;
 		if (m_callBack)
 		{
@@ -699,18 +779,24 @@ namespace HACD
 		CreateGraph();
         // Compute the surfaces and perimeters of all the faces
 		if (m_callBack) (*m_callBack)("+ Initializing Dual Graph\n", 0.0, 0.0, nV);
-		if (gCancelRequest)
+		if (!ReportProgress(0.0))
 			return false;
 
 		InitializeDualGraph();
 		if (m_callBack) (*m_callBack)("+ Initializing Priority Queue\n", 0.0, 0.0, nV);
-		if (gCancelRequest)
+		if (!ReportProgress(10.0))
 			return false;
 
-        InitializePriorityQueue();
+        if (!InitializePriorityQueue())
+			return false;
         // we simplify the graph		
 		if (m_callBack) (*m_callBack)("+ Simplification ...\n", 0.0, 0.0, m_nTriangles);
 		Simplify();
+		if (m_canceled)
+		{
+			m_nClusters = 0;
+			return false;
+		}
 		if (m_callBack) (*m_callBack)("+ Denormalizing Data\n", 0.0, 0.0, m_nClusters);
 		DenormalizeData();
 		if (m_callBack) (*m_callBack)("+ Computing final convex-hulls\n", 0.0, 0.0, m_nClusters);
@@ -720,6 +806,11 @@ namespace HACD
 	    m_partition = new long [m_nTriangles];
 		for (size_t p = 0; p != m_cVertices.size(); ++p) 
 		{
+			if (!ReportProgress(95.0 + 5.0 * p / m_cVertices.size()))
+			{
+				m_nClusters = 0;
+				return false;
+			}
 			size_t v = m_cVertices[p];
 			m_partition[v] = static_cast<long>(p);
 			for(size_t a = 0; a < m_graph.m_vertices[v].m_ancestors.size(); a++)
@@ -765,7 +856,7 @@ namespace HACD
                 }
             }
 		}       
-        return true;
+        return ReportProgress(100.0);
     }
     
     size_t HACD::GetNTrianglesCH(size_t numCH) const
@@ -73,6 +73,8 @@ namespace HACD
 														return lhs.m_priority>rhs.m_priority;
 													}
     typedef bool (*CallBackFunction)(const char *, double, double, size_t);
+	//! Progress call-back, receives the overall progress of Compute() in percent and the user data. Returning false cancels Compute().
+    typedef bool (*ProgressCallBackFunction)(double, void *);
 
 	//! Provides an implementation of the Hierarchical Approximate Convex Decomposition (HACD) technique described in "A Simple and Efficient Approach for 3D Mesh Approximate Convex Decomposition" Game Programming Gems 8 - Chapter 2.8, p.202. A short version of the chapter was published in ICIP09 and is available at ftp://ftp.elet.polimi.it/users/Stefano.Tubaro/ICIP_USB_Proceedings_v2/pdfs/0003501.pdf
     class HACD
@@ -94,6 +96,22 @@ namespace HACD
 		//! Gives the call-back function
 		//! @return pointer to the call-back function
 		const CallBackFunction                      GetCallBack() const { return m_callBack;}
+		//! Sets the progress call-back function
+		//! @param progressCallBack pointer to the progress call-back function, returning false cancels Compute()
+		//! @param userData pointer passed to the progress call-back function
+		void										SetProgressCallBack(ProgressCallBackFunction progressCallBack, void * userData = 0) { m_progressCallBack = progressCallBack; m_progressUserData = userData;}
+		//! Gives the progress call-back function
+		//! @return pointer to the progress call-back function
+		const ProgressCallBackFunction              GetProgressCallBack() const { return m_progressCallBack;}
+		//! Sets the number of threads computing the costs of the candidate edge collapses (requires OpenMP)
+		//! @param nThreads number of threads, 0 = as many as the OpenMP runtime provides
+		void										SetNThreads(size_t nThreads) { m_nThreads = nThreads;}
+		//! Gives the number of threads computing the costs of the candidate edge collapses
+		//! @return number of threads, 0 = as many as the OpenMP runtime provides
+		const size_t								GetNThreads() const { return m_nThreads;}
+		//! Specifies whether the last call to Compute() was canceled by the progress call-back function
+		//! @return true if canceled
+		const bool									IsCanceled() const { return m_canceled;}
         
         //! Specifies whether faces points should be added when computing the concavity
 		//! @param addFacesPoints true = faces points should be added
@@ -233,6 +251,19 @@ namespace HACD
 		//! Computes the cost of an edge
 		//! @param e edge's id
         void                                        ComputeEdgeCost(size_t e);
+		//! Sets up the convex-hull and the distance points of an edge from its vertices. Not thread-safe, copying a convex-hull modifies the source.
+		//! @param e edge's id
+        void                                        PrepareEdgeCost(size_t e);
+		//! Computes the convex-hull and the cost of an edge prepared by PrepareEdgeCost(). Only modifies the edge, so different edges can be evaluated concurrently.
+		//! @param e edge's id
+        void                                        EvaluateEdgeCost(size_t e);
+		//! Computes the costs of a set of edges, in parallel when OpenMP is available
+		//! @param edges edges' ids
+        void                                        ComputeEdgeCosts(const std::vector<long> & edges);
+		//! Reports the overall progress to the progress call-back function
+		//! @param progress progress in percent
+		//! @return false if Compute() has to stop
+        bool                                        ReportProgress(double progress);
 		//! Initializes the priority queue
 		//! @param fast specifies whether fast mode is used
 		//! @return true if success
@@ -276,6 +307,10 @@ namespace HACD
         bool                                        m_addFacesPoints;           //>! specifies whether to add faces points or not
         bool                                        m_addExtraDistPoints;       //>! specifies whether to add extra points for concave shapes or not
 		bool										m_addNeighboursDistPoints;  //>! specifies whether to add extra points from adjacent clusters or not
+		ProgressCallBackFunction					m_progressCallBack;			//>! progress call-back function
+		void *										m_progressUserData;			//>! user data passed to the progress call-back function
+		size_t										m_nThreads;					//>! number of threads computing the edges costs, 0 = OpenMP default
+		bool										m_canceled;					//>! specifies whether Compute() was canceled
 
 	};
 }
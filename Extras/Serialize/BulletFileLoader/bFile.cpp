@@ -188,15 +188,44 @@ bool bFile::ok()
 }
 
 // ----------------------------------------------------- //
-void bFile::parseInternal(int verboseMode, char* memDna,int memDnaLength)
+void bFile::findDNABlock(bChunkInd& dna)
 {
-	if ( (mFlags &FD_OK) ==0)
-		return;
-
 	char *blenderData = mFileBuffer;
-	bChunkInd dna;
-	dna.oldPtr = 0;
 
+	// the DNA is usually the last block, so first walk the chunk headers instead of scanning all data
+	char *chunkPtr = blenderData + SIZEOFBLENDERHEADER;
+	const char *fileEnd = blenderData + mFileLen;
+	const int chunkHeaderLen = ChunkUtils::getOffset(mFlags);
+	while (chunkPtr + chunkHeaderLen <= fileEnd)
+	{
+		if (strncmp(chunkPtr, "SDNANAME", 8) ==0)
+		{
+			dna.oldPtr = chunkPtr;
+			dna.len = int(fileEnd - chunkPtr);
+			return;
+		}
+		bChunkInd chunk;
+		int seek = getNextBlock(&chunk, chunkPtr, mFlags);
+		if (seek < chunkHeaderLen || seek > fileEnd - chunkPtr)
+			break;
+		if (strncmp(chunkPtr, "DNA1", 4)==0)
+		{
+			if (strncmp(chunkPtr + chunkHeaderLen, "SDNANAME", 8) ==0)
+			{
+				dna = chunk;
+				dna.oldPtr = chunkPtr + chunkHeaderLen;
+				return;
+			}
+			break;
+		}
+		if (!mDataStart && strncmp(chunkPtr, "REND", 4)==0)
+			mDataStart = int(chunkPtr - blenderData);
+		chunkPtr += seek;
+	}
+
+	// fall back to a byte scan for files with inconsistent chunk headers
+	mDataStart = 0;
+	dna.oldPtr = 0;
 	char *tempBuffer = blenderData;
 	for (int i=0; i<mFileLen; i++)
 	{
@@ -232,6 +261,18 @@ void bFile::parseInternal(int verboseMode, char* memDna,int memDnaLength)
         if (mDataStart && dna.oldPtr) break;
 		tempBuffer++;
 	}
+}
+
+// ----------------------------------------------------- //
+void bFile::parseInternal(int verboseMode, char* memDna,int memDnaLength)
+{
+	if ( (mFlags &FD_OK) ==0)
+		return;
+
+	bChunkInd dna;
+	dna.oldPtr = 0;
+
+	findDNABlock(dna);
 	if (!dna.oldPtr || !dna.len)
 	{
 		//printf("Failed to find DNA1+SDNA pair\n");
@@ -750,7 +791,7 @@ char* bFile::readStruct(char *head, bChunkInd&  dataChunk)
 
 
 	char *dataAlloc = new char[(dataChunk.len)+1];
-	memset(dataAlloc, 0, dataChunk.len+1);
+	dataAlloc[dataChunk.len] = 0;
 
 
 	// track allocated
@@ -1219,13 +1260,115 @@ void bFile::resolvePointersChunk(const bChunkInd& dataChunk, int verboseMode)
 	//char* structType = fileDna->getType(oldStruct[0]);
 
 	char* cur	= (char*)findLibPointer(dataChunk.oldPtr);
+	if (verboseMode & FD_VERBOSE_EXPORT_XML)
+	{
+		for (int block=0; block<dataChunk.nr; block++)
+		{
+			resolvePointersStructRecursive(cur,dataChunk.dna_nr, verboseMode,1);
+			cur += oldLen;
+		}
+		return;
+	}
+
+	if (m_pointerLayoutStart.size() != fileDna->getNumStructs())
+	{
+		m_pointerLayoutStart.resize(fileDna->getNumStructs(),-1);
+		m_pointerLayoutCount.resize(fileDna->getNumStructs(),0);
+	}
+	if (m_pointerLayoutStart[dataChunk.dna_nr] < 0)
+	{
+		m_pointerLayoutStart[dataChunk.dna_nr] = m_pointerLayouts.size();
+		buildPointerLayout(dataChunk.dna_nr,0);
+		m_pointerLayoutCount[dataChunk.dna_nr] = m_pointerLayouts.size()-m_pointerLayoutStart[dataChunk.dna_nr];
+	}
+
+	int numFixups = m_pointerLayoutCount[dataChunk.dna_nr];
+	if (!numFixups || !cur)
+		return;
+	const bPointerFixup* fixups = &m_pointerLayouts[m_pointerLayoutStart[dataChunk.dna_nr]];
+
 	for (int block=0; block<dataChunk.nr; block++)
 	{
-		resolvePointersStructRecursive(cur,dataChunk.dna_nr, verboseMode,1);
+		for (int f=0; f<numFixups; f++)
+		{
+			void** ptrptr = (void**)(cur + fixups[f].m_offset);
+			void* ptr = findLibPointer(*ptrptr);
+			if (fixups[f].m_kind == bPointerFixup::PTR_ARRAY_ELEMENT)
+			{
+				*ptrptr = ptr;
+			} else if (ptr)
+			{
+				*ptrptr = ptr;
+				if (fixups[f].m_kind == bPointerFixup::PTR_POINTER_ARRAY)
+				{
+					// This	will only work if the given	**array	is continuous
+					void **array= (void**)ptr;
+					void *np= array[0];
+					int	n=0;
+					while (np)
+					{
+						np= findLibPointer(array[n]);
+						if (np) array[n]= np;
+						n++;
+					}
+				}
+			}
+		}
 		cur += oldLen;
 	}
 }
 
+///appends the pointer locations of struct dna_nr, placed at offset, to m_pointerLayouts. Mirrors the walk of resolvePointersStructRecursive
+int bFile::buildPointerLayout(int dna_nr, int offset)
+{
+	bParse::bDNA* fileDna = mFileDNA ? mFileDNA : mMemoryDNA;
+
+	short	firstStructType = fileDna->getStruct(0)[0];
+	short int* oldStruct = fileDna->getStruct(dna_nr);
+
+	int elementLength = oldStruct[1];
+	oldStruct+=2;
+
+	int totalSize = 0;
+
+	for (int ele=0; ele<elementLength; ele++, oldStruct+=2)
+	{
+		char* memName = fileDna->getName(oldStruct[1]);
+		int arrayLen = fileDna->getArraySizeNew(oldStruct[1]);
+		if (memName[0] == '*')
+		{
+			if (arrayLen > 1)
+			{
+				for (int a=0; a<arrayLen; a++)
+				{
+					bPointerFixup fixup;
+					fixup.m_offset = offset+totalSize+a*int(sizeof(void*));
+					fixup.m_kind = bPointerFixup::PTR_ARRAY_ELEMENT;
+					m_pointerLayouts.push_back(fixup);
+				}
+			} else
+			{
+				bPointerFixup fixup;
+				fixup.m_offset = offset+totalSize;
+				fixup.m_kind = memName[1] == '*' ? bPointerFixup::PTR_POINTER_ARRAY : bPointerFixup::PTR_SINGLE;
+				m_pointerLayouts.push_back(fixup);
+			}
+		} else if (oldStruct[0]>=firstStructType)
+		{
+			int revType = fileDna->getReverseType(oldStruct[0]);
+			int byteOffset = 0;
+			for (int i=0;i<arrayLen;i++)
+			{
+				byteOffset += buildPointerLayout(revType, offset+totalSize+byteOffset);
+			}
+		}
+
+		totalSize += fileDna->getElementSize(oldStruct[0], oldStruct[1]);
+	}
+
+	return totalSize;
+}
+
 
 int bFile::resolvePointersStructRecursive(char *strcPtr, int dna_nr, int verboseMode,int recursion)
 {
@@ -43,6 +43,23 @@ namespace bParse {
 		FD_VERBOSE_DUMP_CHUNKS = 4,
 		FD_VERBOSE_DUMP_FILE_INFO=8,
 	};
+
+	///location of one pointer inside a struct of the file DNA, relative to the start of the struct
+	struct bPointerFixup
+	{
+		enum
+		{
+			///element of a pointer array, replaced even when it can't be resolved
+			PTR_ARRAY_ELEMENT,
+			///replaced only when it can be resolved
+			PTR_SINGLE,
+			///a resolved ** also gets the pointers of the array it points to resolved
+			PTR_POINTER_ARRAY
+		};
+		int	m_offset;
+		int	m_kind;
+	};
+
 	// ----------------------------------------------------- //
 	class bFile
 	{
@@ -68,6 +85,12 @@ namespace bParse {
 		btAlignedObjectArray<bChunkInd>	m_chunks;
         btHashMap<btHashPtr, bChunkInd> m_chunkPtrPtrMap;
 
+		///pointer locations of each file DNA struct, flattened over nested structs. Built on first use,
+		///so resolvePointers doesn't walk the DNA for every struct and skips structs without pointers
+		btAlignedObjectArray<bPointerFixup>	m_pointerLayouts;
+		btAlignedObjectArray<int>	m_pointerLayoutStart;
+		btAlignedObjectArray<int>	m_pointerLayoutCount;
+
         // 
 	
 		bPtrMap				mDataPointers;
@@ -89,6 +112,8 @@ namespace bParse {
 		void resolvePointersChunk(const bChunkInd& dataChunk, int verboseMode);
 
 		int resolvePointersStructRecursive(char *strcPtr, int old_dna, int verboseMode, int recursion);
+		int buildPointerLayout(int dna_nr, int offset);
+		void findDNABlock(bChunkInd& dna);
 		//void swapPtr(char *dst, char *src);
 
 		void parseStruct(char *strcPtr, char *dtPtr, int old_dna, int new_dna, bool fixupPointers);
@@ -0,0 +1,126 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+///bullet_cook cooks Wavefront .obj files into a shape cache, see btShapeCooker.
+///Each file is stored under its path as given on the command line. When the output already exists,
+///the shapes whose input and parameters did not change are copied from it instead of cooked again.
+
+#include "btShapeCooker.h"
+#include "cd_wavefront.h"
+#include "LinearMath/btQuickprof.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void	printUsage()
+{
+	printf("usage: bullet_cook [options] output.cache input.obj...\n");
+	printf("  --hull          cook the convex hull of each input (default)\n");
+	printf("  --mesh          cook each input as a static triangle mesh\n");
+	printf("  --simplify      reduce hulls with btShapeHull\n");
+	printf("  --margin x      collision margin of hulls\n");
+	printf("  --no-edge-info  skip the internal edge info of meshes\n");
+	printf("  --no-quantize   use an unquantized bvh for meshes\n");
+	printf("  --rebuild       cook everything, ignoring the existing output\n");
+}
+
+int main(int argc, char** argv)
+{
+	btShapeCookingParams params;
+	bool cookMeshes = false;
+	bool rebuild = false;
+	int arg = 1;
+	for (;arg<argc && argv[arg][0]=='-' && argv[arg][1]=='-';arg++)
+	{
+		if (!strcmp(argv[arg],"--hull"))
+			cookMeshes = false;
+		else if (!strcmp(argv[arg],"--mesh"))
+			cookMeshes = true;
+		else if (!strcmp(argv[arg],"--simplify"))
+			params.m_simplifyHulls = true;
+		else if (!strcmp(argv[arg],"--margin") && arg+1<argc)
+			params.m_hullMargin = btScalar(atof(argv[++arg]));
+		else if (!strcmp(argv[arg],"--no-edge-info"))
+			params.m_generateInternalEdgeInfo = false;
+		else if (!strcmp(argv[arg],"--no-quantize"))
+			params.m_useQuantizedBvh = false;
+		else if (!strcmp(argv[arg],"--rebuild"))
+			rebuild = true;
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+	if (argc-arg < 2)
+	{
+		printUsage();
+		return 1;
+	}
+	const char* outputFileName = argv[arg++];
+
+	btShapeCache previousCache;
+	btShapeCooker cooker(params);
+	if (!rebuild && previousCache.loadFile(outputFileName))
+	{
+		cooker.setPreviousCache(&previousCache);
+	}
+
+	btClock clock;
+	int numFailed = 0;
+	for (;arg<argc;arg++)
+	{
+		const char* fileName = argv[arg];
+		ConvexDecomposition::WavefrontObj obj;
+		obj.loadObj(fileName);
+		if (!obj.mVertexCount || !obj.mTriCount)
+		{
+			printf("%s: cannot load\n",fileName);
+			numFailed++;
+			continue;
+		}
+
+		btAlignedObjectArray<btVector3> vertices;
+		vertices.resize(obj.mVertexCount);
+		for (int i=0;i<obj.mVertexCount;i++)
+		{
+			vertices[i].setValue(obj.mVertices[i*3],obj.mVertices[i*3+1],obj.mVertices[i*3+2]);
+		}
+
+		unsigned long start = clock.getTimeMicroseconds();
+		int numReused = cooker.getNumReused();
+		bool ok = cookMeshes ?
+			cooker.addTriangleMesh(fileName,&vertices[0],vertices.size(),obj.mIndices,obj.mTriCount) :
+			cooker.addConvexHull(fileName,&vertices[0],vertices.size());
+		unsigned long time = clock.getTimeMicroseconds()-start;
+
+		if (!ok)
+		{
+			printf("%s: cooking failed\n",fileName);
+			numFailed++;
+		} else
+		{
+			printf("%s: %s in %.3f ms\n",fileName,cooker.getNumReused()>numReused ? "reused" : "cooked",time*0.001);
+		}
+	}
+
+	if (!cooker.writeFile(outputFileName))
+	{
+		printf("%s: cannot write\n",outputFileName);
+		return 1;
+	}
+	printf("%s: %d shapes, %d reused, %d failed\n",outputFileName,cooker.getNumEntries(),cooker.getNumReused(),numFailed);
+	return numFailed ? 1 : 0;
+}
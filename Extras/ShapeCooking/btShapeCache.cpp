@@ -0,0 +1,438 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btShapeCache.h"
+#include "btShapeCacheFormat.h"
+#include "BulletCollision/CollisionShapes/btConvexHullShape.h"
+#include "BulletCollision/CollisionShapes/btConvexPolyhedron.h"
+#include "BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h"
+#include "BulletCollision/CollisionShapes/btOptimizedBvh.h"
+#include "BulletCollision/CollisionShapes/btTriangleInfoMap.h"
+#include "BulletCollision/CollisionShapes/btShapeAsset.h"
+#include <stdio.h>
+#include <string.h>
+
+btCookedTriangleMesh::btCookedTriangleMesh(const btVector3* vertices, int numVertices, const int* indices, int numTriangles)
+{
+	m_vertices.resize(numVertices);
+	if (numVertices)
+		memcpy(&m_vertices[0],vertices,numVertices*sizeof(btVector3));
+	m_indices.resize(numTriangles*3);
+	if (numTriangles)
+		memcpy(&m_indices[0],indices,numTriangles*3*sizeof(int));
+
+	btIndexedMesh mesh;
+	mesh.m_numTriangles = numTriangles;
+	mesh.m_triangleIndexBase = numTriangles ? (const unsigned char*)&m_indices[0] : 0;
+	mesh.m_triangleIndexStride = 3*sizeof(int);
+	mesh.m_numVertices = numVertices;
+	mesh.m_vertexBase = numVertices ? (const unsigned char*)&m_vertices[0] : 0;
+	mesh.m_vertexStride = sizeof(btVector3);
+	addIndexedMesh(mesh,PHY_INTEGER);
+}
+
+btShapeCache::btShapeCache()
+{
+}
+
+bool	btShapeCache::loadFromMemory(const char* data, int size)
+{
+	m_data.clear();
+	m_entries.clear();
+	m_entryByName.clear();
+
+	btShapeCacheReader header(data,size);
+	char magic[BT_SHAPE_CACHE_MAGIC_LENGTH];
+	header.read(magic,BT_SHAPE_CACHE_MAGIC_LENGTH);
+	int version = header.readInt();
+	int scalarSize = header.readInt();
+	int pointerSize = header.readInt();
+	int endianTag = header.readInt();
+	int numEntries = header.readInt();
+	if (!header.m_ok || memcmp(magic,BT_SHAPE_CACHE_MAGIC,BT_SHAPE_CACHE_MAGIC_LENGTH) != 0 ||
+		version != BT_SHAPE_CACHE_VERSION || scalarSize != int(sizeof(btScalar)) || pointerSize != int(sizeof(void*)) || endianTag != BT_SHAPE_CACHE_ENDIAN_TAG ||
+		numEntries < 0 || numEntries > (size-header.m_offset)/BT_SHAPE_CACHE_ENTRY_SIZE)
+	{
+		return false;
+	}
+
+	btAlignedObjectArray<btShapeCacheEntry> entries;
+	entries.resize(numEntries);
+	for (int i=0;i<numEntries;i++)
+	{
+		btShapeCacheEntry& entry = entries[i];
+		entry.m_type = header.readInt();
+		entry.m_nameOffset = header.readInt();
+		entry.m_dataOffset = header.readInt();
+		entry.m_dataSize = header.readInt();
+		unsigned int hashLow = header.readInt();
+		unsigned int hashHigh = header.readInt();
+		entry.m_hash = (btShapeCacheHash(hashHigh)<<32) | hashLow;
+
+		//the name must be a terminated string and the data a range inside the cache
+		if (entry.m_nameOffset < header.m_offset || entry.m_nameOffset >= size ||
+			!memchr(data+entry.m_nameOffset,0,size-entry.m_nameOffset) ||
+			entry.m_dataOffset < header.m_offset || entry.m_dataSize <= 0 || entry.m_dataSize > size-entry.m_dataOffset)
+		{
+			return false;
+		}
+	}
+	if (!header.m_ok)
+		return false;
+
+	m_data.resize(size);
+	memcpy(&m_data[0],data,size);
+	m_entries.copyFromArray(entries);
+	for (int i=0;i<m_entries.size();i++)
+	{
+		m_entryByName.insert(getEntryName(i),i);
+	}
+	return true;
+}
+
+bool	btShapeCache::loadFile(const char* fileName)
+{
+	FILE* file = fopen(fileName,"rb");
+	if (!file)
+		return false;
+	fseek(file,0,SEEK_END);
+	long size = ftell(file);
+	fseek(file,0,SEEK_SET);
+
+	btAlignedObjectArray<char> buffer;
+	bool ok = size > 0 && size < 0x7fffffff;
+	if (ok)
+	{
+		buffer.resize(int(size));
+		ok = fread(&buffer[0],1,size,file) == size_t(size);
+	}
+	fclose(file);
+	return ok && loadFromMemory(&buffer[0],buffer.size());
+}
+
+int		btShapeCache::findEntry(const char* name) const
+{
+	const int* entry = m_entryByName.find(name);
+	return entry ? *entry : -1;
+}
+
+int		btShapeCache::findEntry(const char* name, btShapeCacheHash hash) const
+{
+	int entry = findEntry(name);
+	if (entry >= 0 && m_entries[entry].m_hash != hash)
+		return -1;
+	return entry;
+}
+
+static bool	btReadConvexHull(btShapeCacheReader& reader, btScalar& margin, btAlignedObjectArray<btVector3>& points,
+	btConvexPolyhedron* polyhedron, btCookedMassProperties* massProperties)
+{
+	margin = reader.readScalar();
+	int numPoints = reader.readCount(3*sizeof(btScalar));
+	points.resize(numPoints);
+	for (int i=0;i<numPoints;i++)
+	{
+		points[i] = reader.readVector3();
+	}
+
+	btConvexPolyhedron tmpPolyhedron;
+	if (!polyhedron)
+		polyhedron = &tmpPolyhedron;
+	int numVertices = reader.readCount(3*sizeof(btScalar));
+	polyhedron->m_vertices.resize(numVertices);
+	for (int i=0;i<numVertices;i++)
+	{
+		polyhedron->m_vertices[i] = reader.readVector3();
+	}
+	int numFaces = reader.readCount(sizeof(int)+4*sizeof(btScalar));
+	polyhedron->m_faces.resize(numFaces);
+	for (int i=0;i<numFaces;i++)
+	{
+		btFace& face = polyhedron->m_faces[i];
+		int numIndices = reader.readCount(sizeof(int));
+		face.m_indices.resize(numIndices);
+		for (int j=0;j<numIndices;j++)
+		{
+			face.m_indices[j] = reader.readInt();
+			if (face.m_indices[j] < 0 || face.m_indices[j] >= numVertices)
+				reader.m_ok = false;
+		}
+		for (int j=0;j<4;j++)
+		{
+			face.m_plane[j] = reader.readScalar();
+		}
+	}
+	int numEdges = reader.readCount(3*sizeof(btScalar));
+	polyhedron->m_uniqueEdges.resize(numEdges);
+	for (int i=0;i<numEdges;i++)
+	{
+		polyhedron->m_uniqueEdges[i] = reader.readVector3();
+	}
+	polyhedron->m_localCenter = reader.readVector3();
+	polyhedron->m_extents = reader.readVector3();
+	polyhedron->m_radius = reader.readScalar();
+	polyhedron->mC = reader.readVector3();
+	polyhedron->mE = reader.readVector3();
+
+	btCookedMassProperties tmpMassProperties;
+	if (!massProperties)
+		massProperties = &tmpMassProperties;
+	massProperties->m_volume = reader.readScalar();
+	massProperties->m_centerOfMass = reader.readVector3();
+	massProperties->m_principalInertia = reader.readVector3();
+	btVector3 axis = reader.readVector3();
+	massProperties->m_principalAxes.setValue(axis.x(),axis.y(),axis.z(),reader.readScalar());
+
+	return reader.m_ok;
+}
+
+btConvexHullShape*	btShapeCache::createConvexHullShape(int entry) const
+{
+	if (m_entries[entry].m_type != BT_COOKED_CONVEX_HULL)
+		return 0;
+
+	int size;
+	const char* data = getEntryData(entry,size);
+	btShapeCacheReader reader(data,size);
+	btScalar margin;
+	btAlignedObjectArray<btVector3> points;
+	btConvexPolyhedron polyhedron;
+	if (!btReadConvexHull(reader,margin,points,&polyhedron,0) || !points.size())
+		return 0;
+
+	btConvexHullShape* hull = new btConvexHullShape(&points[0].getX(),points.size(),sizeof(btVector3));
+	if (margin != hull->getMargin())
+	{
+		//the cached aabb includes the margin
+		hull->setMargin(margin);
+		hull->recalcLocalAabb();
+	}
+	hull->setPolyhedralFeatures(polyhedron);
+	return hull;
+}
+
+bool	btShapeCache::getMassProperties(int entry, btCookedMassProperties& massProperties) const
+{
+	if (m_entries[entry].m_type != BT_COOKED_CONVEX_HULL)
+		return false;
+
+	int size;
+	const char* data = getEntryData(entry,size);
+	btShapeCacheReader reader(data,size);
+	btScalar margin;
+	btAlignedObjectArray<btVector3> points;
+	return btReadConvexHull(reader,margin,points,0,&massProperties);
+}
+
+///gives read access to the protected counts of a serialized bvh, without constructing it
+class btSerializedBvhHeader : public btOptimizedBvh
+{
+public:
+	int		getNumNodes() const
+	{
+		return m_curNodeIndex;
+	}
+	int		getNumSubtreeHeaders() const
+	{
+		return m_subtreeHeaderCount;
+	}
+	bool	usesQuantization() const
+	{
+		return m_useQuantization;
+	}
+	int		getTraversalMode() const
+	{
+		return m_traversalMode;
+	}
+};
+
+///checks a serialized bvh before btOptimizedBvh::deSerializeInPlace uses it, which only asserts on a bad size.
+///The cache is in native byte order, so the header needs no swapping. Besides the size, the escape indices have to stay
+///within the nodes and the leaves have to reference triangles of the mesh, or queries read out of bounds.
+///The recursive traversal is rejected, as its child indices are not covered by these checks and the cooker never writes it.
+static bool	btCheckSerializedBvh(const void* bvhData, int bvhSize, bool useQuantizedBvh, int numTriangles)
+{
+	if (bvhSize < int(sizeof(btQuantizedBvh)))
+		return false;
+	const btSerializedBvhHeader* header = (const btSerializedBvhHeader*)bvhData;
+	const int nodeSize = useQuantizedBvh ? int(sizeof(btQuantizedBvhNode)) : int(sizeof(btOptimizedBvhNode));
+	const int numNodes = header->getNumNodes();
+	const int numSubtreeHeaders = header->getNumSubtreeHeaders();
+	int remaining = bvhSize - int(sizeof(btQuantizedBvh));
+	if (header->usesQuantization() != useQuantizedBvh ||
+		(header->getTraversalMode() != btQuantizedBvh::TRAVERSAL_STACKLESS && header->getTraversalMode() != btQuantizedBvh::TRAVERSAL_STACKLESS_CACHE_FRIENDLY) ||
+		numNodes < 1 || numNodes > 2*numTriangles || numNodes > remaining/nodeSize)
+	{
+		return false;
+	}
+	remaining -= numNodes*nodeSize;
+	if (numSubtreeHeaders < 0 || numSubtreeHeaders > remaining/int(sizeof(btBvhSubtreeInfo)) ||
+		header->calculateSerializeBufferSize() != unsigned(bvhSize))
+	{
+		return false;
+	}
+
+	const char* nodeData = (const char*)bvhData + sizeof(btQuantizedBvh);
+	if (useQuantizedBvh)
+	{
+		const btQuantizedBvhNode* nodes = (const btQuantizedBvhNode*)nodeData;
+		for (int i=0;i<numNodes;i++)
+		{
+			const int value = nodes[i].m_escapeIndexOrTriangleIndex;
+			if (value >= 0)
+			{
+				//a single mesh part
+				if (nodes[i].getPartId() != 0 || nodes[i].getTriangleIndex() >= numTriangles)
+					return false;
+			} else if (value < -(numNodes-i))
+			{
+				return false;
+			}
+		}
+	} else
+	{
+		const btOptimizedBvhNode* nodes = (const btOptimizedBvhNode*)nodeData;
+		for (int i=0;i<numNodes;i++)
+		{
+			if (nodes[i].m_escapeIndex == -1)
+			{
+				if (nodes[i].m_subPart != 0 || nodes[i].m_triangleIndex < 0 || nodes[i].m_triangleIndex >= numTriangles)
+					return false;
+			} else if (nodes[i].m_escapeIndex < 1 || nodes[i].m_escapeIndex > numNodes-i)
+			{
+				return false;
+			}
+		}
+	}
+
+	const btBvhSubtreeInfo* subtrees = (const btBvhSubtreeInfo*)(nodeData + numNodes*nodeSize);
+	for (int i=0;i<numSubtreeHeaders;i++)
+	{
+		if (subtrees[i].m_rootNodeIndex < 0 || subtrees[i].m_rootNodeIndex >= numNodes ||
+			subtrees[i].m_subtreeSize < 1 || subtrees[i].m_subtreeSize > numNodes-subtrees[i].m_rootNodeIndex)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+btBvhTriangleMeshShape*	btShapeCache::createTriangleMeshShape(int entry) const
+{
+	if (m_entries[entry].m_type != BT_COOKED_TRIANGLE_MESH)
+		return 0;
+
+	int size;
+	const char* data = getEntryData(entry,size);
+	btShapeCacheReader reader(data,size);
+
+	int numVertices = reader.readCount(3*sizeof(btScalar));
+	btAlignedObjectArray<btVector3> vertices;
+	vertices.resize(numVertices);
+	for (int i=0;i<numVertices;i++)
+	{
+		vertices[i] = reader.readVector3();
+	}
+	int numTriangles = reader.readCount(3*sizeof(int));
+	btAlignedObjectArray<int> indices;
+	indices.resize(numTriangles*3);
+	for (int i=0;i<numTriangles*3;i++)
+	{
+		indices[i] = reader.readInt();
+		if (indices[i] < 0 || indices[i] >= numVertices)
+			reader.m_ok = false;
+	}
+	btVector3 aabbMin = reader.readVector3();
+	btVector3 aabbMax = reader.readVector3();
+	bool useQuantizedBvh = reader.readInt() != 0;
+	int bvhSize = reader.readCount(1);
+	const char* bvhData = reader.skip(bvhSize);
+
+	btTriangleInfoMap* triangleInfoMap = 0;
+	int numTriangleInfos = reader.readInt();
+	if (numTriangleInfos >= 0)
+	{
+		triangleInfoMap = new btTriangleInfoMap();
+		triangleInfoMap->m_convexEpsilon = reader.readScalar();
+		triangleInfoMap->m_planarEpsilon = reader.readScalar();
+		triangleInfoMap->m_equalVertexThreshold = reader.readScalar();
+		triangleInfoMap->m_edgeDistanceThreshold = reader.readScalar();
+		triangleInfoMap->m_maxEdgeAngleThreshold = reader.readScalar();
+		triangleInfoMap->m_zeroAreaThreshold = reader.readScalar();
+		numTriangleInfos = reader.readCount(2*sizeof(int)+3*sizeof(btScalar));
+		for (int i=0;i<numTriangleInfos;i++)
+		{
+			int key = reader.readInt();
+			btTriangleInfo info;
+			info.m_flags = reader.readInt();
+			info.m_edgeV0V1Angle = reader.readScalar();
+			info.m_edgeV1V2Angle = reader.readScalar();
+			info.m_edgeV2V0Angle = reader.readScalar();
+			triangleInfoMap->insert(key,info);
+		}
+	}
+	if (!reader.m_ok || !numTriangles || !bvhSize)
+	{
+		delete triangleInfoMap;
+		return 0;
+	}
+
+	//deSerializeInPlace constructs the bvh at the start of the buffer, so it is freed like a bvh allocated with btAlignedAlloc
+	void* bvhMemory = btAlignedAlloc(bvhSize,16);
+	memcpy(bvhMemory,bvhData,bvhSize);
+	if (!btCheckSerializedBvh(bvhMemory,bvhSize,useQuantizedBvh,numTriangles))
+	{
+		btAlignedFree(bvhMemory);
+		delete triangleInfoMap;
+		return 0;
+	}
+
+	btCookedTriangleMesh* mesh = new btCookedTriangleMesh(&vertices[0],numVertices,&indices[0],numTriangles);
+	//skips the aabb computation of the btTriangleMeshShape constructor
+	mesh->setPremadeAabb(aabbMin,aabbMax);
+
+	btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(bvhMemory,bvhSize,false);
+	if (!bvh)
+	{
+		btAlignedFree(bvhMemory);
+		delete mesh;
+		delete triangleInfoMap;
+		return 0;
+	}
+
+	btBvhTriangleMeshShape* shape = new btBvhTriangleMeshShape(mesh,useQuantizedBvh,false);
+	shape->setOptimizedBvh(bvh);
+
+	if (triangleInfoMap)
+		shape->setTriangleInfoMap(triangleInfoMap);
+	return shape;
+}
+
+btShapeAsset*	btShapeCache::createShapeAsset(int entry) const
+{
+	btCollisionShape* shape = 0;
+	switch (m_entries[entry].m_type)
+	{
+	case BT_COOKED_CONVEX_HULL:
+		shape = createConvexHullShape(entry);
+		break;
+	case BT_COOKED_TRIANGLE_MESH:
+		shape = createTriangleMeshShape(entry);
+		break;
+	default:
+		break;
+	}
+	return shape ? new btShapeAsset(shape) : 0;
+}
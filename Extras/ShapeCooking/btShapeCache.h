@@ -0,0 +1,136 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_SHAPE_CACHE_H
+#define BT_SHAPE_CACHE_H
+
+#include "LinearMath/btQuaternion.h"
+#include "LinearMath/btAlignedObjectArray.h"
+#include "LinearMath/btHashMap.h"
+#include "BulletCollision/CollisionShapes/btTriangleIndexVertexArray.h"
+
+class btConvexHullShape;
+class btBvhTriangleMeshShape;
+class btShapeAsset;
+
+///bump when the layout of the cache or the cooking results change, older caches are rejected
+#define BT_SHAPE_CACHE_VERSION 2
+
+///64 bit FNV-1a hash of the cooking input and parameters
+typedef unsigned long long int btShapeCacheHash;
+
+enum btCookedShapeType
+{
+	BT_COOKED_CONVEX_HULL = 1,
+	BT_COOKED_TRIANGLE_MESH = 2
+};
+
+///mass properties of a cooked convex hull for a density of one, not including the collision margin
+struct btCookedMassProperties
+{
+	btScalar	m_volume;
+	btVector3	m_centerOfMass;
+	///inertia per unit mass around the principal axes through the center of mass
+	btVector3	m_principalInertia;
+	///rotation from the principal axes frame to the shape frame
+	btQuaternion	m_principalAxes;
+};
+
+///btCookedTriangleMesh is a btTriangleIndexVertexArray that owns its vertex and index arrays
+ATTRIBUTE_ALIGNED16(class) btCookedTriangleMesh : public btTriangleIndexVertexArray
+{
+	btAlignedObjectArray<btVector3>	m_vertices;
+	btAlignedObjectArray<int>	m_indices;
+
+public:
+
+	BT_DECLARE_ALIGNED_ALLOCATOR();
+
+	btCookedTriangleMesh(const btVector3* vertices, int numVertices, const int* indices, int numTriangles);
+};
+
+///btShapeCache loads the binary cache written by btShapeCooker and creates ready to use shapes from it.
+///Convex hulls come with their polyhedral features and mass properties, triangle meshes with their quantized bvh and
+///internal edge info, nothing is recomputed. The cache is written for one platform: files with another endianness,
+///btScalar precision or version are rejected, cook them again.
+class btShapeCache
+{
+	struct btShapeCacheEntry
+	{
+		int	m_type;
+		int	m_nameOffset;
+		int	m_dataOffset;
+		int	m_dataSize;
+		btShapeCacheHash	m_hash;
+	};
+
+	btAlignedObjectArray<char>	m_data;
+	btAlignedObjectArray<btShapeCacheEntry>	m_entries;
+	btHashMap<btHashString,int>	m_entryByName;
+
+public:
+
+	btShapeCache();
+
+	///copies the cache from memory. Returns false, leaving the cache empty, when the data is not a valid cache for this platform
+	bool	loadFromMemory(const char* data, int size);
+
+	bool	loadFile(const char* fileName);
+
+	int		getNumEntries() const
+	{
+		return m_entries.size();
+	}
+
+	///the entry of the shape cooked under name, or -1
+	int		findEntry(const char* name) const;
+
+	///the entry of the shape cooked under name from input matching hash (see btShapeCooker::computeConvexHullHash), or -1 when missing or stale
+	int		findEntry(const char* name, btShapeCacheHash hash) const;
+
+	const char*	getEntryName(int entry) const
+	{
+		return &m_data[m_entries[entry].m_nameOffset];
+	}
+	int		getEntryType(int entry) const
+	{
+		return m_entries[entry].m_type;
+	}
+	btShapeCacheHash	getEntryHash(int entry) const
+	{
+		return m_entries[entry].m_hash;
+	}
+	///the cooked data of entry, as written by btShapeCooker
+	const char*	getEntryData(int entry, int& size) const
+	{
+		size = m_entries[entry].m_dataSize;
+		return &m_data[m_entries[entry].m_dataOffset];
+	}
+
+	///creates the convex hull shape of a BT_COOKED_CONVEX_HULL entry, with its polyhedral features and margin set. Returns 0 for other entries.
+	btConvexHullShape*	createConvexHullShape(int entry) const;
+
+	bool	getMassProperties(int entry, btCookedMassProperties& massProperties) const;
+
+	///creates the bvh triangle mesh shape of a BT_COOKED_TRIANGLE_MESH entry. Returns 0 for other entries.
+	///As with any btBvhTriangleMeshShape, the caller owns the mesh interface, the bvh (set with setOptimizedBvh) and the triangle info map,
+	///use createShapeAsset to have them all owned by an asset.
+	btBvhTriangleMeshShape*	createTriangleMeshShape(int entry) const;
+
+	///creates the shape of entry wrapped in a btShapeAsset, which owns it and everything it references
+	btShapeAsset*	createShapeAsset(int entry) const;
+};
+
+#endif //BT_SHAPE_CACHE_H
@@ -0,0 +1,161 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_SHAPE_CACHE_FORMAT_H
+#define BT_SHAPE_CACHE_FORMAT_H
+
+///Layout of a shape cache, all values in the native byte order and btScalar precision of the cooking platform:
+///header: 8 byte magic, version, sizeof(btScalar), sizeof(void*), endian tag, number of entries. The serialized btOptimizedBvh
+///is used in place, and its layout depends on the pointer size.
+///entry table: per entry its type, name offset, data offset, data size and the low and high 32 bits of its hash
+///then the zero terminated names and the data of each entry, starting at 16 byte aligned offsets.
+///Convex hull data: margin, hull points, the btConvexPolyhedron (vertices, faces with indices and plane, unique edges,
+///local center, extents, radius, mC, mE) and the btCookedMassProperties.
+///Triangle mesh data: vertices, triangle indices, local aabb, quantized flag, the serialized btOptimizedBvh and
+///the btTriangleInfoMap (-1 when there is none, else its parameters and its triangle infos).
+
+#include "LinearMath/btVector3.h"
+#include "LinearMath/btAlignedObjectArray.h"
+#include <string.h>
+
+#define BT_SHAPE_CACHE_MAGIC "BTSHAPES"
+#define BT_SHAPE_CACHE_MAGIC_LENGTH 8
+#define BT_SHAPE_CACHE_ENDIAN_TAG 0x01020304
+#define BT_SHAPE_CACHE_HEADER_SIZE (BT_SHAPE_CACHE_MAGIC_LENGTH+5*4)
+#define BT_SHAPE_CACHE_ENTRY_SIZE (6*4)
+
+///bounds checked reads, after the first failure all reads return zero and m_ok stays false
+struct btShapeCacheReader
+{
+	const char*	m_data;
+	int		m_size;
+	int		m_offset;
+	bool	m_ok;
+
+	btShapeCacheReader(const char* data, int size)
+		:m_data(data),
+		m_size(size),
+		m_offset(0),
+		m_ok(true)
+	{
+	}
+
+	const char*	skip(int numBytes)
+	{
+		if (!m_ok || numBytes < 0 || numBytes > m_size-m_offset)
+		{
+			m_ok = false;
+			return 0;
+		}
+		const char* ptr = m_data+m_offset;
+		m_offset += numBytes;
+		return ptr;
+	}
+
+	void	read(void* out, int numBytes)
+	{
+		const char* ptr = skip(numBytes);
+		if (ptr)
+			memcpy(out,ptr,numBytes);
+		else
+			memset(out,0,numBytes);
+	}
+
+	int		readInt()
+	{
+		int value;
+		read(&value,sizeof(int));
+		return value;
+	}
+
+	btScalar	readScalar()
+	{
+		btScalar value;
+		read(&value,sizeof(btScalar));
+		return value;
+	}
+
+	btVector3	readVector3()
+	{
+		btScalar x = readScalar();
+		btScalar y = readScalar();
+		btScalar z = readScalar();
+		return btVector3(x,y,z);
+	}
+
+	///reads an element count, and fails unless that many elements of elementSize bytes can follow
+	int		readCount(int elementSize)
+	{
+		int count = readInt();
+		if (count < 0 || count > (m_size-m_offset)/elementSize)
+		{
+			m_ok = false;
+			return 0;
+		}
+		return count;
+	}
+};
+
+struct btShapeCacheWriter
+{
+	btAlignedObjectArray<char>&	m_buffer;
+
+	btShapeCacheWriter(btAlignedObjectArray<char>& buffer)
+		:m_buffer(buffer)
+	{
+	}
+
+	char*	append(int numBytes)
+	{
+		int offset = m_buffer.size();
+		//grow geometrically, resize alone reserves the exact size
+		if (m_buffer.capacity() < offset+numBytes)
+			m_buffer.reserve(2*(offset+numBytes));
+		m_buffer.resize(offset+numBytes);
+		return numBytes ? &m_buffer[offset] : 0;
+	}
+
+	void	write(const void* data, int numBytes)
+	{
+		if (numBytes)
+			memcpy(append(numBytes),data,numBytes);
+	}
+
+	void	writeInt(int value)
+	{
+		write(&value,sizeof(int));
+	}
+
+	void	writeScalar(btScalar value)
+	{
+		write(&value,sizeof(btScalar));
+	}
+
+	void	writeVector3(const btVector3& value)
+	{
+		writeScalar(value.x());
+		writeScalar(value.y());
+		writeScalar(value.z());
+	}
+
+	///pads with zeros up to a multiple of alignment
+	void	align(int alignment)
+	{
+		int padding = (alignment - (m_buffer.size() % alignment)) % alignment;
+		memset(append(padding),0,padding);
+	}
+};
+
+#endif //BT_SHAPE_CACHE_FORMAT_H
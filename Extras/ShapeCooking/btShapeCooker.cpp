@@ -0,0 +1,416 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btShapeCooker.h"
+#include "btShapeCacheFormat.h"
+#include "BulletCollision/CollisionShapes/btConvexHullShape.h"
+#include "BulletCollision/CollisionShapes/btConvexPolyhedron.h"
+#include "BulletCollision/CollisionShapes/btShapeHull.h"
+#include "BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h"
+#include "BulletCollision/CollisionShapes/btOptimizedBvh.h"
+#include "BulletCollision/CollisionShapes/btTriangleInfoMap.h"
+#include "BulletCollision/CollisionDispatch/btInternalEdgeUtility.h"
+#include "LinearMath/btConvexHullComputer.h"
+#include "LinearMath/btMatrix3x3.h"
+#include <stdio.h>
+#include <string.h>
+
+struct btShapeCacheHasher
+{
+	btShapeCacheHash	m_hash;
+
+	btShapeCacheHasher()
+		:m_hash(14695981039346656037ULL)
+	{
+		addInt(BT_SHAPE_CACHE_VERSION);
+		addInt(int(sizeof(btScalar)));
+	}
+
+	void	add(const void* data, int numBytes)
+	{
+		const unsigned char* bytes = (const unsigned char*)data;
+		for (int i=0;i<numBytes;i++)
+		{
+			m_hash ^= bytes[i];
+			m_hash *= 1099511628211ULL;
+		}
+	}
+
+	void	addInt(int value)
+	{
+		add(&value,sizeof(int));
+	}
+
+	void	addScalar(btScalar value)
+	{
+		add(&value,sizeof(btScalar));
+	}
+
+	///only x, y and z, the unused w of the input does not change the hash
+	void	addVector3(const btVector3& value)
+	{
+		addScalar(value.x());
+		addScalar(value.y());
+		addScalar(value.z());
+	}
+};
+
+btShapeCooker::btShapeCooker(const btShapeCookingParams& params)
+:m_params(params),
+m_previousCache(0),
+m_numReused(0)
+{
+}
+
+btShapeCacheHash	btShapeCooker::computeConvexHullHash(const btVector3* points, int numPoints, const btShapeCookingParams& params)
+{
+	btShapeCacheHasher hasher;
+	hasher.addInt(BT_COOKED_CONVEX_HULL);
+	hasher.addScalar(params.m_hullMargin);
+	hasher.addInt(params.m_simplifyHulls);
+	hasher.addInt(numPoints);
+	for (int i=0;i<numPoints;i++)
+	{
+		hasher.addVector3(points[i]);
+	}
+	return hasher.m_hash;
+}
+
+btShapeCacheHash	btShapeCooker::computeTriangleMeshHash(const btVector3* vertices, int numVertices, const int* indices, int numTriangles, const btShapeCookingParams& params)
+{
+	btShapeCacheHasher hasher;
+	hasher.addInt(BT_COOKED_TRIANGLE_MESH);
+	hasher.addInt(params.m_useQuantizedBvh);
+	hasher.addInt(params.m_generateInternalEdgeInfo);
+	hasher.addInt(numVertices);
+	for (int i=0;i<numVertices;i++)
+	{
+		hasher.addVector3(vertices[i]);
+	}
+	hasher.addInt(numTriangles);
+	hasher.add(indices,numTriangles*3*sizeof(int));
+	return hasher.m_hash;
+}
+
+void	btShapeCooker::computeMassProperties(const btConvexPolyhedron& polyhedron, btCookedMassProperties& massProperties)
+{
+	//sum the tetrahedra between the reference point and the triangles of each face, with the covariance of a tetrahedron
+	//with a vertex in the origin being det(A)*A*C*A^T for the columns of A its other vertices and C the canonical covariance
+	const btMatrix3x3 canonical(2,1,1,1,2,1,1,1,2);
+	const btVector3 reference = polyhedron.m_localCenter;
+	btScalar sixTimesVolume = btScalar(0.);
+	btVector3 weightedCenter(btScalar(0.),btScalar(0.),btScalar(0.));
+	btMatrix3x3 covariance(0,0,0,0,0,0,0,0,0);
+
+	for (int i=0;i<polyhedron.m_faces.size();i++)
+	{
+		const btFace& face = polyhedron.m_faces[i];
+		if (face.m_indices.size() < 3)
+			continue;
+		const btVector3 a = polyhedron.m_vertices[face.m_indices[0]] - reference;
+		for (int j=2;j<face.m_indices.size();j++)
+		{
+			const btVector3 b = polyhedron.m_vertices[face.m_indices[j-1]] - reference;
+			const btVector3 c = polyhedron.m_vertices[face.m_indices[j]] - reference;
+			btScalar det = a.dot(b.cross(c));
+			btMatrix3x3 A(a.x(),b.x(),c.x(),
+						a.y(),b.y(),c.y(),
+						a.z(),b.z(),c.z());
+			btMatrix3x3 tetrahedronCovariance = A*canonical*A.transpose();
+			for (int k=0;k<3;k++)
+			{
+				covariance[k] += tetrahedronCovariance[k]*det;
+			}
+			sixTimesVolume += det;
+			weightedCenter += (a+b+c)*det;
+		}
+	}
+
+	//the winding of the faces decides the sign
+	if (sixTimesVolume < btScalar(0.))
+	{
+		sixTimesVolume = -sixTimesVolume;
+		weightedCenter = -weightedCenter;
+		for (int k=0;k<3;k++)
+		{
+			covariance[k] = -covariance[k];
+		}
+	}
+
+	massProperties.m_volume = sixTimesVolume/btScalar(6.);
+	massProperties.m_centerOfMass = reference;
+	massProperties.m_principalInertia.setValue(btScalar(0.),btScalar(0.),btScalar(0.));
+	massProperties.m_principalAxes = btQuaternion::getIdentity();
+	if (sixTimesVolume <= SIMD_EPSILON)
+		return;
+
+	btScalar volume = massProperties.m_volume;
+	btVector3 center = weightedCenter/(btScalar(4.)*sixTimesVolume);
+	massProperties.m_centerOfMass = reference + center;
+	for (int k=0;k<3;k++)
+	{
+		covariance[k] = covariance[k]/btScalar(120.) - center*(center[k]*volume);
+	}
+
+	btScalar trace = covariance[0][0]+covariance[1][1]+covariance[2][2];
+	btMatrix3x3 inertia(trace-covariance[0][0],-covariance[0][1],-covariance[0][2],
+						-covariance[1][0],trace-covariance[1][1],-covariance[1][2],
+						-covariance[2][0],-covariance[2][1],trace-covariance[2][2]);
+	btMatrix3x3 rotation;
+	inertia.diagonalize(rotation,btScalar(0.00001),20);
+	massProperties.m_principalInertia.setValue(inertia[0][0]/volume,inertia[1][1]/volume,inertia[2][2]/volume);
+	rotation.getRotation(massProperties.m_principalAxes);
+}
+
+int		btShapeCooker::findEntry(const char* name) const
+{
+	for (int i=0;i<m_entries.size();i++)
+	{
+		if (strcmp(&m_names[m_entries[i].m_nameOffset],name) == 0)
+			return i;
+	}
+	return -1;
+}
+
+void	btShapeCooker::addEntry(int type, const char* name, btShapeCacheHash hash, const char* data, int size)
+{
+	btCookedEntry entry;
+	entry.m_type = type;
+	entry.m_hash = hash;
+
+	btShapeCacheWriter names(m_names);
+	entry.m_nameOffset = m_names.size();
+	names.write(name,int(strlen(name))+1);
+
+	btShapeCacheWriter writer(m_data);
+	writer.align(16);
+	entry.m_dataOffset = m_data.size();
+	entry.m_dataSize = size;
+	writer.write(data,size);
+
+	m_entries.push_back(entry);
+}
+
+bool	btShapeCooker::reuseEntry(int type, const char* name, btShapeCacheHash hash)
+{
+	if (!m_previousCache)
+		return false;
+	int entry = m_previousCache->findEntry(name,hash);
+	if (entry < 0 || m_previousCache->getEntryType(entry) != type)
+		return false;
+
+	int size;
+	const char* data = m_previousCache->getEntryData(entry,size);
+	addEntry(type,name,hash,data,size);
+	m_numReused++;
+	return true;
+}
+
+bool	btShapeCooker::addConvexHull(const char* name, const btVector3* points, int numPoints)
+{
+	if (numPoints <= 0 || findEntry(name) >= 0)
+		return false;
+	btShapeCacheHash hash = computeConvexHullHash(points,numPoints,m_params);
+	if (reuseEntry(BT_COOKED_CONVEX_HULL,name,hash))
+		return true;
+
+	//only the hull vertices are kept
+	btConvexHullComputer hullComputer;
+	hullComputer.compute(&points[0].getX(),sizeof(btVector3),numPoints,btScalar(0.),btScalar(0.));
+	if (!hullComputer.vertices.size())
+		return false;
+
+	btAlignedObjectArray<btVector3> hullPoints;
+	hullPoints.copyFromArray(hullComputer.vertices);
+	if (m_params.m_simplifyHulls)
+	{
+		//without margin the support vertices are the points themselves
+		btConvexHullShape tmpHull(&hullPoints[0].getX(),hullPoints.size(),sizeof(btVector3));
+		tmpHull.setMargin(btScalar(0.));
+		btShapeHull shapeHull(&tmpHull);
+		if (shapeHull.buildHull(btScalar(0.)) && shapeHull.numVertices())
+		{
+			hullPoints.resize(shapeHull.numVertices());
+			memcpy(&hullPoints[0],shapeHull.getVertexPointer(),hullPoints.size()*sizeof(btVector3));
+		}
+	}
+
+	btConvexHullShape hull(&hullPoints[0].getX(),hullPoints.size(),sizeof(btVector3));
+	hull.setMargin(m_params.m_hullMargin);
+	if (!hull.initializePolyhedralFeatures())
+		return false;
+	const btConvexPolyhedron& polyhedron = *hull.getConvexPolyhedron();
+	btCookedMassProperties massProperties;
+	computeMassProperties(polyhedron,massProperties);
+
+	btAlignedObjectArray<char> data;
+	btShapeCacheWriter writer(data);
+	writer.writeScalar(hull.getMargin());
+	writer.writeInt(hull.getNumPoints());
+	for (int i=0;i<hull.getNumPoints();i++)
+	{
+		writer.writeVector3(hull.getUnscaledPoints()[i]);
+	}
+
+	writer.writeInt(polyhedron.m_vertices.size());
+	for (int i=0;i<polyhedron.m_vertices.size();i++)
+	{
+		writer.writeVector3(polyhedron.m_vertices[i]);
+	}
+	writer.writeInt(polyhedron.m_faces.size());
+	for (int i=0;i<polyhedron.m_faces.size();i++)
+	{
+		const btFace& face = polyhedron.m_faces[i];
+		writer.writeInt(face.m_indices.size());
+		for (int j=0;j<face.m_indices.size();j++)
+		{
+			writer.writeInt(face.m_indices[j]);
+		}
+		for (int j=0;j<4;j++)
+		{
+			writer.writeScalar(face.m_plane[j]);
+		}
+	}
+	writer.writeInt(polyhedron.m_uniqueEdges.size());
+	for (int i=0;i<polyhedron.m_uniqueEdges.size();i++)
+	{
+		writer.writeVector3(polyhedron.m_uniqueEdges[i]);
+	}
+	writer.writeVector3(polyhedron.m_localCenter);
+	writer.writeVector3(polyhedron.m_extents);
+	writer.writeScalar(polyhedron.m_radius);
+	writer.writeVector3(polyhedron.mC);
+	writer.writeVector3(polyhedron.mE);
+
+	writer.writeScalar(massProperties.m_volume);
+	writer.writeVector3(massProperties.m_centerOfMass);
+	writer.writeVector3(massProperties.m_principalInertia);
+	writer.writeScalar(massProperties.m_principalAxes.x());
+	writer.writeScalar(massProperties.m_principalAxes.y());
+	writer.writeScalar(massProperties.m_principalAxes.z());
+	writer.writeScalar(massProperties.m_principalAxes.w());
+
+	addEntry(BT_COOKED_CONVEX_HULL,name,hash,&data[0],data.size());
+	return true;
+}
+
+bool	btShapeCooker::addTriangleMesh(const char* name, const btVector3* vertices, int numVertices, const int* indices, int numTriangles)
+{
+	if (numVertices <= 0 || numTriangles <= 0 || findEntry(name) >= 0)
+		return false;
+	for (int i=0;i<numTriangles*3;i++)
+	{
+		if (indices[i] < 0 || indices[i] >= numVertices)
+			return false;
+	}
+	btShapeCacheHash hash = computeTriangleMeshHash(vertices,numVertices,indices,numTriangles,m_params);
+	if (reuseEntry(BT_COOKED_TRIANGLE_MESH,name,hash))
+		return true;
+
+	btCookedTriangleMesh mesh(vertices,numVertices,indices,numTriangles);
+	btBvhTriangleMeshShape shape(&mesh,m_params.m_useQuantizedBvh,true);
+
+	btAlignedObjectArray<char> data;
+	btShapeCacheWriter writer(data);
+	writer.writeInt(numVertices);
+	for (int i=0;i<numVertices;i++)
+	{
+		writer.writeVector3(vertices[i]);
+	}
+	writer.writeInt(numTriangles);
+	writer.write(indices,numTriangles*3*sizeof(int));
+	writer.writeVector3(shape.getLocalAabbMin());
+	writer.writeVector3(shape.getLocalAabbMax());
+	writer.writeInt(m_params.m_useQuantizedBvh);
+
+	btOptimizedBvh* bvh = shape.getOptimizedBvh();
+	int bvhSize = bvh->calculateSerializeBufferSize();
+	void* bvhBuffer = btAlignedAlloc(bvhSize,16);
+	bvh->serializeInPlace(bvhBuffer,bvhSize,false);
+	writer.writeInt(bvhSize);
+	writer.write(bvhBuffer,bvhSize);
+	btAlignedFree(bvhBuffer);
+
+	if (m_params.m_generateInternalEdgeInfo)
+	{
+		btTriangleInfoMap triangleInfoMap;
+		btGenerateInternalEdgeInfo(&shape,&triangleInfoMap);
+		writer.writeInt(triangleInfoMap.size());
+		writer.writeScalar(triangleInfoMap.m_convexEpsilon);
+		writer.writeScalar(triangleInfoMap.m_planarEpsilon);
+		writer.writeScalar(triangleInfoMap.m_equalVertexThreshold);
+		writer.writeScalar(triangleInfoMap.m_edgeDistanceThreshold);
+		writer.writeScalar(triangleInfoMap.m_maxEdgeAngleThreshold);
+		writer.writeScalar(triangleInfoMap.m_zeroAreaThreshold);
+		writer.writeInt(triangleInfoMap.size());
+		for (int i=0;i<triangleInfoMap.size();i++)
+		{
+			const btTriangleInfo* info = triangleInfoMap.getAtIndex(i);
+			writer.writeInt(triangleInfoMap.getKeyAtIndex(i).getUid1());
+			writer.writeInt(info->m_flags);
+			writer.writeScalar(info->m_edgeV0V1Angle);
+			writer.writeScalar(info->m_edgeV1V2Angle);
+			writer.writeScalar(info->m_edgeV2V0Angle);
+		}
+		shape.setTriangleInfoMap(0);
+	} else
+	{
+		writer.writeInt(-1);
+	}
+
+	addEntry(BT_COOKED_TRIANGLE_MESH,name,hash,&data[0],data.size());
+	return true;
+}
+
+void	btShapeCooker::write(btAlignedObjectArray<char>& buffer) const
+{
+	buffer.clear();
+	btShapeCacheWriter writer(buffer);
+	writer.write(BT_SHAPE_CACHE_MAGIC,BT_SHAPE_CACHE_MAGIC_LENGTH);
+	writer.writeInt(BT_SHAPE_CACHE_VERSION);
+	writer.writeInt(int(sizeof(btScalar)));
+	writer.writeInt(int(sizeof(void*)));
+	writer.writeInt(BT_SHAPE_CACHE_ENDIAN_TAG);
+	writer.writeInt(m_entries.size());
+
+	int namesOffset = BT_SHAPE_CACHE_HEADER_SIZE + m_entries.size()*BT_SHAPE_CACHE_ENTRY_SIZE;
+	int dataOffset = ((namesOffset + m_names.size() + 15)/16)*16;
+	for (int i=0;i<m_entries.size();i++)
+	{
+		const btCookedEntry& entry = m_entries[i];
+		writer.writeInt(entry.m_type);
+		writer.writeInt(namesOffset+entry.m_nameOffset);
+		writer.writeInt(dataOffset+entry.m_dataOffset);
+		writer.writeInt(entry.m_dataSize);
+		writer.writeInt(int(entry.m_hash & 0xffffffff));
+		writer.writeInt(int(entry.m_hash >> 32));
+	}
+	btAssert(buffer.size() == namesOffset);
+	writer.write(m_names.size() ? &m_names[0] : 0,m_names.size());
+	writer.align(16);
+	btAssert(buffer.size() == dataOffset);
+	writer.write(m_data.size() ? &m_data[0] : 0,m_data.size());
+}
+
+bool	btShapeCooker::writeFile(const char* fileName) const
+{
+	btAlignedObjectArray<char> buffer;
+	write(buffer);
+	FILE* file = fopen(fileName,"wb");
+	if (!file)
+		return false;
+	bool ok = fwrite(&buffer[0],1,buffer.size(),file) == size_t(buffer.size());
+	return (fclose(file) == 0) && ok;
+}
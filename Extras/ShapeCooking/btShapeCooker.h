@@ -0,0 +1,105 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_SHAPE_COOKER_H
+#define BT_SHAPE_COOKER_H
+
+#include "btShapeCache.h"
+
+class btConvexPolyhedron;
+
+struct btShapeCookingParams
+{
+	btScalar	m_hullMargin;
+	///reduce hulls to at most 42 vertices with btShapeHull
+	bool		m_simplifyHulls;
+	bool		m_useQuantizedBvh;
+	///run btGenerateInternalEdgeInfo for triangle meshes
+	bool		m_generateInternalEdgeInfo;
+
+	btShapeCookingParams()
+		:m_hullMargin(btScalar(0.04)),
+		m_simplifyHulls(false),
+		m_useQuantizedBvh(true),
+		m_generateInternalEdgeInfo(true)
+	{
+	}
+};
+
+///btShapeCooker does the expensive shape preprocessing offline and writes the results into a cache for btShapeCache.
+///Convex hulls are reduced to their hull vertices (btConvexHullComputer, optionally btShapeHull), and get their
+///polyhedral features and exact mass properties. Triangle meshes get their bvh and internal edge info.
+///Every entry stores a hash of its input and the cooking parameters, so a cooker given the previous cache only cooks
+///the shapes whose input changed.
+class btShapeCooker
+{
+	struct btCookedEntry
+	{
+		int	m_type;
+		int	m_nameOffset;
+		int	m_dataOffset;
+		int	m_dataSize;
+		btShapeCacheHash	m_hash;
+	};
+
+	btShapeCookingParams	m_params;
+	btAlignedObjectArray<btCookedEntry>	m_entries;
+	btAlignedObjectArray<char>	m_names;
+	btAlignedObjectArray<char>	m_data;
+	const btShapeCache*	m_previousCache;
+	int		m_numReused;
+
+	int		findEntry(const char* name) const;
+	void	addEntry(int type, const char* name, btShapeCacheHash hash, const char* data, int size);
+	bool	reuseEntry(int type, const char* name, btShapeCacheHash hash);
+
+public:
+
+	btShapeCooker(const btShapeCookingParams& params = btShapeCookingParams());
+
+	///entries of cache whose name, type and input hash match are copied instead of cooked again. The cache must outlive the cooker.
+	void	setPreviousCache(const btShapeCache* cache)
+	{
+		m_previousCache = cache;
+	}
+
+	///cooks the convex hull of points under name
+	bool	addConvexHull(const char* name, const btVector3* points, int numPoints);
+
+	///cooks a static triangle mesh under name, indices holds three vertex indices per triangle
+	bool	addTriangleMesh(const char* name, const btVector3* vertices, int numVertices, const int* indices, int numTriangles);
+
+	int		getNumEntries() const
+	{
+		return m_entries.size();
+	}
+	///number of entries copied from the previous cache
+	int		getNumReused() const
+	{
+		return m_numReused;
+	}
+
+	void	write(btAlignedObjectArray<char>& buffer) const;
+	bool	writeFile(const char* fileName) const;
+
+	///hashes of the cooking input, to check at runtime that a cached shape is not stale
+	static btShapeCacheHash	computeConvexHullHash(const btVector3* points, int numPoints, const btShapeCookingParams& params);
+	static btShapeCacheHash	computeTriangleMeshHash(const btVector3* vertices, int numVertices, const int* indices, int numTriangles, const btShapeCookingParams& params);
+
+	///volume, center of mass and principal inertia of a closed convex polyhedron with density one
+	static void	computeMassProperties(const btConvexPolyhedron& polyhedron, btCookedMassProperties& massProperties);
+};
+
+#endif //BT_SHAPE_COOKER_H
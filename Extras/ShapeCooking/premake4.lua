@@ -0,0 +1,20 @@
+	project "ShapeCooking"
+		
+	kind "StaticLib"
+	targetdir "../../lib"
+	includedirs {".","../../src"}
+	files {
+		"btShapeCache.cpp",
+		"btShapeCooker.cpp",
+		"**.h"
+	}
+
+	project "bullet_cook"
+
+	kind "ConsoleApp"
+	targetdir "../../bin"
+	includedirs {".","../../src","../ConvexDecomposition"}
+	links {"ShapeCooking","ConvexDecomposition","BulletCollision","LinearMath"}
+	files {
+		"ShapeCookingTool.cpp"
+	}
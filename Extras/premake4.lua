@@ -1,6 +1,7 @@
 
 include "HACD"
 include "ConvexDecomposition"
+include "ShapeCooking"
 
 include "Serialize/BulletFileLoader"
 include "Serialize/BulletWorldImporter"
@@ -9,11 +9,15 @@
 #include "TestLinearMath.h"
 #include "TestPolarDecomposition.h"
 #include "TestCholeskyDecomposition.h"
+#include "TestWorldSnapshot.h"
+#include "TestTransformStream.h"
 
   CPPUNIT_TEST_SUITE_REGISTRATION( TestLinearMath );
   CPPUNIT_TEST_SUITE_REGISTRATION( TestBulletOnly );
   CPPUNIT_TEST_SUITE_REGISTRATION( TestPolarDecomposition );
   CPPUNIT_TEST_SUITE_REGISTRATION( TestCholeskyDecomposition );
+  CPPUNIT_TEST_SUITE_REGISTRATION( TestWorldSnapshot );
+  CPPUNIT_TEST_SUITE_REGISTRATION( TestTransformStream );
 
 
 
@@ -0,0 +1,230 @@
+#include "TestShapeCache.h"
+#include "btShapeCache.h"
+#include "btShapeCooker.h"
+#include "BulletCollision/CollisionShapes/btConvexHullShape.h"
+#include "BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h"
+#include "BulletCollision/CollisionShapes/btOptimizedBvh.h"
+#include "BulletCollision/CollisionShapes/btShapeAsset.h"
+#include "BulletCollision/CollisionShapes/btTriangleIndexVertexArray.h"
+#include "BulletCollision/NarrowPhaseCollision/btRaycastCallback.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// The shape cooking library is only built with the extras, so this suite
+// registers itself instead of being listed in Main.cpp.
+CPPUNIT_TEST_SUITE_REGISTRATION( TestShapeCache );
+
+namespace
+{
+  const int GRID = 16;
+  const btScalar TOLERANCE = btScalar(1e-5);
+
+  class ClosestHitCallback : public btTriangleRaycastCallback
+  {
+    public:
+      ClosestHitCallback(const btVector3& from, const btVector3& to)
+        : btTriangleRaycastCallback(from, to)
+      {
+      }
+
+      virtual btScalar reportHit(const btVector3& /*hitNormalLocal*/, btScalar hitFraction, int /*partId*/, int /*triangleIndex*/)
+      {
+        if (hitFraction < m_hitFraction)
+          m_hitFraction = hitFraction;
+        return m_hitFraction;
+      }
+  };
+}
+
+void TestShapeCache::setUp()
+{
+  // A box with half extents one, plus interior points the hull drops.
+  for (int i = 0; i < 8; ++i)
+    m_hullPoints.push_back(btVector3((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1));
+  m_hullPoints.push_back(btVector3(0, 0, 0));
+  m_hullPoints.push_back(btVector3(btScalar(0.5), btScalar(-0.25), btScalar(0.1)));
+
+  // A bumpy grid of two triangles per cell.
+  for (int z = 0; z <= GRID; ++z)
+    for (int x = 0; x <= GRID; ++x)
+      m_vertices.push_back(btVector3(btScalar(x), btSin(btScalar(x + z)) * btScalar(0.25), btScalar(z)));
+  for (int z = 0; z < GRID; ++z)
+  {
+    for (int x = 0; x < GRID; ++x)
+    {
+      const int v = z * (GRID + 1) + x;
+      m_indices.push_back(v);
+      m_indices.push_back(v + GRID + 1);
+      m_indices.push_back(v + 1);
+      m_indices.push_back(v + 1);
+      m_indices.push_back(v + GRID + 1);
+      m_indices.push_back(v + GRID + 2);
+    }
+  }
+  cook();
+}
+
+void TestShapeCache::tearDown()
+{
+  m_hullPoints.clear();
+  m_vertices.clear();
+  m_indices.clear();
+  m_buffer.clear();
+}
+
+void TestShapeCache::cook()
+{
+  btShapeCooker cooker;
+  CPPUNIT_ASSERT(cooker.addConvexHull("box", &m_hullPoints[0], m_hullPoints.size()));
+  CPPUNIT_ASSERT(cooker.addTriangleMesh("grid", &m_vertices[0], m_vertices.size(), &m_indices[0], m_indices.size() / 3));
+  cooker.write(m_buffer);
+}
+
+btScalar TestShapeCache::raycast(btCollisionShape* shape, const btVector3& from, const btVector3& to) const
+{
+  ClosestHitCallback callback(from, to);
+  static_cast<btBvhTriangleMeshShape*>(shape)->performRaycast(&callback, from, to);
+  return callback.m_hitFraction;
+}
+
+void TestShapeCache::testConvexHullRoundTrip()
+{
+  btShapeCache cache;
+  CPPUNIT_ASSERT(cache.loadFromMemory(&m_buffer[0], m_buffer.size()));
+  CPPUNIT_ASSERT_EQUAL(2, cache.getNumEntries());
+
+  const btShapeCacheHash hash = btShapeCooker::computeConvexHullHash(&m_hullPoints[0], m_hullPoints.size(), btShapeCookingParams());
+  const int entry = cache.findEntry("box", hash);
+  CPPUNIT_ASSERT(entry >= 0);
+  CPPUNIT_ASSERT_EQUAL(int(BT_COOKED_CONVEX_HULL), cache.getEntryType(entry));
+  // A stale hash does not find the entry.
+  CPPUNIT_ASSERT_EQUAL(-1, cache.findEntry("box", hash + 1));
+
+  btConvexHullShape* shape = cache.createConvexHullShape(entry);
+  CPPUNIT_ASSERT(shape != 0);
+  CPPUNIT_ASSERT_EQUAL(8, shape->getNumPoints());
+  CPPUNIT_ASSERT(shape->getConvexPolyhedron() != 0);
+  delete shape;
+
+  // Unit density box with half extents one: volume 8, inertia 2/3 per unit mass.
+  btCookedMassProperties massProperties;
+  CPPUNIT_ASSERT(cache.getMassProperties(entry, massProperties));
+  CPPUNIT_ASSERT(btFabs(massProperties.m_volume - 8) < TOLERANCE);
+  CPPUNIT_ASSERT(massProperties.m_centerOfMass.length() < TOLERANCE);
+  for (int i = 0; i < 3; ++i)
+    CPPUNIT_ASSERT(btFabs(massProperties.m_principalInertia[i] - btScalar(2.) / btScalar(3.)) < TOLERANCE);
+}
+
+void TestShapeCache::testTriangleMeshRoundTrip()
+{
+  btShapeCache cache;
+  CPPUNIT_ASSERT(cache.loadFromMemory(&m_buffer[0], m_buffer.size()));
+  const int entry = cache.findEntry("grid");
+  CPPUNIT_ASSERT(entry >= 0);
+  CPPUNIT_ASSERT(cache.createConvexHullShape(entry) == 0);
+
+  btShapeAsset* asset = cache.createShapeAsset(entry);
+  CPPUNIT_ASSERT(asset != 0);
+  btBvhTriangleMeshShape* cooked = static_cast<btBvhTriangleMeshShape*>(asset->getShape());
+  CPPUNIT_ASSERT(cooked->getTriangleInfoMap() != 0);
+
+  // The same rays hit the cooked shape and a shape built from the input.
+  btTriangleIndexVertexArray mesh(m_indices.size() / 3, &m_indices[0], 3 * sizeof(int),
+    m_vertices.size(), &m_vertices[0][0], sizeof(btVector3));
+  btBvhTriangleMeshShape reference(&mesh, true);
+  btVector3 cookedMin, cookedMax, referenceMin, referenceMax;
+  cooked->getAabb(btTransform::getIdentity(), cookedMin, cookedMax);
+  reference.getAabb(btTransform::getIdentity(), referenceMin, referenceMax);
+  CPPUNIT_ASSERT((cookedMin - referenceMin).length() < TOLERANCE);
+  CPPUNIT_ASSERT((cookedMax - referenceMax).length() < TOLERANCE);
+  for (int i = 0; i < 50; ++i)
+  {
+    const btVector3 from(btScalar(i % 10) * btScalar(1.7) + btScalar(0.3), 5, btScalar(i / 10) * btScalar(3.1) + btScalar(0.2));
+    const btVector3 to = from + btVector3(btScalar(0.5), -10, btScalar(-0.25));
+    CPPUNIT_ASSERT_EQUAL(raycast(&reference, from, to), raycast(cooked, from, to));
+  }
+  asset->release();
+}
+
+void TestShapeCache::testTruncatedCacheIsRejected()
+{
+  btShapeCache cache;
+  CPPUNIT_ASSERT(!cache.loadFromMemory(&m_buffer[0], 8));
+  CPPUNIT_ASSERT(!cache.loadFromMemory(&m_buffer[0], m_buffer.size() / 2));
+  CPPUNIT_ASSERT_EQUAL(0, cache.getNumEntries());
+
+  btAlignedObjectArray<char> corrupt;
+  corrupt.copyFromArray(m_buffer);
+  corrupt[0] ^= 0x55;
+  CPPUNIT_ASSERT(!cache.loadFromMemory(&corrupt[0], corrupt.size()));
+  CPPUNIT_ASSERT_EQUAL(0, cache.getNumEntries());
+
+  // A cache cooked with a different pointer size, stored after the magic,
+  // the version and the scalar size.
+  corrupt.copyFromArray(m_buffer);
+  const int pointerSize = sizeof(void*) == 8 ? 4 : 8;
+  memcpy(&corrupt[8 + 2 * sizeof(int)], &pointerSize, sizeof(int));
+  CPPUNIT_ASSERT(!cache.loadFromMemory(&corrupt[0], corrupt.size()));
+  CPPUNIT_ASSERT_EQUAL(0, cache.getNumEntries());
+
+  CPPUNIT_ASSERT(cache.loadFromMemory(&m_buffer[0], m_buffer.size()));
+  CPPUNIT_ASSERT_EQUAL(2, cache.getNumEntries());
+}
+
+void TestShapeCache::testCorruptBvhIsRejected()
+{
+  btShapeCache cache;
+  CPPUNIT_ASSERT(cache.loadFromMemory(&m_buffer[0], m_buffer.size()));
+  const int entry = cache.findEntry("grid");
+  int size = 0;
+  const char* data = cache.getEntryData(entry, size);
+
+  // Find the entry in the file. The bvh follows the vertices, the indices,
+  // the aabb, the quantization flag and the bvh size.
+  int dataOffset = -1;
+  for (int i = 0; i + size <= m_buffer.size() && dataOffset < 0; ++i)
+    if (memcmp(&m_buffer[i], data, size) == 0)
+      dataOffset = i;
+  CPPUNIT_ASSERT(dataOffset >= 0);
+  const int numVertices = m_vertices.size();
+  const int numTriangles = m_indices.size() / 3;
+  const int bvhSizeOffset = dataOffset + int(sizeof(int) + 3 * numVertices * sizeof(btScalar) + sizeof(int) + 3 * numTriangles * sizeof(int) + 6 * sizeof(btScalar) + sizeof(int));
+  int bvhSize = 0;
+  memcpy(&bvhSize, &m_buffer[bvhSizeOffset], sizeof(int));
+  CPPUNIT_ASSERT(bvhSize > 0 && bvhSizeOffset + int(sizeof(int)) + bvhSize <= dataOffset + size);
+
+  // Node counts of 0x01010101 make the bvh larger than its block.
+  btAlignedObjectArray<char> corrupt;
+  corrupt.copyFromArray(m_buffer);
+  memset(&corrupt[bvhSizeOffset + sizeof(int)], 1, bvhSize);
+  btShapeCache corruptCache;
+  CPPUNIT_ASSERT(corruptCache.loadFromMemory(&corrupt[0], corrupt.size()));
+  CPPUNIT_ASSERT(corruptCache.createTriangleMeshShape(entry) == 0);
+  CPPUNIT_ASSERT(corruptCache.createShapeAsset(entry) == 0);
+
+  // A leaf referencing a triangle past the mesh, and an escape index past
+  // the last node, keep the size of the bvh intact.
+  const int nodesOffset = bvhSizeOffset + int(sizeof(int) + sizeof(btQuantizedBvh));
+  const int numNodes = 2 * numTriangles - 1;
+  CPPUNIT_ASSERT(nodesOffset + numNodes * int(sizeof(btQuantizedBvhNode)) <= bvhSizeOffset + int(sizeof(int)) + bvhSize);
+  int leaf = -1;
+  for (int i = 0; i < numNodes && leaf < 0; ++i)
+  {
+    btQuantizedBvhNode node;
+    memcpy(&node, &m_buffer[nodesOffset + i * sizeof(btQuantizedBvhNode)], sizeof(node));
+    if (node.isLeafNode())
+      leaf = i;
+  }
+  CPPUNIT_ASSERT(leaf >= 0);
+  const int leafIndexOffset = nodesOffset + leaf * sizeof(btQuantizedBvhNode) + offsetof(btQuantizedBvhNode, m_escapeIndexOrTriangleIndex);
+  const int rootIndexOffset = nodesOffset + offsetof(btQuantizedBvhNode, m_escapeIndexOrTriangleIndex);
+  const int invalidValues[2][2] = { { leafIndexOffset, numTriangles }, { rootIndexOffset, -numNodes - 1 } };
+  for (int i = 0; i < 2; ++i)
+  {
+    corrupt.copyFromArray(m_buffer);
+    memcpy(&corrupt[invalidValues[i][0]], &invalidValues[i][1], sizeof(int));
+    CPPUNIT_ASSERT(corruptCache.loadFromMemory(&corrupt[0], corrupt.size()));
+    CPPUNIT_ASSERT(corruptCache.createTriangleMeshShape(entry) == 0);
+  }
+}
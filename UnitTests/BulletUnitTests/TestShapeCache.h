@@ -0,0 +1,49 @@
+#ifndef TESTSHAPECACHE_H
+#define TESTSHAPECACHE_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <LinearMath/btAlignedObjectArray.h>
+#include <LinearMath/btVector3.h>
+
+class btCollisionShape;
+
+class TestShapeCache : public CppUnit::TestFixture
+{
+  public:
+
+    void setUp();
+    void tearDown();
+
+    void testConvexHullRoundTrip();
+    void testTriangleMeshRoundTrip();
+    void testTruncatedCacheIsRejected();
+    void testCorruptBvhIsRejected();
+
+    CPPUNIT_TEST_SUITE(TestShapeCache);
+    CPPUNIT_TEST(testConvexHullRoundTrip);
+    CPPUNIT_TEST(testTriangleMeshRoundTrip);
+    CPPUNIT_TEST(testTruncatedCacheIsRejected);
+    CPPUNIT_TEST(testCorruptBvhIsRejected);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    /**
+     * Cooks the box hull and the grid mesh into m_buffer.
+     */
+    void cook();
+
+    /**
+     * Returns the fraction of the closest hit of a ray against the triangles
+     * of shape, or 1 when the ray misses.
+     */
+    btScalar raycast(btCollisionShape* shape, const btVector3& from, const btVector3& to) const;
+
+  private:
+    btAlignedObjectArray<btVector3> m_hullPoints;
+    btAlignedObjectArray<btVector3> m_vertices;
+    btAlignedObjectArray<int> m_indices;
+    btAlignedObjectArray<char> m_buffer;
+};
+
+#endif // TESTSHAPECACHE_H
@@ -0,0 +1,222 @@
+#include "TestTransformStream.h"
+#include "btBulletCollisionCommon.h"
+#include "BulletDynamics/Dynamics/btTransformStream.h"
+
+namespace
+{
+  const int NUM_OBJECTS = 200;
+  const btScalar POSITION_TOLERANCE = btScalar(0.001);
+  const btScalar BASIS_TOLERANCE = btScalar(0.005);
+}
+
+void TestTransformStream::setUp()
+{
+  m_collisionConfiguration = new btDefaultCollisionConfiguration();
+  m_dispatcher = new btCollisionDispatcher(m_collisionConfiguration);
+  m_shape = new btSphereShape(btScalar(0.5));
+  m_seed = 12345;
+}
+
+void TestTransformStream::tearDown()
+{
+  delete m_shape;
+  delete m_dispatcher;
+  delete m_collisionConfiguration;
+}
+
+btScalar TestTransformStream::random()
+{
+  // A small linear congruential generator, so the test does not depend on
+  // the rand() of the platform.
+  m_seed = m_seed * 1664525u + 1013904223u;
+  return btScalar(m_seed >> 8) / btScalar(1 << 24);
+}
+
+btCollisionWorld* TestTransformStream::createWorld(int numObjects)
+{
+  btBroadphaseInterface* broadphase = new btDbvtBroadphase();
+  btCollisionWorld* world = new btCollisionWorld(m_dispatcher, broadphase, m_collisionConfiguration);
+  for (int i = 0; i < numObjects; ++i)
+  {
+    btTransform transform;
+    transform.setOrigin(btVector3(random() * 800 - 400, random() * 100, random() * 800 - 400));
+    transform.setRotation(btQuaternion(btVector3(random() - btScalar(0.5), random() - btScalar(0.5), random()).normalized(), random() * SIMD_2_PI));
+    btCollisionObject* object = new btCollisionObject();
+    object->setCollisionShape(m_shape);
+    object->setWorldTransform(transform);
+    world->addCollisionObject(object);
+  }
+  return world;
+}
+
+void TestTransformStream::destroyWorld(btCollisionWorld* world)
+{
+  for (int i = world->getNumCollisionObjects() - 1; i >= 0; --i)
+  {
+    btCollisionObject* object = world->getCollisionObjectArray()[i];
+    world->removeCollisionObject(object);
+    delete object;
+  }
+  btBroadphaseInterface* broadphase = world->getBroadphase();
+  delete world;
+  delete broadphase;
+}
+
+void TestTransformStream::moveObjects(btCollisionWorld* world, int stride)
+{
+  for (int i = 0; i < world->getNumCollisionObjects(); i += stride)
+  {
+    btCollisionObject* object = world->getCollisionObjectArray()[i];
+    btTransform& transform = object->getWorldTransform();
+    transform.getOrigin() += btVector3(random() - btScalar(0.5), random() - btScalar(0.5), random() - btScalar(0.5)) * btScalar(0.1);
+    transform.setRotation(transform.getRotation() * btQuaternion(btVector3(0, 1, 0), random() * btScalar(0.05)));
+  }
+}
+
+bool TestTransformStream::equal(const btReplicationFrame& a, const btReplicationFrame& b) const
+{
+  if (a.getFrameId() != b.getFrameId() || a.getNumObjects() != b.getNumObjects())
+    return false;
+  for (int i = 0; i < a.getNumObjects(); ++i)
+    if (a.getTransform(i) != b.getTransform(i))
+      return false;
+  return true;
+}
+
+bool TestTransformStream::close(const btTransform& a, const btTransform& b) const
+{
+  if ((a.getOrigin() - b.getOrigin()).length() > POSITION_TOLERANCE)
+    return false;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      if (btFabs(a.getBasis()[i][j] - b.getBasis()[i][j]) > BASIS_TOLERANCE)
+        return false;
+  return true;
+}
+
+void TestTransformStream::testQuantizeRoundTrip()
+{
+  const btTransformQuantization quantization;
+  for (int i = 0; i < 1000; ++i)
+  {
+    btTransform transform;
+    transform.setOrigin(btVector3(random() * 1000 - 500, random() * 1000 - 500, random() * 1000 - 500));
+    transform.setRotation(btQuaternion(btVector3(random() - btScalar(0.5), random() - btScalar(0.5), random() - btScalar(0.5)).normalized(), random() * SIMD_2_PI));
+    btQuantizedTransform quantized;
+    quantization.quantize(transform, quantized);
+    btTransform decoded;
+    quantization.dequantize(quantized, decoded);
+    CPPUNIT_ASSERT(close(transform, decoded));
+  }
+}
+
+void TestTransformStream::testDeltaRoundTrip()
+{
+  btCollisionWorld* sender = createWorld(NUM_OBJECTS);
+  btCollisionWorld* receiver = createWorld(NUM_OBJECTS);
+  btTransformStreamEncoder encoder;
+  btTransformStreamDecoder decoder;
+
+  // The first frame goes against the empty baseline, later ones against the
+  // frame the receiver has.
+  const btReplicationFrame empty;
+  btReplicationFrame received;
+  btAlignedObjectArray<unsigned char> stream;
+  encoder.capture(sender);
+  encoder.writeDelta(empty, stream);
+  CPPUNIT_ASSERT(decoder.readDelta(empty, &stream[0], stream.size(), received));
+  CPPUNIT_ASSERT(equal(encoder.getCurrentFrame(), received));
+
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    moveObjects(sender, 3);
+    const btReplicationFrame baseline = received;
+    encoder.capture(sender);
+    stream.resize(0);
+    encoder.writeDelta(baseline, stream);
+    CPPUNIT_ASSERT_EQUAL(encoder.getCurrentFrame().getFrameId(), decoder.getDeltaFrameId(&stream[0], stream.size()));
+    CPPUNIT_ASSERT(decoder.readDelta(baseline, &stream[0], stream.size(), received));
+    CPPUNIT_ASSERT(equal(encoder.getCurrentFrame(), received));
+  }
+
+  decoder.apply(received, receiver);
+  for (int i = 0; i < NUM_OBJECTS; ++i)
+    CPPUNIT_ASSERT(close(sender->getCollisionObjectArray()[i]->getWorldTransform(), receiver->getCollisionObjectArray()[i]->getWorldTransform()));
+
+  destroyWorld(receiver);
+  destroyWorld(sender);
+}
+
+void TestTransformStream::testUnchangedObjectsAreNotSent()
+{
+  btCollisionWorld* sender = createWorld(NUM_OBJECTS);
+  btTransformStreamEncoder encoder;
+  btTransformStreamDecoder decoder;
+
+  const btReplicationFrame empty;
+  btAlignedObjectArray<unsigned char> full;
+  encoder.capture(sender);
+  encoder.writeDelta(empty, full);
+  btReplicationFrame received;
+  CPPUNIT_ASSERT(decoder.readDelta(empty, &full[0], full.size(), received));
+
+  // Nothing moved, the delta is only the header.
+  btAlignedObjectArray<unsigned char> delta;
+  encoder.capture(sender);
+  CPPUNIT_ASSERT_EQUAL(0, encoder.getNumDirty());
+  encoder.writeDelta(received, delta);
+  CPPUNIT_ASSERT_EQUAL(16, delta.size());
+
+  // One object in ten moved a little.
+  moveObjects(sender, 10);
+  encoder.capture(sender);
+  CPPUNIT_ASSERT_EQUAL(NUM_OBJECTS / 10, encoder.getNumDirty());
+  delta.resize(0);
+  encoder.writeDelta(received, delta);
+  CPPUNIT_ASSERT(delta.size() * 10 < full.size());
+  const btReplicationFrame baseline = received;
+  CPPUNIT_ASSERT(decoder.readDelta(baseline, &delta[0], delta.size(), received));
+  CPPUNIT_ASSERT(equal(encoder.getCurrentFrame(), received));
+  for (int i = 0; i < NUM_OBJECTS; ++i)
+    CPPUNIT_ASSERT_EQUAL(i % 10 == 0, received.hasChangedSince(i, baseline.getFrameId()));
+
+  destroyWorld(sender);
+}
+
+void TestTransformStream::testCorruptStreamIsRejected()
+{
+  btCollisionWorld* sender = createWorld(NUM_OBJECTS);
+  btTransformStreamEncoder encoder;
+  btTransformStreamDecoder decoder;
+
+  const btReplicationFrame empty;
+  btAlignedObjectArray<unsigned char> stream;
+  encoder.capture(sender);
+  encoder.writeDelta(empty, stream);
+  btReplicationFrame received;
+  CPPUNIT_ASSERT(decoder.readDelta(empty, &stream[0], stream.size(), received));
+
+  moveObjects(sender, 2);
+  encoder.capture(sender);
+  btAlignedObjectArray<unsigned char> delta;
+  encoder.writeDelta(received, delta);
+
+  // A truncated delta, a delta read against the wrong baseline and a header
+  // claiming more objects than the stream can hold all fail and leave the
+  // frame unchanged.
+  btReplicationFrame frame = received;
+  CPPUNIT_ASSERT(!decoder.readDelta(received, &delta[0], delta.size() / 2, frame));
+  CPPUNIT_ASSERT(!decoder.readDelta(empty, &delta[0], delta.size(), frame));
+  CPPUNIT_ASSERT(!decoder.readDelta(received, &delta[0], 8, frame));
+  btAlignedObjectArray<unsigned char> corrupt;
+  corrupt.copyFromArray(delta);
+  corrupt[8] = corrupt[9] = corrupt[10] = 0xff;
+  corrupt[11] = 0x7f;
+  CPPUNIT_ASSERT(!decoder.readDelta(received, &corrupt[0], corrupt.size(), frame));
+  CPPUNIT_ASSERT(equal(received, frame));
+
+  CPPUNIT_ASSERT(decoder.readDelta(received, &delta[0], delta.size(), frame));
+  CPPUNIT_ASSERT(equal(encoder.getCurrentFrame(), frame));
+
+  destroyWorld(sender);
+}
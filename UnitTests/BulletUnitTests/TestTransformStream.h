@@ -0,0 +1,68 @@
+#ifndef TESTTRANSFORMSTREAM_H
+#define TESTTRANSFORMSTREAM_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <LinearMath/btAlignedObjectArray.h>
+#include <LinearMath/btTransform.h>
+
+class btDefaultCollisionConfiguration;
+class btCollisionDispatcher;
+class btCollisionWorld;
+class btCollisionShape;
+class btReplicationFrame;
+
+class TestTransformStream : public CppUnit::TestFixture
+{
+  public:
+
+    void setUp();
+    void tearDown();
+
+    void testQuantizeRoundTrip();
+    void testDeltaRoundTrip();
+    void testUnchangedObjectsAreNotSent();
+    void testCorruptStreamIsRejected();
+
+    CPPUNIT_TEST_SUITE(TestTransformStream);
+    CPPUNIT_TEST(testQuantizeRoundTrip);
+    CPPUNIT_TEST(testDeltaRoundTrip);
+    CPPUNIT_TEST(testUnchangedObjectsAreNotSent);
+    CPPUNIT_TEST(testCorruptStreamIsRejected);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    /**
+     * Creates a collision world with numObjects objects at pseudo random
+     * transforms.
+     */
+    btCollisionWorld* createWorld(int numObjects);
+    void destroyWorld(btCollisionWorld* world);
+
+    /**
+     * Moves every stride-th object of the world by a small pseudo random
+     * offset and rotation.
+     */
+    void moveObjects(btCollisionWorld* world, int stride);
+
+    /**
+     * Returns TRUE if both frames hold the same quantized transforms.
+     */
+    bool equal(const btReplicationFrame& a, const btReplicationFrame& b) const;
+
+    /**
+     * Returns TRUE if both transforms are within the quantization error of
+     * the default btTransformQuantization.
+     */
+    bool close(const btTransform& a, const btTransform& b) const;
+
+    btScalar random();
+
+  private:
+    btDefaultCollisionConfiguration* m_collisionConfiguration;
+    btCollisionDispatcher* m_dispatcher;
+    btCollisionShape* m_shape;
+    unsigned int m_seed;
+};
+
+#endif // TESTTRANSFORMSTREAM_H
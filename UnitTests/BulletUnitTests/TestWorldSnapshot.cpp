@@ -0,0 +1,250 @@
+#include "TestWorldSnapshot.h"
+#include "btBulletDynamicsCommon.h"
+#include "BulletDynamics/Dynamics/btWorldSnapshot.h"
+
+#include <string.h>
+
+namespace
+{
+  const btScalar TIME_STEP = btScalar(1.) / btScalar(60.);
+  const int SETTLE_STEPS = 40;
+  const int COMPARE_STEPS = 8;
+
+  unsigned int hashBytes(unsigned int hash, const void* data, int size)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (int i = 0; i < size; ++i)
+    {
+      hash ^= bytes[i];
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+}
+
+void TestWorldSnapshot::setUp()
+{
+  m_collisionConfiguration = 0;
+  m_dispatcher = 0;
+  m_broadphase = 0;
+  m_solver = 0;
+  m_world = 0;
+}
+
+void TestWorldSnapshot::tearDown()
+{
+  destroyWorld();
+}
+
+void TestWorldSnapshot::createWorld(int numBodies, bool axisSweep)
+{
+  m_collisionConfiguration = new btDefaultCollisionConfiguration();
+  m_dispatcher = new btCollisionDispatcher(m_collisionConfiguration);
+  if (axisSweep)
+    m_broadphase = new btAxisSweep3(btVector3(-200,-20,-200), btVector3(200,200,200), numBodies + 16);
+  else
+    m_broadphase = new btDbvtBroadphase();
+  m_solver = new btSequentialImpulseConstraintSolver();
+  m_world = new btDiscreteDynamicsWorld(m_dispatcher, m_broadphase, m_solver, m_collisionConfiguration);
+  m_world->setGravity(btVector3(0, -10, 0));
+
+  btCollisionShape* groundShape = new btBoxShape(btVector3(100, 1, 100));
+  btCollisionShape* boxShape = new btBoxShape(btVector3(btScalar(0.5), btScalar(0.5), btScalar(0.5)));
+  btCollisionShape* sphereShape = new btSphereShape(btScalar(0.5));
+  m_shapes.push_back(groundShape);
+  m_shapes.push_back(boxShape);
+  m_shapes.push_back(sphereShape);
+
+  btTransform transform;
+  transform.setIdentity();
+  transform.setOrigin(btVector3(0, -1, 0));
+  btRigidBody::btRigidBodyConstructionInfo groundInfo(0, 0, groundShape);
+  groundInfo.m_startWorldTransform = transform;
+  m_world->addRigidBody(new btRigidBody(groundInfo));
+
+  const int side = int(btSqrt(btScalar(numBodies / 4))) + 1;
+  for (int i = 0; i < numBodies; ++i)
+  {
+    btCollisionShape* shape = (i & 1) ? sphereShape : boxShape;
+    btVector3 localInertia(0, 0, 0);
+    shape->calculateLocalInertia(1, localInertia);
+    const int layer = i / (side * side);
+    const int row = (i / side) % side;
+    const int column = i % side;
+    transform.setOrigin(btVector3(btScalar(column - side / 2) * btScalar(1.1) + btScalar(0.05) * btScalar(layer & 1),
+      btScalar(0.6) + btScalar(layer) * btScalar(1.2),
+      btScalar(row - side / 2) * btScalar(1.1)));
+    btRigidBody::btRigidBodyConstructionInfo info(1, 0, shape, localInertia);
+    info.m_startWorldTransform = transform;
+    m_world->addRigidBody(new btRigidBody(info));
+  }
+}
+
+void TestWorldSnapshot::destroyWorld()
+{
+  if (m_world)
+  {
+    for (int i = m_world->getNumCollisionObjects() - 1; i >= 0; --i)
+    {
+      btCollisionObject* object = m_world->getCollisionObjectArray()[i];
+      m_world->removeCollisionObject(object);
+      delete object;
+    }
+  }
+  for (int i = 0; i < m_shapes.size(); ++i)
+    delete m_shapes[i];
+  m_shapes.clear();
+  delete m_world;
+  delete m_solver;
+  delete m_broadphase;
+  delete m_dispatcher;
+  delete m_collisionConfiguration;
+  setUp();
+}
+
+unsigned int TestWorldSnapshot::hashWorld() const
+{
+  unsigned int hash = 2166136261u;
+  for (int i = 0; i < m_world->getNumCollisionObjects(); ++i)
+  {
+    const btRigidBody* body = btRigidBody::upcast(m_world->getCollisionObjectArray()[i]);
+    if (!body)
+      continue;
+    hash = hashBytes(hash, &body->getWorldTransform(), sizeof(btTransform));
+    hash = hashBytes(hash, &body->getLinearVelocity(), sizeof(btVector3));
+    hash = hashBytes(hash, &body->getAngularVelocity(), sizeof(btVector3));
+  }
+  return hash;
+}
+
+void TestWorldSnapshot::stepAndHash(int numSteps, btAlignedObjectArray<unsigned int>& hashes)
+{
+  hashes.resize(0);
+  for (int i = 0; i < numSteps; ++i)
+  {
+    m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+    hashes.push_back(hashWorld());
+  }
+}
+
+void TestWorldSnapshot::checkRestoreIsBitExact(bool axisSweep)
+{
+  createWorld(500, axisSweep);
+  for (int i = 0; i < SETTLE_STEPS; ++i)
+    m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+
+  btWorldSnapshot snapshot;
+  snapshot.capture(m_world);
+  CPPUNIT_ASSERT(snapshot.getNumManifolds() > 0);
+  btAlignedObjectArray<unsigned int> reference;
+  stepAndHash(COMPARE_STEPS, reference);
+
+  // Restoring twice checks that a restore leaves the world in a state that
+  // restores as well as a freshly stepped one.
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    CPPUNIT_ASSERT(snapshot.restore(m_world));
+    btAlignedObjectArray<unsigned int> hashes;
+    stepAndHash(COMPARE_STEPS, hashes);
+    for (int i = 0; i < COMPARE_STEPS; ++i)
+      CPPUNIT_ASSERT_EQUAL(reference[i], hashes[i]);
+  }
+}
+
+void TestWorldSnapshot::testRestoreIsBitExactDbvt()
+{
+  checkRestoreIsBitExact(false);
+}
+
+void TestWorldSnapshot::testRestoreIsBitExactAxisSweep()
+{
+  checkRestoreIsBitExact(true);
+}
+
+void TestWorldSnapshot::testRestoreRecreatesRemovedPairs()
+{
+  createWorld(300, false);
+  for (int i = 0; i < SETTLE_STEPS; ++i)
+    m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+
+  btWorldSnapshot snapshot;
+  snapshot.capture(m_world);
+  btAlignedObjectArray<unsigned int> reference;
+  stepAndHash(COMPARE_STEPS, reference);
+
+  // Removing the pairs of the ground releases the manifolds of all resting
+  // bodies, restore has to create them again.
+  btCollisionObject* ground = m_world->getCollisionObjectArray()[0];
+  m_broadphase->getOverlappingPairCache()->removeOverlappingPairsContainingProxy(ground->getBroadphaseHandle(), m_dispatcher);
+  const int manifoldsLeft = m_dispatcher->getNumManifolds();
+  CPPUNIT_ASSERT(manifoldsLeft < snapshot.getNumManifolds());
+
+  CPPUNIT_ASSERT(snapshot.restore(m_world));
+  CPPUNIT_ASSERT_EQUAL(snapshot.getNumManifolds(), m_dispatcher->getNumManifolds());
+  CPPUNIT_ASSERT_EQUAL(snapshot.getNumPairs(), m_broadphase->getOverlappingPairCache()->getNumOverlappingPairs());
+  btAlignedObjectArray<unsigned int> hashes;
+  stepAndHash(COMPARE_STEPS, hashes);
+  for (int i = 0; i < COMPARE_STEPS; ++i)
+    CPPUNIT_ASSERT_EQUAL(reference[i], hashes[i]);
+}
+
+void TestWorldSnapshot::testRestoreRejectsOtherObjects()
+{
+  createWorld(100, false);
+  for (int i = 0; i < SETTLE_STEPS; ++i)
+    m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+
+  btWorldSnapshot snapshot;
+  snapshot.capture(m_world);
+  m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+
+  // Replacing the last body keeps the number of objects, but the snapshot
+  // no longer matches the world and restore must not touch it.
+  btCollisionObject* last = m_world->getCollisionObjectArray()[m_world->getNumCollisionObjects() - 1];
+  btRigidBody* replacement = new btRigidBody(1, 0, last->getCollisionShape(), btVector3(1, 1, 1));
+  replacement->setWorldTransform(last->getWorldTransform());
+  m_world->removeCollisionObject(last);
+  delete last;
+  m_world->addRigidBody(replacement);
+  CPPUNIT_ASSERT_EQUAL(snapshot.getNumObjects(), m_world->getNumCollisionObjects());
+
+  const unsigned int hash = hashWorld();
+  CPPUNIT_ASSERT(!snapshot.restore(m_world));
+  CPPUNIT_ASSERT_EQUAL(hash, hashWorld());
+
+  snapshot.capture(m_world);
+  CPPUNIT_ASSERT(snapshot.restore(m_world));
+}
+
+void TestWorldSnapshot::testCorruptBroadphaseStateIsRejected()
+{
+  createWorld(100, false);
+  for (int i = 0; i < SETTLE_STEPS; ++i)
+    m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+
+  btAlignedObjectArray<unsigned char> state;
+  m_broadphase->captureState(state);
+  CPPUNIT_ASSERT(state.size() > 0);
+  m_world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+  btAlignedObjectArray<unsigned char> before;
+  m_broadphase->captureState(before);
+
+  // A truncated state, a state with an invalid stage and a state with an
+  // extra byte are all rejected without changing the broadphase.
+  CPPUNIT_ASSERT(!m_broadphase->restoreState(&state[0], state.size() - 1));
+  btAlignedObjectArray<unsigned char> corrupt;
+  corrupt.resize(state.size() + 1);
+  memcpy(&corrupt[0], &state[0], state.size());
+  corrupt[state.size()] = 0;
+  CPPUNIT_ASSERT(!m_broadphase->restoreState(&corrupt[0], corrupt.size()));
+  const int invalidStage = 1000;
+  memcpy(&corrupt[sizeof(int)], &invalidStage, sizeof(int));
+  CPPUNIT_ASSERT(!m_broadphase->restoreState(&corrupt[0], state.size()));
+
+  btAlignedObjectArray<unsigned char> after;
+  m_broadphase->captureState(after);
+  CPPUNIT_ASSERT_EQUAL(before.size(), after.size());
+  CPPUNIT_ASSERT(memcmp(&before[0], &after[0], before.size()) == 0);
+
+  CPPUNIT_ASSERT(m_broadphase->restoreState(&state[0], state.size()));
+}
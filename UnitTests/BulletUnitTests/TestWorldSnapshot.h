@@ -0,0 +1,69 @@
+#ifndef TESTWORLDSNAPSHOT_H
+#define TESTWORLDSNAPSHOT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <LinearMath/btAlignedObjectArray.h>
+
+class btDefaultCollisionConfiguration;
+class btCollisionDispatcher;
+class btBroadphaseInterface;
+class btSequentialImpulseConstraintSolver;
+class btDiscreteDynamicsWorld;
+class btCollisionShape;
+
+class TestWorldSnapshot : public CppUnit::TestFixture
+{
+  public:
+
+    void setUp();
+    void tearDown();
+
+    void testRestoreIsBitExactDbvt();
+    void testRestoreIsBitExactAxisSweep();
+    void testRestoreRecreatesRemovedPairs();
+    void testRestoreRejectsOtherObjects();
+    void testCorruptBroadphaseStateIsRejected();
+
+    CPPUNIT_TEST_SUITE(TestWorldSnapshot);
+    CPPUNIT_TEST(testRestoreIsBitExactDbvt);
+    CPPUNIT_TEST(testRestoreIsBitExactAxisSweep);
+    CPPUNIT_TEST(testRestoreRecreatesRemovedPairs);
+    CPPUNIT_TEST(testRestoreRejectsOtherObjects);
+    CPPUNIT_TEST(testCorruptBroadphaseStateIsRejected);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    /**
+     * Creates a world with a ground box and numBodies boxes and spheres
+     * dropped in a grid above it.
+     *
+     * @param numBodies - the number of dynamic bodies.
+     * @param axisSweep - use btAxisSweep3 instead of btDbvtBroadphase.
+     */
+    void createWorld(int numBodies, bool axisSweep);
+    void destroyWorld();
+
+    /**
+     * Returns a hash of the bits of the transforms and velocities of all
+     * rigid bodies.
+     */
+    unsigned int hashWorld() const;
+
+    /**
+     * Steps the world numSteps times and stores the hash after each step.
+     */
+    void stepAndHash(int numSteps, btAlignedObjectArray<unsigned int>& hashes);
+
+    void checkRestoreIsBitExact(bool axisSweep);
+
+  private:
+    btDefaultCollisionConfiguration* m_collisionConfiguration;
+    btCollisionDispatcher* m_dispatcher;
+    btBroadphaseInterface* m_broadphase;
+    btSequentialImpulseConstraintSolver* m_solver;
+    btDiscreteDynamicsWorld* m_world;
+    btAlignedObjectArray<btCollisionShape*> m_shapes;
+};
+
+#endif // TESTWORLDSNAPSHOT_H
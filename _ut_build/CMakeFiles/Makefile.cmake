@@ -0,0 +1,110 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/BulletConfig.cmake.in"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Extras/CMakeLists.txt"
+  "/root/repo/Extras/ConvexDecomposition/CMakeLists.txt"
+  "/root/repo/Extras/GIMPACTUtils/CMakeLists.txt"
+  "/root/repo/Extras/HACD/CMakeLists.txt"
+  "/root/repo/Extras/Serialize/BulletFileLoader/CMakeLists.txt"
+  "/root/repo/Extras/Serialize/BulletWorldImporter/CMakeLists.txt"
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/CMakeLists.txt"
+  "/root/repo/Extras/Serialize/CMakeLists.txt"
+  "/root/repo/Extras/ShapeCooking/CMakeLists.txt"
+  "/root/repo/Extras/glui/CMakeLists.txt"
+  "/root/repo/UnitTests/BulletUnitTests/CMakeLists.txt"
+  "/root/repo/UnitTests/CMakeLists.txt"
+  "/root/repo/UnitTests/cppunit/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bullet.pc.cmake"
+  "/root/repo/src/BulletCollision/CMakeLists.txt"
+  "/root/repo/src/BulletDynamics/CMakeLists.txt"
+  "/root/repo/src/BulletSoftBody/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/LinearMath/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGLU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGLUT.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "bullet.pc"
+  "BulletConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/Serialize/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/ConvexDecomposition/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/HACD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/GIMPACTUtils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/ShapeCooking/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/glui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/Serialize/BulletFileLoader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Extras/Serialize/BulletWorldImporter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/BulletSoftBody/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/BulletCollision/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/BulletDynamics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/LinearMath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/cppunit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "UnitTests/BulletUnitTests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/DependInfo.cmake"
+  "Extras/HACD/CMakeFiles/HACD.dir/DependInfo.cmake"
+  "Extras/GIMPACTUtils/CMakeFiles/GIMPACTUtils.dir/DependInfo.cmake"
+  "Extras/ShapeCooking/CMakeFiles/ShapeCooking.dir/DependInfo.cmake"
+  "Extras/ShapeCooking/CMakeFiles/bullet_cook.dir/DependInfo.cmake"
+  "Extras/glui/CMakeFiles/GLUI.dir/DependInfo.cmake"
+  "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/DependInfo.cmake"
+  "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/DependInfo.cmake"
+  "Extras/Serialize/BulletWorldImporter/CMakeFiles/BulletWorldImporter.dir/DependInfo.cmake"
+  "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/DependInfo.cmake"
+  "src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  "UnitTests/cppunit/CMakeFiles/cppunit.dir/DependInfo.cmake"
+  "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Demos/AllBulletDemos/DemoEntries.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/DemoEntries.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/DemoEntries.o.d"
+  "/root/repo/Demos/AllBulletDemos/Main.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/Main.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/Main.o.d"
+  "/root/repo/Demos/BasicDemo/BasicDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BasicDemo/BasicDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BasicDemo/BasicDemo.o.d"
+  "/root/repo/Demos/Benchmarks/BenchmarkDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/Benchmarks/BenchmarkDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/Benchmarks/BenchmarkDemo.o.d"
+  "/root/repo/Demos/Box2dDemo/Box2dDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/Box2dDemo/Box2dDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/Box2dDemo/Box2dDemo.o.d"
+  "/root/repo/Demos/BspDemo/BspConverter.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspConverter.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspConverter.o.d"
+  "/root/repo/Demos/BspDemo/BspDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspDemo.o.d"
+  "/root/repo/Demos/BspDemo/BspLoader.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspLoader.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspLoader.o.d"
+  "/root/repo/Demos/CcdPhysicsDemo/CcdPhysicsDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/CcdPhysicsDemo/CcdPhysicsDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/CcdPhysicsDemo/CcdPhysicsDemo.o.d"
+  "/root/repo/Demos/ConcaveConvexcastDemo/ConcaveConvexcastDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConcaveConvexcastDemo/ConcaveConvexcastDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConcaveConvexcastDemo/ConcaveConvexcastDemo.o.d"
+  "/root/repo/Demos/ConcaveDemo/ConcavePhysicsDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConcaveDemo/ConcavePhysicsDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConcaveDemo/ConcavePhysicsDemo.o.d"
+  "/root/repo/Demos/ConcaveRaycastDemo/ConcaveRaycastDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConcaveRaycastDemo/ConcaveRaycastDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConcaveRaycastDemo/ConcaveRaycastDemo.o.d"
+  "/root/repo/Demos/ConstraintDemo/ConstraintDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConstraintDemo/ConstraintDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConstraintDemo/ConstraintDemo.o.d"
+  "/root/repo/Demos/ConvexDecompositionDemo/ConvexDecompositionDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConvexDecompositionDemo/ConvexDecompositionDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ConvexDecompositionDemo/ConvexDecompositionDemo.o.d"
+  "/root/repo/Demos/DynamicControlDemo/MotorDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/DynamicControlDemo/MotorDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/DynamicControlDemo/MotorDemo.o.d"
+  "/root/repo/Demos/ForkLiftDemo/ForkLiftDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ForkLiftDemo/ForkLiftDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/ForkLiftDemo/ForkLiftDemo.o.d"
+  "/root/repo/Demos/GimpactTestDemo/GimpactTestDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/GimpactTestDemo/GimpactTestDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/GimpactTestDemo/GimpactTestDemo.o.d"
+  "/root/repo/Demos/GjkConvexCastDemo/LinearConvexCastDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/GjkConvexCastDemo/LinearConvexCastDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/GjkConvexCastDemo/LinearConvexCastDemo.o.d"
+  "/root/repo/Demos/RagdollDemo/RagdollDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/RagdollDemo/RagdollDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/RagdollDemo/RagdollDemo.o.d"
+  "/root/repo/Demos/Raytracer/Raytracer.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/Raytracer/Raytracer.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/Raytracer/Raytracer.o.d"
+  "/root/repo/Demos/SliderConstraintDemo/SliderConstraintDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/SliderConstraintDemo/SliderConstraintDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/SliderConstraintDemo/SliderConstraintDemo.o.d"
+  "/root/repo/Demos/SoftDemo/SoftDemo.cpp" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/SoftDemo/SoftDemo.o" "gcc" "Demos/AllBulletDemos/CMakeFiles/AppAllBulletDemos.dir/__/SoftDemo/SoftDemo.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/Extras/glui/CMakeFiles/GLUI.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/GIMPACTUtils/CMakeFiles/GIMPACTUtils.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/HACD/CMakeFiles/HACD.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/Serialize/BulletWorldImporter/CMakeFiles/BulletWorldImporter.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "AppAllBulletDemos"
+  "AppAllBulletDemos.pdb"
+  "CMakeFiles/AppAllBulletDemos.dir/DemoEntries.o"
+  "CMakeFiles/AppAllBulletDemos.dir/DemoEntries.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/Main.o"
+  "CMakeFiles/AppAllBulletDemos.dir/Main.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BasicDemo/BasicDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BasicDemo/BasicDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/Benchmarks/BenchmarkDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/Benchmarks/BenchmarkDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/Box2dDemo/Box2dDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/Box2dDemo/Box2dDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspConverter.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspConverter.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspLoader.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/BspDemo/BspLoader.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/CcdPhysicsDemo/CcdPhysicsDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/CcdPhysicsDemo/CcdPhysicsDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConcaveConvexcastDemo/ConcaveConvexcastDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConcaveConvexcastDemo/ConcaveConvexcastDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConcaveDemo/ConcavePhysicsDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConcaveDemo/ConcavePhysicsDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConcaveRaycastDemo/ConcaveRaycastDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConcaveRaycastDemo/ConcaveRaycastDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConstraintDemo/ConstraintDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConstraintDemo/ConstraintDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConvexDecompositionDemo/ConvexDecompositionDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ConvexDecompositionDemo/ConvexDecompositionDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/DynamicControlDemo/MotorDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/DynamicControlDemo/MotorDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ForkLiftDemo/ForkLiftDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/ForkLiftDemo/ForkLiftDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/GimpactTestDemo/GimpactTestDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/GimpactTestDemo/GimpactTestDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/GjkConvexCastDemo/LinearConvexCastDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/GjkConvexCastDemo/LinearConvexCastDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/RagdollDemo/RagdollDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/RagdollDemo/RagdollDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/Raytracer/Raytracer.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/Raytracer/Raytracer.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/SliderConstraintDemo/SliderConstraintDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/SliderConstraintDemo/SliderConstraintDemo.o.d"
+  "CMakeFiles/AppAllBulletDemos.dir/__/SoftDemo/SoftDemo.o"
+  "CMakeFiles/AppAllBulletDemos.dir/__/SoftDemo/SoftDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppAllBulletDemos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppBasicDemo"
+  "AppBasicDemo.pdb"
+  "CMakeFiles/AppBasicDemo.dir/BasicDemo.o"
+  "CMakeFiles/AppBasicDemo.dir/BasicDemo.o.d"
+  "CMakeFiles/AppBasicDemo.dir/main.o"
+  "CMakeFiles/AppBasicDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppBasicDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
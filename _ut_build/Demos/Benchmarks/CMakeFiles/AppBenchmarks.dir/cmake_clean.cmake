@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppBenchmarks"
+  "AppBenchmarks.pdb"
+  "CMakeFiles/AppBenchmarks.dir/BenchmarkDemo.o"
+  "CMakeFiles/AppBenchmarks.dir/BenchmarkDemo.o.d"
+  "CMakeFiles/AppBenchmarks.dir/main.o"
+  "CMakeFiles/AppBenchmarks.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppBenchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bullet_bench.dir/BenchmarkDemo.o"
+  "CMakeFiles/bullet_bench.dir/BenchmarkDemo.o.d"
+  "CMakeFiles/bullet_bench.dir/HeadlessBenchmark.o"
+  "CMakeFiles/bullet_bench.dir/HeadlessBenchmark.o.d"
+  "bullet_bench"
+  "bullet_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bullet_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
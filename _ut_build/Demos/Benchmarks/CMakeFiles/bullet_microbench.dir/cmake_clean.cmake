@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bullet_microbench.dir/MicroBenchmark.o"
+  "CMakeFiles/bullet_microbench.dir/MicroBenchmark.o.d"
+  "bullet_microbench"
+  "bullet_microbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bullet_microbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppBox2dDemo"
+  "AppBox2dDemo.pdb"
+  "CMakeFiles/AppBox2dDemo.dir/Box2dDemo.o"
+  "CMakeFiles/AppBox2dDemo.dir/Box2dDemo.o.d"
+  "CMakeFiles/AppBox2dDemo.dir/main.o"
+  "CMakeFiles/AppBox2dDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppBox2dDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
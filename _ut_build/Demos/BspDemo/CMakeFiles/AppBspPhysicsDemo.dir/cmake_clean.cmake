@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "AppBspPhysicsDemo"
+  "AppBspPhysicsDemo.pdb"
+  "CMakeFiles/AppBspPhysicsDemo.dir/BspConverter.o"
+  "CMakeFiles/AppBspPhysicsDemo.dir/BspConverter.o.d"
+  "CMakeFiles/AppBspPhysicsDemo.dir/BspDemo.o"
+  "CMakeFiles/AppBspPhysicsDemo.dir/BspDemo.o.d"
+  "CMakeFiles/AppBspPhysicsDemo.dir/BspLoader.o"
+  "CMakeFiles/AppBspPhysicsDemo.dir/BspLoader.o.d"
+  "CMakeFiles/AppBspPhysicsDemo.dir/main.o"
+  "CMakeFiles/AppBspPhysicsDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppBspPhysicsDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppBulletXmlImportDemo"
+  "AppBulletXmlImportDemo.pdb"
+  "CMakeFiles/AppBulletXmlImportDemo.dir/BulletXmlImportDemo.o"
+  "CMakeFiles/AppBulletXmlImportDemo.dir/BulletXmlImportDemo.o.d"
+  "CMakeFiles/AppBulletXmlImportDemo.dir/main.o"
+  "CMakeFiles/AppBulletXmlImportDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppBulletXmlImportDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppCcdPhysicsDemo"
+  "AppCcdPhysicsDemo.pdb"
+  "CMakeFiles/AppCcdPhysicsDemo.dir/CcdPhysicsDemo.o"
+  "CMakeFiles/AppCcdPhysicsDemo.dir/CcdPhysicsDemo.o.d"
+  "CMakeFiles/AppCcdPhysicsDemo.dir/main.o"
+  "CMakeFiles/AppCcdPhysicsDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppCcdPhysicsDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Demos/CharacterDemo/CharacterDemo.cpp" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/CharacterDemo.o" "gcc" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/CharacterDemo.o.d"
+  "/root/repo/Demos/CharacterDemo/DynamicCharacterController.cpp" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/DynamicCharacterController.o" "gcc" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/DynamicCharacterController.o.d"
+  "/root/repo/Demos/BspDemo/BspConverter.cpp" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspConverter.o" "gcc" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspConverter.o.d"
+  "/root/repo/Demos/BspDemo/BspLoader.cpp" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspLoader.o" "gcc" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspLoader.o.d"
+  "/root/repo/Demos/CharacterDemo/main.cpp" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/main.o" "gcc" "Demos/CharacterDemo/CMakeFiles/AppCharacterDemo.dir/main.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "AppCharacterDemo"
+  "AppCharacterDemo.pdb"
+  "CMakeFiles/AppCharacterDemo.dir/CharacterDemo.o"
+  "CMakeFiles/AppCharacterDemo.dir/CharacterDemo.o.d"
+  "CMakeFiles/AppCharacterDemo.dir/DynamicCharacterController.o"
+  "CMakeFiles/AppCharacterDemo.dir/DynamicCharacterController.o.d"
+  "CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspConverter.o"
+  "CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspConverter.o.d"
+  "CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspLoader.o"
+  "CMakeFiles/AppCharacterDemo.dir/__/BspDemo/BspLoader.o.d"
+  "CMakeFiles/AppCharacterDemo.dir/main.o"
+  "CMakeFiles/AppCharacterDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppCharacterDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
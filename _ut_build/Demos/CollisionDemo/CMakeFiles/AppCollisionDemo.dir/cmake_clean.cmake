@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppCollisionDemo"
+  "AppCollisionDemo.pdb"
+  "CMakeFiles/AppCollisionDemo.dir/CollisionDemo.o"
+  "CMakeFiles/AppCollisionDemo.dir/CollisionDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppCollisionDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
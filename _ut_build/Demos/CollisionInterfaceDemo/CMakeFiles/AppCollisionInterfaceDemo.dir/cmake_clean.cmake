@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppCollisionInterfaceDemo"
+  "AppCollisionInterfaceDemo.pdb"
+  "CMakeFiles/AppCollisionInterfaceDemo.dir/CollisionInterfaceDemo.o"
+  "CMakeFiles/AppCollisionInterfaceDemo.dir/CollisionInterfaceDemo.o.d"
+  "CMakeFiles/AppCollisionInterfaceDemo.dir/main.o"
+  "CMakeFiles/AppCollisionInterfaceDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppCollisionInterfaceDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
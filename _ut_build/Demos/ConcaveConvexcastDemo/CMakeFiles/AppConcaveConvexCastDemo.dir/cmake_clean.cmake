@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppConcaveConvexCastDemo"
+  "AppConcaveConvexCastDemo.pdb"
+  "CMakeFiles/AppConcaveConvexCastDemo.dir/ConcaveConvexcastDemo.o"
+  "CMakeFiles/AppConcaveConvexCastDemo.dir/ConcaveConvexcastDemo.o.d"
+  "CMakeFiles/AppConcaveConvexCastDemo.dir/main.o"
+  "CMakeFiles/AppConcaveConvexCastDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppConcaveConvexCastDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
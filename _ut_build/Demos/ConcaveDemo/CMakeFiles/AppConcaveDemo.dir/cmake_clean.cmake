@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppConcaveDemo"
+  "AppConcaveDemo.pdb"
+  "CMakeFiles/AppConcaveDemo.dir/ConcavePhysicsDemo.o"
+  "CMakeFiles/AppConcaveDemo.dir/ConcavePhysicsDemo.o.d"
+  "CMakeFiles/AppConcaveDemo.dir/main.o"
+  "CMakeFiles/AppConcaveDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppConcaveDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppConcaveRayCastDemo"
+  "AppConcaveRayCastDemo.pdb"
+  "CMakeFiles/AppConcaveRayCastDemo.dir/ConcaveRaycastDemo.o"
+  "CMakeFiles/AppConcaveRayCastDemo.dir/ConcaveRaycastDemo.o.d"
+  "CMakeFiles/AppConcaveRayCastDemo.dir/main.o"
+  "CMakeFiles/AppConcaveRayCastDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppConcaveRayCastDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppConstraintDemo"
+  "AppConstraintDemo.pdb"
+  "CMakeFiles/AppConstraintDemo.dir/ConstraintDemo.o"
+  "CMakeFiles/AppConstraintDemo.dir/ConstraintDemo.o.d"
+  "CMakeFiles/AppConstraintDemo.dir/main.o"
+  "CMakeFiles/AppConstraintDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppConstraintDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
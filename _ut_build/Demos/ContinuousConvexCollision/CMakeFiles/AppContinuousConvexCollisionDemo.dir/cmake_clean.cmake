@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppContinuousConvexCollisionDemo"
+  "AppContinuousConvexCollisionDemo.pdb"
+  "CMakeFiles/AppContinuousConvexCollisionDemo.dir/ContinuousConvexCollisionDemo.o"
+  "CMakeFiles/AppContinuousConvexCollisionDemo.dir/ContinuousConvexCollisionDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppContinuousConvexCollisionDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
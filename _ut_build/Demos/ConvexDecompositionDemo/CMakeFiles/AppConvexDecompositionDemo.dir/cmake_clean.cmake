@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppConvexDecompositionDemo"
+  "AppConvexDecompositionDemo.pdb"
+  "CMakeFiles/AppConvexDecompositionDemo.dir/ConvexDecompositionDemo.o"
+  "CMakeFiles/AppConvexDecompositionDemo.dir/ConvexDecompositionDemo.o.d"
+  "CMakeFiles/AppConvexDecompositionDemo.dir/main.o"
+  "CMakeFiles/AppConvexDecompositionDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppConvexDecompositionDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
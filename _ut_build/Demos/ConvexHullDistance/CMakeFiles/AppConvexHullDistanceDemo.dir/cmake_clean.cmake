@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppConvexHullDistanceDemo"
+  "AppConvexHullDistanceDemo.pdb"
+  "CMakeFiles/AppConvexHullDistanceDemo.dir/ConvexHullDistanceDemo.o"
+  "CMakeFiles/AppConvexHullDistanceDemo.dir/ConvexHullDistanceDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppConvexHullDistanceDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppDoublePrecisionDemo"
+  "AppDoublePrecisionDemo.pdb"
+  "CMakeFiles/AppDoublePrecisionDemo.dir/DoublePrecisionDemo.o"
+  "CMakeFiles/AppDoublePrecisionDemo.dir/DoublePrecisionDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppDoublePrecisionDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
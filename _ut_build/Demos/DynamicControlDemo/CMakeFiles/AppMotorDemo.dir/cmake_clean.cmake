@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppMotorDemo"
+  "AppMotorDemo.pdb"
+  "CMakeFiles/AppMotorDemo.dir/MotorDemo.o"
+  "CMakeFiles/AppMotorDemo.dir/MotorDemo.o.d"
+  "CMakeFiles/AppMotorDemo.dir/main.o"
+  "CMakeFiles/AppMotorDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppMotorDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppFeatherstoneMultiBodyDemo"
+  "AppFeatherstoneMultiBodyDemo.pdb"
+  "CMakeFiles/AppFeatherstoneMultiBodyDemo.dir/FeatherstoneMultiBodyDemo.o"
+  "CMakeFiles/AppFeatherstoneMultiBodyDemo.dir/FeatherstoneMultiBodyDemo.o.d"
+  "CMakeFiles/AppFeatherstoneMultiBodyDemo.dir/main.o"
+  "CMakeFiles/AppFeatherstoneMultiBodyDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppFeatherstoneMultiBodyDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppForkLiftDemo"
+  "AppForkLiftDemo.pdb"
+  "CMakeFiles/AppForkLiftDemo.dir/ForkLiftDemo.o"
+  "CMakeFiles/AppForkLiftDemo.dir/ForkLiftDemo.o.d"
+  "CMakeFiles/AppForkLiftDemo.dir/main.o"
+  "CMakeFiles/AppForkLiftDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppForkLiftDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
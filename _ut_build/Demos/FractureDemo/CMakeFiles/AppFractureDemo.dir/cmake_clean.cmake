@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "AppFractureDemo"
+  "AppFractureDemo.pdb"
+  "CMakeFiles/AppFractureDemo.dir/FractureDemo.o"
+  "CMakeFiles/AppFractureDemo.dir/FractureDemo.o.d"
+  "CMakeFiles/AppFractureDemo.dir/btFractureBody.o"
+  "CMakeFiles/AppFractureDemo.dir/btFractureBody.o.d"
+  "CMakeFiles/AppFractureDemo.dir/btFractureDynamicsWorld.o"
+  "CMakeFiles/AppFractureDemo.dir/btFractureDynamicsWorld.o.d"
+  "CMakeFiles/AppFractureDemo.dir/main.o"
+  "CMakeFiles/AppFractureDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppFractureDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
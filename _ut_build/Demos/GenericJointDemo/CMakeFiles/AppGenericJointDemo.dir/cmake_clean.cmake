@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "AppGenericJointDemo"
+  "AppGenericJointDemo.pdb"
+  "CMakeFiles/AppGenericJointDemo.dir/GenericJointDemo.o"
+  "CMakeFiles/AppGenericJointDemo.dir/GenericJointDemo.o.d"
+  "CMakeFiles/AppGenericJointDemo.dir/Ragdoll.o"
+  "CMakeFiles/AppGenericJointDemo.dir/Ragdoll.o.d"
+  "CMakeFiles/AppGenericJointDemo.dir/main.o"
+  "CMakeFiles/AppGenericJointDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppGenericJointDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppLinearConvexCastDemo"
+  "AppLinearConvexCastDemo.pdb"
+  "CMakeFiles/AppLinearConvexCastDemo.dir/LinearConvexCastDemo.o"
+  "CMakeFiles/AppLinearConvexCastDemo.dir/LinearConvexCastDemo.o.d"
+  "CMakeFiles/AppLinearConvexCastDemo.dir/main.o"
+  "CMakeFiles/AppLinearConvexCastDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppLinearConvexCastDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppGyroscopicDemo"
+  "AppGyroscopicDemo.pdb"
+  "CMakeFiles/AppGyroscopicDemo.dir/GyroscopicDemo.o"
+  "CMakeFiles/AppGyroscopicDemo.dir/GyroscopicDemo.o.d"
+  "CMakeFiles/AppGyroscopicDemo.dir/main.o"
+  "CMakeFiles/AppGyroscopicDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppGyroscopicDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppHelloWorld"
+  "AppHelloWorld.pdb"
+  "CMakeFiles/AppHelloWorld.dir/HelloWorld.o"
+  "CMakeFiles/AppHelloWorld.dir/HelloWorld.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppHelloWorld.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
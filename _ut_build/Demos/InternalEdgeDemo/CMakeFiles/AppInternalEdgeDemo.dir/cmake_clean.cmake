@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppInternalEdgeDemo"
+  "AppInternalEdgeDemo.pdb"
+  "CMakeFiles/AppInternalEdgeDemo.dir/InternalEdgeDemo.o"
+  "CMakeFiles/AppInternalEdgeDemo.dir/InternalEdgeDemo.o.d"
+  "CMakeFiles/AppInternalEdgeDemo.dir/main.o"
+  "CMakeFiles/AppInternalEdgeDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppInternalEdgeDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppMovingConcaveDemo"
+  "AppMovingConcaveDemo.pdb"
+  "CMakeFiles/AppMovingConcaveDemo.dir/ConcavePhysicsDemo.o"
+  "CMakeFiles/AppMovingConcaveDemo.dir/ConcavePhysicsDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppMovingConcaveDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
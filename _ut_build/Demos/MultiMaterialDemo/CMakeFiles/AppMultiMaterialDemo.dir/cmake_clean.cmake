@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppMultiMaterialDemo"
+  "AppMultiMaterialDemo.pdb"
+  "CMakeFiles/AppMultiMaterialDemo.dir/MultiMaterialDemo.o"
+  "CMakeFiles/AppMultiMaterialDemo.dir/MultiMaterialDemo.o.d"
+  "CMakeFiles/AppMultiMaterialDemo.dir/main.o"
+  "CMakeFiles/AppMultiMaterialDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppMultiMaterialDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Demos/OpenGL/DemoApplication.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/DemoApplication.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/DemoApplication.o.d"
+  "/root/repo/Demos/OpenGL/GLDebugDrawer.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GLDebugDrawer.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GLDebugDrawer.o.d"
+  "/root/repo/Demos/OpenGL/GLDebugFont.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GLDebugFont.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GLDebugFont.o.d"
+  "/root/repo/Demos/OpenGL/GL_DialogDynamicsWorld.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_DialogDynamicsWorld.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_DialogDynamicsWorld.o.d"
+  "/root/repo/Demos/OpenGL/GL_DialogWindow.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_DialogWindow.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_DialogWindow.o.d"
+  "/root/repo/Demos/OpenGL/GL_ShapeDrawer.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_ShapeDrawer.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_ShapeDrawer.o.d"
+  "/root/repo/Demos/OpenGL/GL_Simplex1to4.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_Simplex1to4.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GL_Simplex1to4.o.d"
+  "/root/repo/Demos/OpenGL/GlutDemoApplication.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GlutDemoApplication.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GlutDemoApplication.o.d"
+  "/root/repo/Demos/OpenGL/GlutStuff.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GlutStuff.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/GlutStuff.o.d"
+  "/root/repo/Demos/OpenGL/RenderTexture.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/RenderTexture.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/RenderTexture.o.d"
+  "/root/repo/Demos/OpenGL/Win32DemoApplication.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/Win32DemoApplication.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/Win32DemoApplication.o.d"
+  "/root/repo/Demos/OpenGL/stb_image.cpp" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/stb_image.o" "gcc" "Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/stb_image.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
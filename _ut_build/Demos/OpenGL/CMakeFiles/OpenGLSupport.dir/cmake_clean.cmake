@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OpenGLSupport.dir/DemoApplication.o"
+  "CMakeFiles/OpenGLSupport.dir/DemoApplication.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GLDebugDrawer.o"
+  "CMakeFiles/OpenGLSupport.dir/GLDebugDrawer.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GLDebugFont.o"
+  "CMakeFiles/OpenGLSupport.dir/GLDebugFont.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GL_DialogDynamicsWorld.o"
+  "CMakeFiles/OpenGLSupport.dir/GL_DialogDynamicsWorld.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GL_DialogWindow.o"
+  "CMakeFiles/OpenGLSupport.dir/GL_DialogWindow.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GL_ShapeDrawer.o"
+  "CMakeFiles/OpenGLSupport.dir/GL_ShapeDrawer.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GL_Simplex1to4.o"
+  "CMakeFiles/OpenGLSupport.dir/GL_Simplex1to4.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GlutDemoApplication.o"
+  "CMakeFiles/OpenGLSupport.dir/GlutDemoApplication.o.d"
+  "CMakeFiles/OpenGLSupport.dir/GlutStuff.o"
+  "CMakeFiles/OpenGLSupport.dir/GlutStuff.o.d"
+  "CMakeFiles/OpenGLSupport.dir/RenderTexture.o"
+  "CMakeFiles/OpenGLSupport.dir/RenderTexture.o.d"
+  "CMakeFiles/OpenGLSupport.dir/Win32DemoApplication.o"
+  "CMakeFiles/OpenGLSupport.dir/Win32DemoApplication.o.d"
+  "CMakeFiles/OpenGLSupport.dir/stb_image.o"
+  "CMakeFiles/OpenGLSupport.dir/stb_image.o.d"
+  "libOpenGLSupport.a"
+  "libOpenGLSupport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenGLSupport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
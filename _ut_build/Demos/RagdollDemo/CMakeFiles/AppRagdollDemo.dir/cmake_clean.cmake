@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppRagdollDemo"
+  "AppRagdollDemo.pdb"
+  "CMakeFiles/AppRagdollDemo.dir/RagdollDemo.o"
+  "CMakeFiles/AppRagdollDemo.dir/RagdollDemo.o.d"
+  "CMakeFiles/AppRagdollDemo.dir/main.o"
+  "CMakeFiles/AppRagdollDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppRagdollDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppRaytestDemo"
+  "AppRaytestDemo.pdb"
+  "CMakeFiles/AppRaytestDemo.dir/RaytestDemo.o"
+  "CMakeFiles/AppRaytestDemo.dir/RaytestDemo.o.d"
+  "CMakeFiles/AppRaytestDemo.dir/main.o"
+  "CMakeFiles/AppRaytestDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppRaytestDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
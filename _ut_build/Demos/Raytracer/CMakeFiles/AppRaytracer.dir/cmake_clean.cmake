@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppRaytracer"
+  "AppRaytracer.pdb"
+  "CMakeFiles/AppRaytracer.dir/Raytracer.o"
+  "CMakeFiles/AppRaytracer.dir/Raytracer.o.d"
+  "CMakeFiles/AppRaytracer.dir/main.o"
+  "CMakeFiles/AppRaytracer.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppRaytracer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
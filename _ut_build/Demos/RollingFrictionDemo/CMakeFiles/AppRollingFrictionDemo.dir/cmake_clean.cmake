@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppRollingFrictionDemo"
+  "AppRollingFrictionDemo.pdb"
+  "CMakeFiles/AppRollingFrictionDemo.dir/RollingFrictionDemo.o"
+  "CMakeFiles/AppRollingFrictionDemo.dir/RollingFrictionDemo.o.d"
+  "CMakeFiles/AppRollingFrictionDemo.dir/main.o"
+  "CMakeFiles/AppRollingFrictionDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppRollingFrictionDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppSerializeDemo"
+  "AppSerializeDemo.pdb"
+  "CMakeFiles/AppSerializeDemo.dir/SerializeDemo.o"
+  "CMakeFiles/AppSerializeDemo.dir/SerializeDemo.o.d"
+  "CMakeFiles/AppSerializeDemo.dir/main.o"
+  "CMakeFiles/AppSerializeDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppSerializeDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppSimplexDemo"
+  "AppSimplexDemo.pdb"
+  "CMakeFiles/AppSimplexDemo.dir/SimplexDemo.o"
+  "CMakeFiles/AppSimplexDemo.dir/SimplexDemo.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppSimplexDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Demos/SliderConstraintDemo/SliderConstraintDemo.cpp" "Demos/SliderConstraintDemo/CMakeFiles/AppSliderConstraintDemo.dir/SliderConstraintDemo.o" "gcc" "Demos/SliderConstraintDemo/CMakeFiles/AppSliderConstraintDemo.dir/SliderConstraintDemo.o.d"
+  "/root/repo/Demos/SliderConstraintDemo/main.cpp" "Demos/SliderConstraintDemo/CMakeFiles/AppSliderConstraintDemo.dir/main.o" "gcc" "Demos/SliderConstraintDemo/CMakeFiles/AppSliderConstraintDemo.dir/main.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/Demos/OpenGL/CMakeFiles/OpenGLSupport.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
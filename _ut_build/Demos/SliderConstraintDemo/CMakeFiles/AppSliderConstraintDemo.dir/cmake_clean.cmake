@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppSliderConstraintDemo"
+  "AppSliderConstraintDemo.pdb"
+  "CMakeFiles/AppSliderConstraintDemo.dir/SliderConstraintDemo.o"
+  "CMakeFiles/AppSliderConstraintDemo.dir/SliderConstraintDemo.o.d"
+  "CMakeFiles/AppSliderConstraintDemo.dir/main.o"
+  "CMakeFiles/AppSliderConstraintDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppSliderConstraintDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
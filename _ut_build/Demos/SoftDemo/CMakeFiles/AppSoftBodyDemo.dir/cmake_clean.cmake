@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppSoftBodyDemo"
+  "AppSoftBodyDemo.pdb"
+  "CMakeFiles/AppSoftBodyDemo.dir/SoftDemo.o"
+  "CMakeFiles/AppSoftBodyDemo.dir/SoftDemo.o.d"
+  "CMakeFiles/AppSoftBodyDemo.dir/main.o"
+  "CMakeFiles/AppSoftBodyDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppSoftBodyDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
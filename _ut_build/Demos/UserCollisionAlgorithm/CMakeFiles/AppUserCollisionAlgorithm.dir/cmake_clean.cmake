@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AppUserCollisionAlgorithm"
+  "AppUserCollisionAlgorithm.pdb"
+  "CMakeFiles/AppUserCollisionAlgorithm.dir/UserCollisionAlgorithm.o"
+  "CMakeFiles/AppUserCollisionAlgorithm.dir/UserCollisionAlgorithm.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppUserCollisionAlgorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
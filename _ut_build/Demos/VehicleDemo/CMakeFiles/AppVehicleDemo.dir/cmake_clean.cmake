@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "AppVehicleDemo"
+  "AppVehicleDemo.pdb"
+  "CMakeFiles/AppVehicleDemo.dir/VehicleDemo.o"
+  "CMakeFiles/AppVehicleDemo.dir/VehicleDemo.o.d"
+  "CMakeFiles/AppVehicleDemo.dir/heightfield128x128.o"
+  "CMakeFiles/AppVehicleDemo.dir/heightfield128x128.o.d"
+  "CMakeFiles/AppVehicleDemo.dir/main.o"
+  "CMakeFiles/AppVehicleDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppVehicleDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
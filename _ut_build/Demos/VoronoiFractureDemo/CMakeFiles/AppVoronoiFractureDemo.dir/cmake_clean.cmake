@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "AppVoronoiFractureDemo"
+  "AppVoronoiFractureDemo.pdb"
+  "CMakeFiles/AppVoronoiFractureDemo.dir/VoronoiFractureDemo.o"
+  "CMakeFiles/AppVoronoiFractureDemo.dir/VoronoiFractureDemo.o.d"
+  "CMakeFiles/AppVoronoiFractureDemo.dir/main.o"
+  "CMakeFiles/AppVoronoiFractureDemo.dir/main.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppVoronoiFractureDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
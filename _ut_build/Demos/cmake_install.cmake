@@ -0,0 +1,90 @@
+# Install script for directory: /root/repo/Demos
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_ut_build/Demos/HelloWorld/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/AllBulletDemos/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/BulletXmlImportDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ConcaveDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ConstraintDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ConvexDecompositionDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/SerializeDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/OpenGL/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/CcdPhysicsDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/SliderConstraintDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/GenericJointDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/Raytracer/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/RagdollDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ForkLiftDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/BasicDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/FeatherstoneMultiBodyDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/RollingFrictionDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/RaytestDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/VoronoiFractureDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/GyroscopicDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/FractureDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/Box2dDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/BspDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/MovingConcaveDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/VehicleDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/UserCollisionAlgorithm/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/CharacterDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/SoftDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/CollisionInterfaceDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ConcaveConvexcastDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/SimplexDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/DynamicControlDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ConvexHullDistance/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/DoublePrecisionDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/CollisionDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ContinuousConvexCollision/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/ConcaveRaycastDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/GjkConvexCastDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/MultiMaterialDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/InternalEdgeDemo/cmake_install.cmake")
+  include("/root/repo/_ut_build/Demos/Benchmarks/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Extras/ConvexDecomposition/ConvexBuilder.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/ConvexBuilder.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/ConvexBuilder.o.d"
+  "/root/repo/Extras/ConvexDecomposition/ConvexDecomposition.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/ConvexDecomposition.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/ConvexDecomposition.o.d"
+  "/root/repo/Extras/ConvexDecomposition/bestfit.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/bestfit.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/bestfit.o.d"
+  "/root/repo/Extras/ConvexDecomposition/bestfitobb.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/bestfitobb.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/bestfitobb.o.d"
+  "/root/repo/Extras/ConvexDecomposition/cd_hull.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/cd_hull.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/cd_hull.o.d"
+  "/root/repo/Extras/ConvexDecomposition/cd_wavefront.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/cd_wavefront.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/cd_wavefront.o.d"
+  "/root/repo/Extras/ConvexDecomposition/concavity.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/concavity.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/concavity.o.d"
+  "/root/repo/Extras/ConvexDecomposition/fitsphere.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/fitsphere.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/fitsphere.o.d"
+  "/root/repo/Extras/ConvexDecomposition/float_math.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/float_math.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/float_math.o.d"
+  "/root/repo/Extras/ConvexDecomposition/meshvolume.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/meshvolume.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/meshvolume.o.d"
+  "/root/repo/Extras/ConvexDecomposition/planetri.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/planetri.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/planetri.o.d"
+  "/root/repo/Extras/ConvexDecomposition/raytri.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/raytri.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/raytri.o.d"
+  "/root/repo/Extras/ConvexDecomposition/splitplane.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/splitplane.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/splitplane.o.d"
+  "/root/repo/Extras/ConvexDecomposition/vlookup.cpp" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/vlookup.o" "gcc" "Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/vlookup.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ConvexDecomposition.dir/ConvexBuilder.o"
+  "CMakeFiles/ConvexDecomposition.dir/ConvexBuilder.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/ConvexDecomposition.o"
+  "CMakeFiles/ConvexDecomposition.dir/ConvexDecomposition.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/bestfit.o"
+  "CMakeFiles/ConvexDecomposition.dir/bestfit.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/bestfitobb.o"
+  "CMakeFiles/ConvexDecomposition.dir/bestfitobb.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/cd_hull.o"
+  "CMakeFiles/ConvexDecomposition.dir/cd_hull.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/cd_wavefront.o"
+  "CMakeFiles/ConvexDecomposition.dir/cd_wavefront.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/concavity.o"
+  "CMakeFiles/ConvexDecomposition.dir/concavity.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/fitsphere.o"
+  "CMakeFiles/ConvexDecomposition.dir/fitsphere.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/float_math.o"
+  "CMakeFiles/ConvexDecomposition.dir/float_math.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/meshvolume.o"
+  "CMakeFiles/ConvexDecomposition.dir/meshvolume.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/planetri.o"
+  "CMakeFiles/ConvexDecomposition.dir/planetri.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/raytri.o"
+  "CMakeFiles/ConvexDecomposition.dir/raytri.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/splitplane.o"
+  "CMakeFiles/ConvexDecomposition.dir/splitplane.o.d"
+  "CMakeFiles/ConvexDecomposition.dir/vlookup.o"
+  "CMakeFiles/ConvexDecomposition.dir/vlookup.o.d"
+  "libConvexDecomposition.a"
+  "libConvexDecomposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ConvexDecomposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
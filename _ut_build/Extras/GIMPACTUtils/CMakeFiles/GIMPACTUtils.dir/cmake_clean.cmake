@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GIMPACTUtils.dir/btGImpactConvexDecompositionShape.o"
+  "CMakeFiles/GIMPACTUtils.dir/btGImpactConvexDecompositionShape.o.d"
+  "libGIMPACTUtils.a"
+  "libGIMPACTUtils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GIMPACTUtils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Extras/HACD/hacdGraph.cpp" "Extras/HACD/CMakeFiles/HACD.dir/hacdGraph.o" "gcc" "Extras/HACD/CMakeFiles/HACD.dir/hacdGraph.o.d"
+  "/root/repo/Extras/HACD/hacdHACD.cpp" "Extras/HACD/CMakeFiles/HACD.dir/hacdHACD.o" "gcc" "Extras/HACD/CMakeFiles/HACD.dir/hacdHACD.o.d"
+  "/root/repo/Extras/HACD/hacdICHull.cpp" "Extras/HACD/CMakeFiles/HACD.dir/hacdICHull.o" "gcc" "Extras/HACD/CMakeFiles/HACD.dir/hacdICHull.o.d"
+  "/root/repo/Extras/HACD/hacdManifoldMesh.cpp" "Extras/HACD/CMakeFiles/HACD.dir/hacdManifoldMesh.o" "gcc" "Extras/HACD/CMakeFiles/HACD.dir/hacdManifoldMesh.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
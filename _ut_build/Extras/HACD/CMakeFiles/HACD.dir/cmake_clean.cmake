@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HACD.dir/hacdGraph.o"
+  "CMakeFiles/HACD.dir/hacdGraph.o.d"
+  "CMakeFiles/HACD.dir/hacdHACD.o"
+  "CMakeFiles/HACD.dir/hacdHACD.o.d"
+  "CMakeFiles/HACD.dir/hacdICHull.o"
+  "CMakeFiles/HACD.dir/hacdICHull.o.d"
+  "CMakeFiles/HACD.dir/hacdManifoldMesh.o"
+  "CMakeFiles/HACD.dir/hacdManifoldMesh.o.d"
+  "libHACD.a"
+  "libHACD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HACD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Extras/Serialize/BulletFileLoader/bChunk.cpp" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/bChunk.o" "gcc" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/bChunk.o.d"
+  "/root/repo/Extras/Serialize/BulletFileLoader/bDNA.cpp" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/bDNA.o" "gcc" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/bDNA.o.d"
+  "/root/repo/Extras/Serialize/BulletFileLoader/bFile.cpp" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/bFile.o" "gcc" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/bFile.o.d"
+  "/root/repo/Extras/Serialize/BulletFileLoader/btBulletFile.cpp" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/btBulletFile.o" "gcc" "Extras/Serialize/BulletFileLoader/CMakeFiles/BulletFileLoader.dir/btBulletFile.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
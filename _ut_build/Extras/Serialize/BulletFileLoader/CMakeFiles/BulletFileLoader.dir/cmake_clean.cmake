@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletFileLoader.dir/bChunk.o"
+  "CMakeFiles/BulletFileLoader.dir/bChunk.o.d"
+  "CMakeFiles/BulletFileLoader.dir/bDNA.o"
+  "CMakeFiles/BulletFileLoader.dir/bDNA.o.d"
+  "CMakeFiles/BulletFileLoader.dir/bFile.o"
+  "CMakeFiles/BulletFileLoader.dir/bFile.o.d"
+  "CMakeFiles/BulletFileLoader.dir/btBulletFile.o"
+  "CMakeFiles/BulletFileLoader.dir/btBulletFile.o.d"
+  "libBulletFileLoader.a"
+  "libBulletFileLoader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletFileLoader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletWorldImporter.dir/btBulletWorldImporter.o"
+  "CMakeFiles/BulletWorldImporter.dir/btBulletWorldImporter.o.d"
+  "CMakeFiles/BulletWorldImporter.dir/btWorldImporter.o"
+  "CMakeFiles/BulletWorldImporter.dir/btWorldImporter.o.d"
+  "libBulletWorldImporter.a"
+  "libBulletWorldImporter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletWorldImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/btBulletXmlWorldImporter.cpp" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/btBulletXmlWorldImporter.o" "gcc" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/btBulletXmlWorldImporter.o.d"
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/string_split.cpp" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/string_split.o" "gcc" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/string_split.o.d"
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/tinystr.cpp" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinystr.o" "gcc" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinystr.o.d"
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/tinyxml.cpp" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinyxml.o" "gcc" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinyxml.o.d"
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/tinyxmlerror.cpp" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlerror.o" "gcc" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlerror.o.d"
+  "/root/repo/Extras/Serialize/BulletXmlWorldImporter/tinyxmlparser.cpp" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlparser.o" "gcc" "Extras/Serialize/BulletXmlWorldImporter/CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlparser.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
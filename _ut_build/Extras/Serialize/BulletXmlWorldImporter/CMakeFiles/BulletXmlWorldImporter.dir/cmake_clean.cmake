@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletXmlWorldImporter.dir/btBulletXmlWorldImporter.o"
+  "CMakeFiles/BulletXmlWorldImporter.dir/btBulletXmlWorldImporter.o.d"
+  "CMakeFiles/BulletXmlWorldImporter.dir/string_split.o"
+  "CMakeFiles/BulletXmlWorldImporter.dir/string_split.o.d"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinystr.o"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinystr.o.d"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinyxml.o"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinyxml.o.d"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlerror.o"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlerror.o.d"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlparser.o"
+  "CMakeFiles/BulletXmlWorldImporter.dir/tinyxmlparser.o.d"
+  "libBulletXmlWorldImporter.a"
+  "libBulletXmlWorldImporter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletXmlWorldImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
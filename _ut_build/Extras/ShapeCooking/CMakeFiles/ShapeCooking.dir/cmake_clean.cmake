@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ShapeCooking.dir/btShapeCache.o"
+  "CMakeFiles/ShapeCooking.dir/btShapeCache.o.d"
+  "CMakeFiles/ShapeCooking.dir/btShapeCooker.o"
+  "CMakeFiles/ShapeCooking.dir/btShapeCooker.o.d"
+  "libShapeCooking.a"
+  "libShapeCooking.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ShapeCooking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
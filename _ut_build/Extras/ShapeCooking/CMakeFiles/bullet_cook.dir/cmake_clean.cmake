@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bullet_cook.dir/ShapeCookingTool.o"
+  "CMakeFiles/bullet_cook.dir/ShapeCookingTool.o.d"
+  "bullet_cook"
+  "bullet_cook.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bullet_cook.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Extras/glui/algebra3.cpp" "Extras/glui/CMakeFiles/GLUI.dir/algebra3.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/algebra3.o.d"
+  "/root/repo/Extras/glui/arcball.cpp" "Extras/glui/CMakeFiles/GLUI.dir/arcball.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/arcball.o.d"
+  "/root/repo/Extras/glui/glui.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui.o.d"
+  "/root/repo/Extras/glui/glui_add_controls.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_add_controls.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_add_controls.o.d"
+  "/root/repo/Extras/glui/glui_bitmap_img_data.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_bitmap_img_data.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_bitmap_img_data.o.d"
+  "/root/repo/Extras/glui/glui_bitmaps.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_bitmaps.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_bitmaps.o.d"
+  "/root/repo/Extras/glui/glui_button.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_button.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_button.o.d"
+  "/root/repo/Extras/glui/glui_checkbox.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_checkbox.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_checkbox.o.d"
+  "/root/repo/Extras/glui/glui_column.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_column.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_column.o.d"
+  "/root/repo/Extras/glui/glui_commandline.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_commandline.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_commandline.o.d"
+  "/root/repo/Extras/glui/glui_control.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_control.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_control.o.d"
+  "/root/repo/Extras/glui/glui_edittext.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_edittext.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_edittext.o.d"
+  "/root/repo/Extras/glui/glui_filebrowser.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_filebrowser.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_filebrowser.o.d"
+  "/root/repo/Extras/glui/glui_list.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_list.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_list.o.d"
+  "/root/repo/Extras/glui/glui_listbox.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_listbox.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_listbox.o.d"
+  "/root/repo/Extras/glui/glui_mouse_iaction.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_mouse_iaction.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_mouse_iaction.o.d"
+  "/root/repo/Extras/glui/glui_node.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_node.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_node.o.d"
+  "/root/repo/Extras/glui/glui_panel.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_panel.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_panel.o.d"
+  "/root/repo/Extras/glui/glui_radio.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_radio.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_radio.o.d"
+  "/root/repo/Extras/glui/glui_rollout.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_rollout.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_rollout.o.d"
+  "/root/repo/Extras/glui/glui_rotation.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_rotation.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_rotation.o.d"
+  "/root/repo/Extras/glui/glui_scrollbar.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_scrollbar.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_scrollbar.o.d"
+  "/root/repo/Extras/glui/glui_separator.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_separator.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_separator.o.d"
+  "/root/repo/Extras/glui/glui_spinner.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_spinner.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_spinner.o.d"
+  "/root/repo/Extras/glui/glui_statictext.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_statictext.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_statictext.o.d"
+  "/root/repo/Extras/glui/glui_string.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_string.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_string.o.d"
+  "/root/repo/Extras/glui/glui_textbox.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_textbox.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_textbox.o.d"
+  "/root/repo/Extras/glui/glui_translation.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_translation.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_translation.o.d"
+  "/root/repo/Extras/glui/glui_tree.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_tree.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_tree.o.d"
+  "/root/repo/Extras/glui/glui_treepanel.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_treepanel.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_treepanel.o.d"
+  "/root/repo/Extras/glui/glui_window.cpp" "Extras/glui/CMakeFiles/GLUI.dir/glui_window.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/glui_window.o.d"
+  "/root/repo/Extras/glui/quaternion.cpp" "Extras/glui/CMakeFiles/GLUI.dir/quaternion.o" "gcc" "Extras/glui/CMakeFiles/GLUI.dir/quaternion.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GLUI.dir/algebra3.o"
+  "CMakeFiles/GLUI.dir/algebra3.o.d"
+  "CMakeFiles/GLUI.dir/arcball.o"
+  "CMakeFiles/GLUI.dir/arcball.o.d"
+  "CMakeFiles/GLUI.dir/glui.o"
+  "CMakeFiles/GLUI.dir/glui.o.d"
+  "CMakeFiles/GLUI.dir/glui_add_controls.o"
+  "CMakeFiles/GLUI.dir/glui_add_controls.o.d"
+  "CMakeFiles/GLUI.dir/glui_bitmap_img_data.o"
+  "CMakeFiles/GLUI.dir/glui_bitmap_img_data.o.d"
+  "CMakeFiles/GLUI.dir/glui_bitmaps.o"
+  "CMakeFiles/GLUI.dir/glui_bitmaps.o.d"
+  "CMakeFiles/GLUI.dir/glui_button.o"
+  "CMakeFiles/GLUI.dir/glui_button.o.d"
+  "CMakeFiles/GLUI.dir/glui_checkbox.o"
+  "CMakeFiles/GLUI.dir/glui_checkbox.o.d"
+  "CMakeFiles/GLUI.dir/glui_column.o"
+  "CMakeFiles/GLUI.dir/glui_column.o.d"
+  "CMakeFiles/GLUI.dir/glui_commandline.o"
+  "CMakeFiles/GLUI.dir/glui_commandline.o.d"
+  "CMakeFiles/GLUI.dir/glui_control.o"
+  "CMakeFiles/GLUI.dir/glui_control.o.d"
+  "CMakeFiles/GLUI.dir/glui_edittext.o"
+  "CMakeFiles/GLUI.dir/glui_edittext.o.d"
+  "CMakeFiles/GLUI.dir/glui_filebrowser.o"
+  "CMakeFiles/GLUI.dir/glui_filebrowser.o.d"
+  "CMakeFiles/GLUI.dir/glui_list.o"
+  "CMakeFiles/GLUI.dir/glui_list.o.d"
+  "CMakeFiles/GLUI.dir/glui_listbox.o"
+  "CMakeFiles/GLUI.dir/glui_listbox.o.d"
+  "CMakeFiles/GLUI.dir/glui_mouse_iaction.o"
+  "CMakeFiles/GLUI.dir/glui_mouse_iaction.o.d"
+  "CMakeFiles/GLUI.dir/glui_node.o"
+  "CMakeFiles/GLUI.dir/glui_node.o.d"
+  "CMakeFiles/GLUI.dir/glui_panel.o"
+  "CMakeFiles/GLUI.dir/glui_panel.o.d"
+  "CMakeFiles/GLUI.dir/glui_radio.o"
+  "CMakeFiles/GLUI.dir/glui_radio.o.d"
+  "CMakeFiles/GLUI.dir/glui_rollout.o"
+  "CMakeFiles/GLUI.dir/glui_rollout.o.d"
+  "CMakeFiles/GLUI.dir/glui_rotation.o"
+  "CMakeFiles/GLUI.dir/glui_rotation.o.d"
+  "CMakeFiles/GLUI.dir/glui_scrollbar.o"
+  "CMakeFiles/GLUI.dir/glui_scrollbar.o.d"
+  "CMakeFiles/GLUI.dir/glui_separator.o"
+  "CMakeFiles/GLUI.dir/glui_separator.o.d"
+  "CMakeFiles/GLUI.dir/glui_spinner.o"
+  "CMakeFiles/GLUI.dir/glui_spinner.o.d"
+  "CMakeFiles/GLUI.dir/glui_statictext.o"
+  "CMakeFiles/GLUI.dir/glui_statictext.o.d"
+  "CMakeFiles/GLUI.dir/glui_string.o"
+  "CMakeFiles/GLUI.dir/glui_string.o.d"
+  "CMakeFiles/GLUI.dir/glui_textbox.o"
+  "CMakeFiles/GLUI.dir/glui_textbox.o.d"
+  "CMakeFiles/GLUI.dir/glui_translation.o"
+  "CMakeFiles/GLUI.dir/glui_translation.o.d"
+  "CMakeFiles/GLUI.dir/glui_tree.o"
+  "CMakeFiles/GLUI.dir/glui_tree.o.d"
+  "CMakeFiles/GLUI.dir/glui_treepanel.o"
+  "CMakeFiles/GLUI.dir/glui_treepanel.o.d"
+  "CMakeFiles/GLUI.dir/glui_window.o"
+  "CMakeFiles/GLUI.dir/glui_window.o.d"
+  "CMakeFiles/GLUI.dir/quaternion.o"
+  "CMakeFiles/GLUI.dir/quaternion.o.d"
+  "libGLUI.a"
+  "libGLUI.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GLUI.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libGLUI.a"
+)
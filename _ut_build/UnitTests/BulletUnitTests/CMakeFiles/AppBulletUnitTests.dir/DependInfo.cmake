@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/UnitTests/BulletUnitTests/Main.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/Main.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/Main.o.d"
+  "/root/repo/UnitTests/BulletUnitTests/TestCholeskyDecomposition.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestCholeskyDecomposition.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestCholeskyDecomposition.o.d"
+  "/root/repo/UnitTests/BulletUnitTests/TestPolarDecomposition.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestPolarDecomposition.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestPolarDecomposition.o.d"
+  "/root/repo/UnitTests/BulletUnitTests/TestShapeCache.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestShapeCache.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestShapeCache.o.d"
+  "/root/repo/UnitTests/BulletUnitTests/TestTransformStream.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestTransformStream.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestTransformStream.o.d"
+  "/root/repo/UnitTests/BulletUnitTests/TestWorldSnapshot.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestWorldSnapshot.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/TestWorldSnapshot.o.d"
+  "/root/repo/UnitTests/BulletUnitTests/btCholeskyDecomposition.cpp" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/btCholeskyDecomposition.o" "gcc" "UnitTests/BulletUnitTests/CMakeFiles/AppBulletUnitTests.dir/btCholeskyDecomposition.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ut_build/UnitTests/cppunit/CMakeFiles/cppunit.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletDynamics/CMakeFiles/BulletDynamics.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/BulletCollision/CMakeFiles/BulletCollision.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/src/LinearMath/CMakeFiles/LinearMath.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/ShapeCooking/CMakeFiles/ShapeCooking.dir/DependInfo.cmake"
+  "/root/repo/_ut_build/Extras/ConvexDecomposition/CMakeFiles/ConvexDecomposition.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "AppBulletUnitTests"
+  "AppBulletUnitTests.pdb"
+  "CMakeFiles/AppBulletUnitTests.dir/Main.o"
+  "CMakeFiles/AppBulletUnitTests.dir/Main.o.d"
+  "CMakeFiles/AppBulletUnitTests.dir/TestCholeskyDecomposition.o"
+  "CMakeFiles/AppBulletUnitTests.dir/TestCholeskyDecomposition.o.d"
+  "CMakeFiles/AppBulletUnitTests.dir/TestPolarDecomposition.o"
+  "CMakeFiles/AppBulletUnitTests.dir/TestPolarDecomposition.o.d"
+  "CMakeFiles/AppBulletUnitTests.dir/TestShapeCache.o"
+  "CMakeFiles/AppBulletUnitTests.dir/TestShapeCache.o.d"
+  "CMakeFiles/AppBulletUnitTests.dir/TestTransformStream.o"
+  "CMakeFiles/AppBulletUnitTests.dir/TestTransformStream.o.d"
+  "CMakeFiles/AppBulletUnitTests.dir/TestWorldSnapshot.o"
+  "CMakeFiles/AppBulletUnitTests.dir/TestWorldSnapshot.o.d"
+  "CMakeFiles/AppBulletUnitTests.dir/btCholeskyDecomposition.o"
+  "CMakeFiles/AppBulletUnitTests.dir/btCholeskyDecomposition.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AppBulletUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,67 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/UnitTests/cppunit/src/cppunit/AdditionalMessage.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/AdditionalMessage.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/AdditionalMessage.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/Asserter.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Asserter.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Asserter.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/BeOsDynamicLibraryManager.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/BeOsDynamicLibraryManager.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/BeOsDynamicLibraryManager.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/BriefTestProgressListener.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/BriefTestProgressListener.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/BriefTestProgressListener.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/CompilerOutputter.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/CompilerOutputter.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/CompilerOutputter.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/DefaultProtector.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/DefaultProtector.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/DefaultProtector.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/DynamicLibraryManager.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManager.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManager.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/DynamicLibraryManagerException.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManagerException.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManagerException.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/Exception.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Exception.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Exception.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/Message.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Message.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Message.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/PlugInManager.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/PlugInManager.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/PlugInManager.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/PlugInParameters.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/PlugInParameters.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/PlugInParameters.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/Protector.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Protector.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Protector.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/ProtectorChain.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/ProtectorChain.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/ProtectorChain.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/RepeatedTest.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/RepeatedTest.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/RepeatedTest.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/ShlDynamicLibraryManager.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/ShlDynamicLibraryManager.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/ShlDynamicLibraryManager.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/SourceLine.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/SourceLine.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/SourceLine.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/StringTools.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/StringTools.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/StringTools.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/SynchronizedObject.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/SynchronizedObject.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/SynchronizedObject.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/Test.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Test.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Test.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestAssert.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestAssert.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestAssert.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestCase.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestCase.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestCase.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestCaseDecorator.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestCaseDecorator.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestCaseDecorator.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestComposite.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestComposite.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestComposite.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestDecorator.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestDecorator.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestDecorator.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestFactoryRegistry.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestFactoryRegistry.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestFactoryRegistry.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestFailure.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestFailure.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestFailure.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestLeaf.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestLeaf.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestLeaf.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestNamer.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestNamer.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestNamer.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestPath.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestPath.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestPath.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestPlugInDefaultImpl.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestPlugInDefaultImpl.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestPlugInDefaultImpl.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestResult.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestResult.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestResult.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestResultCollector.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestResultCollector.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestResultCollector.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestRunner.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestRunner.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestRunner.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestSetUp.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSetUp.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSetUp.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestSuccessListener.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSuccessListener.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSuccessListener.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestSuite.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSuite.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSuite.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TestSuiteBuilderContext.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSuiteBuilderContext.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TestSuiteBuilderContext.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TextOutputter.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextOutputter.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextOutputter.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TextTestProgressListener.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextTestProgressListener.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextTestProgressListener.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TextTestResult.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextTestResult.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextTestResult.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TextTestRunner.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextTestRunner.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TextTestRunner.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/TypeInfoHelper.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TypeInfoHelper.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/TypeInfoHelper.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/UnixDynamicLibraryManager.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/UnixDynamicLibraryManager.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/UnixDynamicLibraryManager.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/Win32DynamicLibraryManager.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Win32DynamicLibraryManager.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/Win32DynamicLibraryManager.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/XmlDocument.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlDocument.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlDocument.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/XmlElement.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlElement.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlElement.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/XmlOutputter.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlOutputter.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlOutputter.o.d"
+  "/root/repo/UnitTests/cppunit/src/cppunit/XmlOutputterHook.cpp" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlOutputterHook.o" "gcc" "UnitTests/cppunit/CMakeFiles/cppunit.dir/src/cppunit/XmlOutputterHook.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,107 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppunit.dir/src/cppunit/AdditionalMessage.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/AdditionalMessage.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/Asserter.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/Asserter.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/BeOsDynamicLibraryManager.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/BeOsDynamicLibraryManager.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/BriefTestProgressListener.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/BriefTestProgressListener.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/CompilerOutputter.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/CompilerOutputter.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/DefaultProtector.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/DefaultProtector.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManager.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManager.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManagerException.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/DynamicLibraryManagerException.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/Exception.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/Exception.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/Message.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/Message.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/PlugInManager.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/PlugInManager.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/PlugInParameters.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/PlugInParameters.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/Protector.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/Protector.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/ProtectorChain.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/ProtectorChain.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/RepeatedTest.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/RepeatedTest.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/ShlDynamicLibraryManager.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/ShlDynamicLibraryManager.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/SourceLine.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/SourceLine.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/StringTools.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/StringTools.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/SynchronizedObject.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/SynchronizedObject.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/Test.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/Test.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestAssert.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestAssert.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestCase.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestCase.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestCaseDecorator.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestCaseDecorator.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestComposite.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestComposite.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestDecorator.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestDecorator.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestFactoryRegistry.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestFactoryRegistry.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestFailure.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestFailure.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestLeaf.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestLeaf.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestNamer.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestNamer.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestPath.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestPath.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestPlugInDefaultImpl.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestPlugInDefaultImpl.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestResult.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestResult.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestResultCollector.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestResultCollector.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestRunner.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestRunner.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSetUp.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSetUp.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSuccessListener.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSuccessListener.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSuite.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSuite.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSuiteBuilderContext.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TestSuiteBuilderContext.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextOutputter.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextOutputter.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextTestProgressListener.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextTestProgressListener.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextTestResult.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextTestResult.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextTestRunner.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TextTestRunner.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/TypeInfoHelper.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/TypeInfoHelper.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/UnixDynamicLibraryManager.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/UnixDynamicLibraryManager.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/Win32DynamicLibraryManager.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/Win32DynamicLibraryManager.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlDocument.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlDocument.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlElement.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlElement.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlOutputter.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlOutputter.o.d"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlOutputterHook.o"
+  "CMakeFiles/cppunit.dir/src/cppunit/XmlOutputterHook.o.d"
+  "libcppunit.a"
+  "libcppunit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppunit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,114 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btAxisSweep3.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btAxisSweep3.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btBroadphaseProxy.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btBroadphaseProxy.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btDbvt.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvt.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvt.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvtBroadphase.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDbvtBroadphase.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btDispatcher.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDispatcher.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btDispatcher.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btMultiSapBroadphase.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btMultiSapBroadphase.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btMultiSapBroadphase.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btOverlappingPairCache.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btOverlappingPairCache.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btQuantizedBvh.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btQuantizedBvh.o.d"
+  "/root/repo/src/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btSimpleBroadphase.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/BroadphaseCollision/btSimpleBroadphase.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/SphereTriangleDetector.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/SphereTriangleDetector.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btActivatingCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btActivatingCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxDetector.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btBoxBoxDetector.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btCapsuleCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCapsuleCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCapsuleCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcher.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionDispatcher.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btCollisionObject.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionObject.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionObject.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btCollisionWorld.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorld.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCollisionWorld.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvex2dConvex2dAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvex2dConvex2dAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConcaveCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConcaveCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConvexAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexConvexAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexPlaneCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btConvexPlaneCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btDefaultCollisionConfiguration.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btDefaultCollisionConfiguration.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btEmptyCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btEmptyCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btGhostObject.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btGhostObject.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btGhostObject.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btHashedSimplePairCache.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btHashedSimplePairCache.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btInternalEdgeUtility.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btInternalEdgeUtility.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btManifoldResult.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btManifoldResult.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btManifoldResult.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSimulationIslandManager.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSimulationIslandManager.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereBoxCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereBoxCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereSphereCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereSphereCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereTriangleCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btSphereTriangleCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/CollisionDispatch/btUnionFind.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btUnionFind.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionDispatch/btUnionFind.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btBox2dShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBox2dShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBox2dShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btBoxShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBoxShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBoxShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBvhTriangleMeshShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btBvhTriangleMeshShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btCapsuleShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCapsuleShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCapsuleShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btCollisionShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCollisionShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCollisionShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btCompoundShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCompoundShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCompoundShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConcaveShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConcaveShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConcaveShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConeShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConeShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConeShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvex2dShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvex2dShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvex2dShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvexHullShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexHullShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexHullShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvexInternalShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexInternalShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexInternalShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPointCloudShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPointCloudShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPolyhedron.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexPolyhedron.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvexShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexTriangleMeshShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btConvexTriangleMeshShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btCylinderShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCylinderShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btCylinderShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btEmptyShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btEmptyShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btEmptyShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btHeightfieldTerrainShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btHeightfieldTerrainShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMinkowskiSumShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMinkowskiSumShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btMultiSphereShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultiSphereShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultiSphereShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultimaterialTriangleMeshShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btMultimaterialTriangleMeshShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btOptimizedBvh.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btOptimizedBvh.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btOptimizedBvh.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btPolyhedralConvexShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btPolyhedralConvexShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btScaledBvhTriangleMeshShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btScaledBvhTriangleMeshShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btShapeAsset.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeAsset.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeAsset.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btShapeHull.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeHull.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btShapeHull.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btSphereShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btSphereShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btSphereShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStaticPlaneShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStaticPlaneShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStridingMeshInterface.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btStridingMeshInterface.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTetrahedronShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTetrahedronShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTetrahedronShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTriangleBuffer.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleBuffer.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleBuffer.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTriangleCallback.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleCallback.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleCallback.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexArray.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexArray.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexMaterialArray.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleIndexVertexMaterialArray.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTriangleMesh.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMesh.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMesh.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMeshShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btTriangleMeshShape.o.d"
+  "/root/repo/src/BulletCollision/CollisionShapes/btUniformScalingShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btUniformScalingShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/CollisionShapes/btUniformScalingShape.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btContactProcessing.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btContactProcessing.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btContactProcessing.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btGImpactBvh.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactBvh.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactBvh.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactCollisionAlgorithm.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactQuantizedBvh.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactQuantizedBvh.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btGImpactShape.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactShape.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGImpactShape.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btGenericPoolAllocator.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGenericPoolAllocator.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btGenericPoolAllocator.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/btTriangleShapeEx.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btTriangleShapeEx.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/btTriangleShapeEx.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/gim_box_set.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_box_set.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_box_set.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/gim_contact.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_contact.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_contact.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/gim_memory.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_memory.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_memory.o.d"
+  "/root/repo/src/BulletCollision/Gimpact/gim_tri_collision.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_tri_collision.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/Gimpact/gim_tri_collision.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btContinuousConvexCollision.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btContinuousConvexCollision.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btConvexCast.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btConvexCast.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkConvexCast.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkConvexCast.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpa2.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpa2.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkPairDetector.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btGjkPairDetector.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPersistentManifold.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPersistentManifold.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPolyhedralContactClipping.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btPolyhedralContactClipping.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btRaycastCallback.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btRaycastCallback.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btSubSimplexConvexCast.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btSubSimplexConvexCast.o.d"
+  "/root/repo/src/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btVoronoiSimplexSolver.o" "gcc" "src/BulletCollision/CMakeFiles/BulletCollision.dir/NarrowPhaseCollision/btVoronoiSimplexSolver.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/BulletDynamics/Character/btKinematicCharacterController.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Character/btKinematicCharacterController.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Character/btKinematicCharacterController.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btConeTwistConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btConeTwistConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btContactConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btContactConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btContactConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btFixedConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btFixedConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btGearConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGearConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGearConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpringConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpringConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHinge2Constraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHinge2Constraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHingeConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHingeConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btNNCGConstraintSolver.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btNNCGConstraintSolver.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btPoint2PointConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btPoint2PointConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolver.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolver.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSliderConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSliderConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSolve2LinearConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSolve2LinearConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btTypedConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btTypedConstraint.o.d"
+  "/root/repo/src/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btUniversalConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/ConstraintSolver/btUniversalConstraint.o.d"
+  "/root/repo/src/BulletDynamics/Dynamics/Bullet-C-API.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/Bullet-C-API.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/Bullet-C-API.o.d"
+  "/root/repo/src/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorld.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorld.o.d"
+  "/root/repo/src/BulletDynamics/Dynamics/btRigidBody.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btRigidBody.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btRigidBody.o.d"
+  "/root/repo/src/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btSimpleDynamicsWorld.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btSimpleDynamicsWorld.o.d"
+  "/root/repo/src/BulletDynamics/Dynamics/btTransformStream.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btTransformStream.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btTransformStream.o.d"
+  "/root/repo/src/BulletDynamics/Dynamics/btWorldSnapshot.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btWorldSnapshot.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Dynamics/btWorldSnapshot.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBody.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBody.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBody.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraint.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraintSolver.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraintSolver.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyDynamicsWorld.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyDynamicsWorld.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointLimitConstraint.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointLimitConstraint.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointMotor.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointMotor.o.d"
+  "/root/repo/src/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyPoint2Point.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyPoint2Point.o.d"
+  "/root/repo/src/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btDantzigLCP.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btDantzigLCP.o.d"
+  "/root/repo/src/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btMLCPSolver.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/MLCPSolvers/btMLCPSolver.o.d"
+  "/root/repo/src/BulletDynamics/Vehicle/btRaycastVehicle.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btRaycastVehicle.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btRaycastVehicle.o.d"
+  "/root/repo/src/BulletDynamics/Vehicle/btWheelInfo.cpp" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btWheelInfo.o" "gcc" "src/BulletDynamics/CMakeFiles/BulletDynamics.dir/Vehicle/btWheelInfo.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
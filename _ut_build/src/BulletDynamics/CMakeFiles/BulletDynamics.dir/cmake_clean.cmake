@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BulletDynamics.dir/Character/btKinematicCharacterController.o"
+  "CMakeFiles/BulletDynamics.dir/Character/btKinematicCharacterController.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btConeTwistConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btConeTwistConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btContactConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btContactConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btFixedConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btFixedConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGearConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGearConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpringConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btGeneric6DofSpringConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHinge2Constraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHinge2Constraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHingeConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btHingeConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btNNCGConstraintSolver.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btNNCGConstraintSolver.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btPoint2PointConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btPoint2PointConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolver.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSequentialImpulseConstraintSolver.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSliderConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSliderConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSolve2LinearConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btSolve2LinearConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btTypedConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btTypedConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btUniversalConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/ConstraintSolver/btUniversalConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/Bullet-C-API.o"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/Bullet-C-API.o.d"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorld.o"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btDiscreteDynamicsWorld.o.d"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btRigidBody.o"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btRigidBody.o.d"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btSimpleDynamicsWorld.o"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btSimpleDynamicsWorld.o.d"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btTransformStream.o"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btTransformStream.o.d"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btWorldSnapshot.o"
+  "CMakeFiles/BulletDynamics.dir/Dynamics/btWorldSnapshot.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBody.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBody.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraintSolver.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyConstraintSolver.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyDynamicsWorld.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyDynamicsWorld.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointLimitConstraint.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointLimitConstraint.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointMotor.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyJointMotor.o.d"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyPoint2Point.o"
+  "CMakeFiles/BulletDynamics.dir/Featherstone/btMultiBodyPoint2Point.o.d"
+  "CMakeFiles/BulletDynamics.dir/MLCPSolvers/btDantzigLCP.o"
+  "CMakeFiles/BulletDynamics.dir/MLCPSolvers/btDantzigLCP.o.d"
+  "CMakeFiles/BulletDynamics.dir/MLCPSolvers/btMLCPSolver.o"
+  "CMakeFiles/BulletDynamics.dir/MLCPSolvers/btMLCPSolver.o.d"
+  "CMakeFiles/BulletDynamics.dir/Vehicle/btRaycastVehicle.o"
+  "CMakeFiles/BulletDynamics.dir/Vehicle/btRaycastVehicle.o.d"
+  "CMakeFiles/BulletDynamics.dir/Vehicle/btWheelInfo.o"
+  "CMakeFiles/BulletDynamics.dir/Vehicle/btWheelInfo.o.d"
+  "libBulletDynamics.a"
+  "libBulletDynamics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BulletDynamics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
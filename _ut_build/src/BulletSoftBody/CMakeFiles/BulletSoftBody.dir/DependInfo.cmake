@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/BulletSoftBody/btDefaultSoftBodySolver.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btDefaultSoftBodySolver.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btDefaultSoftBodySolver.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftBody.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBody.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBody.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyConcaveCollisionAlgorithm.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyConcaveCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftBodyHelpers.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyHelpers.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyHelpers.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyRigidBodyCollisionConfiguration.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftBodyRigidBodyCollisionConfiguration.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidCollisionAlgorithm.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidCollisionAlgorithm.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftRigidDynamicsWorld.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidDynamicsWorld.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftRigidDynamicsWorld.o.d"
+  "/root/repo/src/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftSoftCollisionAlgorithm.o" "gcc" "src/BulletSoftBody/CMakeFiles/BulletSoftBody.dir/btSoftSoftCollisionAlgorithm.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
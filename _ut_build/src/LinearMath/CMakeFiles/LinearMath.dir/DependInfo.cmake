@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/LinearMath/btAlignedAllocator.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btAlignedAllocator.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btAlignedAllocator.o.d"
+  "/root/repo/src/LinearMath/btAllocatorContext.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btAllocatorContext.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btAllocatorContext.o.d"
+  "/root/repo/src/LinearMath/btConvexHull.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHull.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHull.o.d"
+  "/root/repo/src/LinearMath/btConvexHullComputer.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHullComputer.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btConvexHullComputer.o.d"
+  "/root/repo/src/LinearMath/btFrameArena.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btFrameArena.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btFrameArena.o.d"
+  "/root/repo/src/LinearMath/btGeometryUtil.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btGeometryUtil.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btGeometryUtil.o.d"
+  "/root/repo/src/LinearMath/btPolarDecomposition.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btPolarDecomposition.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btPolarDecomposition.o.d"
+  "/root/repo/src/LinearMath/btPoolAllocator.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btPoolAllocator.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btPoolAllocator.o.d"
+  "/root/repo/src/LinearMath/btQuickprof.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btQuickprof.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btQuickprof.o.d"
+  "/root/repo/src/LinearMath/btSerializer.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btSerializer.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btSerializer.o.d"
+  "/root/repo/src/LinearMath/btVector3.cpp" "src/LinearMath/CMakeFiles/LinearMath.dir/btVector3.o" "gcc" "src/LinearMath/CMakeFiles/LinearMath.dir/btVector3.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LinearMath.dir/btAlignedAllocator.o"
+  "CMakeFiles/LinearMath.dir/btAlignedAllocator.o.d"
+  "CMakeFiles/LinearMath.dir/btAllocatorContext.o"
+  "CMakeFiles/LinearMath.dir/btAllocatorContext.o.d"
+  "CMakeFiles/LinearMath.dir/btConvexHull.o"
+  "CMakeFiles/LinearMath.dir/btConvexHull.o.d"
+  "CMakeFiles/LinearMath.dir/btConvexHullComputer.o"
+  "CMakeFiles/LinearMath.dir/btConvexHullComputer.o.d"
+  "CMakeFiles/LinearMath.dir/btFrameArena.o"
+  "CMakeFiles/LinearMath.dir/btFrameArena.o.d"
+  "CMakeFiles/LinearMath.dir/btGeometryUtil.o"
+  "CMakeFiles/LinearMath.dir/btGeometryUtil.o.d"
+  "CMakeFiles/LinearMath.dir/btPolarDecomposition.o"
+  "CMakeFiles/LinearMath.dir/btPolarDecomposition.o.d"
+  "CMakeFiles/LinearMath.dir/btPoolAllocator.o"
+  "CMakeFiles/LinearMath.dir/btPoolAllocator.o.d"
+  "CMakeFiles/LinearMath.dir/btQuickprof.o"
+  "CMakeFiles/LinearMath.dir/btQuickprof.o.d"
+  "CMakeFiles/LinearMath.dir/btSerializer.o"
+  "CMakeFiles/LinearMath.dir/btSerializer.o.d"
+  "CMakeFiles/LinearMath.dir/btVector3.o"
+  "CMakeFiles/LinearMath.dir/btVector3.o.d"
+  "libLinearMath.a"
+  "libLinearMath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LinearMath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
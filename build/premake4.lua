@@ -18,6 +18,11 @@ solution "0BulletSolution"
     description = "Enable double precision build"
   }
 
+	newoption {
+    trigger     = "with-deterministic-math",
+    description = "Enable bit exact results across platforms (applications need BT_USE_DETERMINISTIC_MATH and the same float flags)"
+  }
+
 
 	newoption {
     trigger     = "with-nacl",
@@ -49,11 +54,17 @@ solution "0BulletSolution"
   }
 
   
+	--fast math reorders and contracts floating point operations, which breaks deterministic math
+	floatMode = "FloatFast"
+	if _OPTIONS["with-deterministic-math"] then
+		floatMode = "FloatStrict"
+	end
+
 	configurations {"Release", "Debug"}
 	configuration "Release"
-		flags { "Optimize", "EnableSSE", "StaticRuntime", "NoMinimalRebuild", "FloatFast"}
+		flags { "Optimize", "EnableSSE", "StaticRuntime", "NoMinimalRebuild", floatMode}
 	configuration "Debug"
-		flags { "Symbols", "StaticRuntime" , "NoMinimalRebuild", "NoEditAndContinue" ,"FloatFast"}
+		flags { "Symbols", "StaticRuntime" , "NoMinimalRebuild", "NoEditAndContinue" ,floatMode}
 		
  if os.is("Linux") then
                 if os.is64bit() then
@@ -77,6 +88,13 @@ solution "0BulletSolution"
   if _OPTIONS["with-double-precision"] then
   	defines {"BT_USE_DOUBLE_PRECISION"}
   end
+
+  if _OPTIONS["with-deterministic-math"] then
+  	defines {"BT_USE_DETERMINISTIC_MATH"}
+  	configuration {"gmake"}
+  		buildoptions {"-ffp-contract=off", "-fno-fast-math"}
+  	configuration {}
+  end
   
 	if _ACTION == "xcode4" then
 		if _OPTIONS["ios"] then
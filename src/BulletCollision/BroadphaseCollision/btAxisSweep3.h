@@ -25,6 +25,7 @@
 #include "btBroadphaseProxy.h"
 #include "btOverlappingPairCallback.h"
 #include "btDbvtBroadphase.h"
+#include <string.h>
 
 //#define DEBUG_BROADPHASE 1
 #define USE_OVERLAP_TEST_ON_REMOVES 1
@@ -99,6 +100,9 @@ protected:
 	btDbvtBroadphase*	m_raycastAccelerator;
 	btOverlappingPairCache*	m_nullPairCache;
 
+	///edges seen per handle while restoreState validates a state
+	btAlignedObjectArray<unsigned char>	m_stateEdgeFlags;
+
 
 	// allocation/deallocation
 	BP_FP_INT_TYPE allocHandle();
@@ -141,6 +145,10 @@ public:
 
 	virtual void resetPool(btDispatcher* dispatcher);
 
+	///stores the sorted edge lists and the handle aabbs, so restoreState reproduces the exact pair order of later steps
+	virtual void	captureState(btAlignedObjectArray<unsigned char>& state) const;
+	virtual bool	restoreState(const unsigned char* state, int size);
+
 	void	processAllOverlappingPairs(btOverlapCallback* callback);
 
 	//Broadphase Interface
@@ -628,6 +636,128 @@ void btAxisSweep3Internal<BP_FP_INT_TYPE>::resetPool(btDispatcher* /*dispatcher*
 	}
 }       
 
+#define BT_AXIS_SWEEP3_STATE_TAG 0x53415053
+
+template <typename BP_FP_INT_TYPE>
+void btAxisSweep3Internal<BP_FP_INT_TYPE>::captureState(btAlignedObjectArray<unsigned char>& state) const
+{
+	//tag, number of handles, the edge arrays including both sentinels, then the aabbs in the order of the min edges on axis 0
+	int numEdges = m_numHandles * 2 + 2;
+	int offset = state.size();
+	int size = 2*sizeof(int) + 3*numEdges*sizeof(Edge) + m_numHandles*2*sizeof(btVector3);
+	state.resize(offset + size);
+	unsigned char* out = &state[offset];
+
+	int header[2] = {BT_AXIS_SWEEP3_STATE_TAG, int(m_numHandles)};
+	memcpy(out,header,sizeof(header));
+	out += sizeof(header);
+	for (int axis = 0; axis < 3; axis++)
+	{
+		memcpy(out,m_pEdges[axis],numEdges*sizeof(Edge));
+		out += numEdges*sizeof(Edge);
+	}
+	for (int i = 1; i < numEdges - 1; i++)
+	{
+		const Edge& edge = m_pEdges[0][i];
+		if (edge.IsMax())
+			continue;
+		const Handle* handle = getHandle(edge.m_handle);
+		memcpy(out,&handle->m_aabbMin,sizeof(btVector3));
+		memcpy(out+sizeof(btVector3),&handle->m_aabbMax,sizeof(btVector3));
+		out += 2*sizeof(btVector3);
+	}
+}
+
+template <typename BP_FP_INT_TYPE>
+bool btAxisSweep3Internal<BP_FP_INT_TYPE>::restoreState(const unsigned char* state, int size)
+{
+	int header[2];
+	if (size < int(sizeof(header)))
+		return false;
+	memcpy(header,state,sizeof(header));
+	int numEdges = m_numHandles * 2 + 2;
+	if (header[0] != BT_AXIS_SWEEP3_STATE_TAG || header[1] != int(m_numHandles) ||
+		size != int(sizeof(header) + 3*numEdges*sizeof(Edge) + m_numHandles*2*sizeof(btVector3)))
+		return false;
+	const unsigned char* in = state + sizeof(header);
+
+	//validate all three edge lists before changing anything. Each list is sorted, starts and ends with a sentinel
+	//and holds the min and the max edge of every handle in use exactly once. A handle is in use when its own min
+	//edge on axis 0 points back at it.
+	m_stateEdgeFlags.resize(m_maxHandles);
+	for (int i = 0; i < int(m_maxHandles); i++)
+		m_stateEdgeFlags[i] = 0;
+	for (int axis = 0; axis < 3; axis++)
+	{
+		const unsigned char* edges = in + axis*numEdges*sizeof(Edge);
+		Edge first, last;
+		memcpy(&first,edges,sizeof(Edge));
+		memcpy(&last,edges + (numEdges-1)*sizeof(Edge),sizeof(Edge));
+		if (first.m_handle != 0 || last.m_handle != 0)
+			return false;
+		BP_FP_INT_TYPE previousPos = first.m_pos;
+		for (int i = 1; i < numEdges - 1; i++)
+		{
+			Edge edge;
+			memcpy(&edge,edges + i*sizeof(Edge),sizeof(Edge));
+			if (edge.m_handle == 0 || edge.m_handle >= m_maxHandles || edge.m_pos < previousPos)
+				return false;
+			previousPos = edge.m_pos;
+			if (!m_stateEdgeFlags[edge.m_handle])
+			{
+				const Handle* handle = getHandle(edge.m_handle);
+				int minEdge = handle->m_minEdges[0];
+				if (minEdge < 1 || minEdge > numEdges - 2 || m_pEdges[0][minEdge].IsMax() || m_pEdges[0][minEdge].m_handle != edge.m_handle)
+					return false;
+			}
+			unsigned char flag = (unsigned char)((edge.IsMax() ? 2 : 1) << (2*axis));
+			if (m_stateEdgeFlags[edge.m_handle] & flag)
+				return false;
+			m_stateEdgeFlags[edge.m_handle] |= flag;
+		}
+		if (last.m_pos < previousPos)
+			return false;
+	}
+
+	//an edge that is still at the same index keeps the edge index of its handle
+	for (int axis = 0; axis < 3; axis++)
+	{
+		for (int i = 0; i < numEdges; i++)
+		{
+			Edge edge;
+			memcpy(&edge,in + i*sizeof(Edge),sizeof(Edge));
+			Edge& current = m_pEdges[axis][i];
+			if (i > 0 && i < numEdges - 1 && (current.m_handle != edge.m_handle || current.IsMax() != edge.IsMax()))
+			{
+				Handle* handle = getHandle(edge.m_handle);
+				if (edge.IsMax())
+					handle->m_maxEdges[axis] = static_cast<BP_FP_INT_TYPE>(i);
+				else
+					handle->m_minEdges[axis] = static_cast<BP_FP_INT_TYPE>(i);
+			}
+			current = edge;
+		}
+		in += numEdges*sizeof(Edge);
+	}
+	for (int i = 1; i < numEdges - 1; i++)
+	{
+		const Edge& edge = m_pEdges[0][i];
+		if (edge.IsMax())
+			continue;
+		Handle* handle = getHandle(edge.m_handle);
+		//the raycast accelerator only needs to know about the aabbs that changed
+		if (memcmp(&handle->m_aabbMin,in,sizeof(btVector3)) || memcmp(&handle->m_aabbMax,in+sizeof(btVector3),sizeof(btVector3)))
+		{
+			memcpy(&handle->m_aabbMin,in,sizeof(btVector3));
+			memcpy(&handle->m_aabbMax,in+sizeof(btVector3),sizeof(btVector3));
+			if (m_raycastAccelerator)
+				m_raycastAccelerator->setAabb(handle->m_dbvtProxy,handle->m_aabbMin,handle->m_aabbMax,0);
+		}
+		in += 2*sizeof(btVector3);
+	}
+	return true;
+}
+
 
 extern int gOverlappingPairs;
 //#include <stdio.h>
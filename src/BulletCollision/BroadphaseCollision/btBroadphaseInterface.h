@@ -44,6 +44,7 @@ struct	btBroadphaseRayCallback : public btBroadphaseAabbCallback
 };
 
 #include "LinearMath/btVector3.h"
+#include "LinearMath/btAlignedObjectArray.h"
 
 ///The btBroadphaseInterface class provides an interface to detect aabb-overlapping object pairs.
 ///Some implementations for this broadphase interface include btAxisSweep3, bt32BitAxisSweep3 and btDbvtBroadphase.
@@ -75,6 +76,13 @@ public:
 	///reset broadphase internal structures, to ensure determinism/reproducability
 	virtual void resetPool(btDispatcher* dispatcher) { (void) dispatcher; };
 
+	///appends the internal state that decides which new pairs are found, and in which order, to state. Used by btWorldSnapshot, the default stores nothing.
+	virtual void	captureState(btAlignedObjectArray<unsigned char>& state) const { (void) state; }
+
+	///restores a state written by captureState, including the proxy aabbs, for the same set of proxies.
+	///Returns false when nothing was restored, the caller then has to set the aabbs of all proxies again.
+	virtual bool	restoreState(const unsigned char* state, int size) { (void) state; (void) size; return false; }
+
 	virtual void	printStats() = 0;
 
 };
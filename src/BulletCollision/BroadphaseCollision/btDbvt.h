@@ -21,6 +21,7 @@ subject to the following restrictions:
 #include "LinearMath/btVector3.h"
 #include "LinearMath/btTransform.h"
 #include "LinearMath/btAabbUtil2.h"
+#include "LinearMath/btFrameArena.h"
 
 //
 // Compile time configuration
@@ -730,7 +731,10 @@ inline void		btDbvt::collideTT(	const btDbvtNode* root0,
 		{
 			int								depth=1;
 			int								treshold=DOUBLE_STACKSIZE-4;
+			btFrameArena*					arena=btGetThreadFrameArena();
+			btFrameArenaScope				arenaScope(arena);
 			btAlignedObjectArray<sStkNN>	stkStack;
+			btFrameArenaReserve(arena,stkStack,DOUBLE_STACKSIZE);
 			stkStack.resize(DOUBLE_STACKSIZE);
 			stkStack[0]=sStkNN(root0,root1);
 			do	{		
@@ -861,7 +865,10 @@ inline void		btDbvt::collideTT(	const btDbvtNode* root0,
 		{
 			int								depth=1;
 			int								treshold=DOUBLE_STACKSIZE-4;
+			btFrameArena*					arena=btGetThreadFrameArena();
+			btFrameArenaScope				arenaScope(arena);
 			btAlignedObjectArray<sStkNN>	stkStack;
+			btFrameArenaReserve(arena,stkStack,DOUBLE_STACKSIZE);
 			stkStack.resize(DOUBLE_STACKSIZE);
 			stkStack[0]=sStkNN(root0,root1);
 			do	{
@@ -927,9 +934,11 @@ inline void		btDbvt::collideTV(	const btDbvtNode* root,
 		if(root)
 		{
 			ATTRIBUTE_ALIGNED16(btDbvtVolume)		volume(vol);
+			btFrameArena*							arena=btGetThreadFrameArena();
+			btFrameArenaScope						arenaScope(arena);
 			btAlignedObjectArray<const btDbvtNode*>	stack;
 			stack.resize(0);
-			stack.reserve(SIMPLE_STACKSIZE);
+			btFrameArenaReserve(arena,stack,SIMPLE_STACKSIZE);
 			stack.push_back(root);
 			do	{
 				const btDbvtNode*	n=stack[stack.size()-1];
@@ -1026,11 +1035,14 @@ inline void		btDbvt::rayTest(	const btDbvtNode* root,
 
 			btVector3 resultNormal;
 
+			btFrameArena*					arena=btGetThreadFrameArena();
+			btFrameArenaScope				arenaScope(arena);
 			btAlignedObjectArray<const btDbvtNode*>	stack;
 
 			int								depth=1;
 			int								treshold=DOUBLE_STACKSIZE-2;
 
+			btFrameArenaReserve(arena,stack,DOUBLE_STACKSIZE);
 			stack.resize(DOUBLE_STACKSIZE);
 			stack[0]=root;
 			btVector3 bounds[2];
@@ -16,6 +16,7 @@ subject to the following restrictions:
 ///btDbvtBroadphase implementation by Nathanael Presson
 
 #include "btDbvtBroadphase.h"
+#include <string.h>
 
 //
 // Profiling
@@ -794,3 +795,320 @@ void							btDbvtBroadphase::benchmark(btBroadphaseInterface*)
 #undef	SPC
 #endif
 
+
+//
+// State snapshot
+//
+
+static const int	DBVT_BP_STATE_TAG = 0x44425653;
+
+struct	btDbvtStateWriter
+{
+	btAlignedObjectArray<unsigned char>&	m_state;
+	btDbvtStateWriter(btAlignedObjectArray<unsigned char>& state) : m_state(state) {}
+	template <typename T>
+	void	write(const T& value)
+	{
+		int offset=m_state.size();
+		//resize only reserves the exact size, grow geometrically to keep capture linear
+		if(offset+int(sizeof(T))>m_state.capacity()) m_state.reserve(btMax(2*m_state.capacity(),offset+1024));
+		m_state.resize(offset+int(sizeof(T)));
+		memcpy(&m_state[offset],&value,sizeof(T));
+	}
+	void	writeNode(const btDbvtNode* node)
+	{
+		write(node->volume);
+		if(node->isleaf())
+		{
+			write(((const btDbvtProxy*)node->data)->m_uniqueId);
+		}
+		else
+		{
+			write(int(-1));
+			writeNode(node->childs[0]);
+			writeNode(node->childs[1]);
+		}
+	}
+};
+
+struct	btDbvtStateReader
+{
+	const unsigned char*	m_data;
+	int						m_size;
+	int						m_offset;
+	btDbvtStateReader(const unsigned char* data,int size) : m_data(data),m_size(size),m_offset(0) {}
+	template <typename T>
+	bool	read(T& value)
+	{
+		if(m_offset+int(sizeof(T))>m_size) return(false);
+		memcpy(&value,m_data+m_offset,sizeof(T));
+		m_offset+=int(sizeof(T));
+		return(true);
+	}
+	/* For a second pass over data that was already checked	*/ 
+	template <typename T>
+	void	readValidated(T& value)
+	{
+		const bool	ok=read(value);
+		btAssert(ok);
+		(void)ok;
+	}
+};
+
+static btDbvtStateProxy*	findStateProxy(btAlignedObjectArray<btDbvtStateProxy>& table,int uid)
+{
+	const int	mask=table.size()-1;
+	for(int i=uid&mask;table[i].proxy;i=(i+1)&mask)
+	{
+		if(table[i].uid==uid) return(&table[i]);
+	}
+	return(0);
+}
+
+/* Checks a tree stored in preorder, every leaf must be a distinct proxy of the matching set	*/ 
+static bool	validateTree(btDbvtStateReader& reader,btAlignedObjectArray<btDbvtStateProxy>& table,int set,int& leaves)
+{
+	leaves=0;
+	for(int pending=1;pending>0;--pending)
+	{
+		btDbvtVolume	volume;
+		int				uid=0;
+		if(!reader.read(volume)||!reader.read(uid)) return(false);
+		if(uid<0)
+		{
+			pending+=2;
+		}
+		else
+		{
+			btDbvtStateProxy*	entry=findStateProxy(table,uid);
+			if(!entry||entry->leaf) return(false);
+			if((entry->stage==btDbvtBroadphase::STAGECOUNT)!=(set==btDbvtBroadphase::FIXED_SET)) return(false);
+			entry->leaf=1;
+			++leaves;
+		}
+	}
+	return(true);
+}
+
+/* Rebuilds a validated tree, taking the nodes from the back of nodes first	*/ 
+static btDbvtNode*	buildTree(btDbvtStateReader& reader,btAlignedObjectArray<btDbvtStateProxy>& table,btAlignedObjectArray<btDbvtNode*>& nodes)
+{
+	btDbvtNode*	root=0;
+	btDbvtNode*	parent=0;
+	for(int pending=1;pending>0;--pending)
+	{
+		btDbvtNode*	node;
+		if(nodes.size())
+		{ node=nodes[nodes.size()-1];nodes.pop_back(); }
+		else
+		{ node=new(btAlignedAlloc(sizeof(btDbvtNode),16)) btDbvtNode(); }
+		int	uid=-1;
+		reader.readValidated(node->volume);
+		reader.readValidated(uid);
+		node->parent=parent;
+		if(!parent)
+			root=node;
+		else if(!parent->childs[0])
+			parent->childs[0]=node;
+		else
+			parent->childs[1]=node;
+		if(uid<0)
+		{
+			node->childs[0]=node->childs[1]=0;
+			parent=node;
+			pending+=2;
+		}
+		else
+		{
+			btDbvtProxy*	proxy=findStateProxy(table,uid)->proxy;
+			node->childs[1]	=	0;
+			node->data		=	proxy;
+			proxy->leaf		=	node;
+			/* Back to the first ancestor still waiting for its second child	*/ 
+			while(parent&&parent->childs[1]) parent=parent->parent;
+		}
+	}
+	return(root);
+}
+
+void							btDbvtBroadphase::captureState(btAlignedObjectArray<unsigned char>& state) const
+{
+	btDbvtStateWriter	writer(state);
+	writer.write(DBVT_BP_STATE_TAG);
+	writer.write(m_stageCurrent);
+	writer.write(m_fupdates);
+	writer.write(m_dupdates);
+	writer.write(m_cupdates);
+	writer.write(m_newpairs);
+	writer.write(m_fixedleft);
+	writer.write(m_updates_call);
+	writer.write(m_updates_done);
+	writer.write(m_updates_ratio);
+	writer.write(m_pid);
+	writer.write(m_cid);
+	writer.write(m_gid);
+	writer.write((unsigned char)(m_needcleanup?1:0));
+	for(int i=0;i<=STAGECOUNT;++i)
+	{
+		writer.write(listcount(m_stageRoots[i]));
+		for(const btDbvtProxy* proxy=m_stageRoots[i];proxy;proxy=proxy->links[1])
+		{
+			writer.write(proxy->m_uniqueId);
+			writer.write(proxy->m_aabbMin);
+			writer.write(proxy->m_aabbMax);
+		}
+	}
+	for(int i=0;i<2;++i)
+	{
+		const btDbvt&	tree=m_sets[i];
+		writer.write(tree.m_root?1:0);
+		writer.write(tree.m_lkhd);
+		writer.write(tree.m_leaves);
+		writer.write(tree.m_opath);
+		if(tree.m_root) writer.writeNode(tree.m_root);
+	}
+}
+
+bool							btDbvtBroadphase::restoreState(const unsigned char* state,int size)
+{
+	btDbvtStateReader	reader(state,size);
+	int					tag=0;
+	int					stageCurrent=0,fupdates=0,dupdates=0,cupdates=0,newpairs=0,fixedleft=0;
+	unsigned			updates_call=0,updates_done=0;
+	btScalar			updates_ratio=0;
+	int					pid=0,cid=0,gid=0;
+	unsigned char		needcleanup=0;
+	if(!reader.read(tag)||(tag!=DBVT_BP_STATE_TAG)) return(false);
+	if(	!reader.read(stageCurrent)||!reader.read(fupdates)||!reader.read(dupdates)||
+		!reader.read(cupdates)||!reader.read(newpairs)||!reader.read(fixedleft)||
+		!reader.read(updates_call)||!reader.read(updates_done)||!reader.read(updates_ratio)||
+		!reader.read(pid)||!reader.read(cid)||!reader.read(gid)||!reader.read(needcleanup)) return(false);
+	if((stageCurrent<0)||(stageCurrent>=STAGECOUNT)||(needcleanup>1)) return(false);
+
+	/* Table of the current proxies by unique id	*/ 
+	int					numProxies=0;
+	for(int i=0;i<=STAGECOUNT;++i)
+	{
+		numProxies+=listcount(m_stageRoots[i]);
+	}
+	int					tableSize=16;
+	while(tableSize<2*numProxies) tableSize*=2;
+	m_stateProxies.resize(tableSize);
+	for(int i=0;i<tableSize;++i)
+	{
+		m_stateProxies[i].proxy=0;
+	}
+	for(int i=0;i<=STAGECOUNT;++i)
+	{
+		for(btDbvtProxy* proxy=m_stageRoots[i];proxy;proxy=proxy->links[1])
+		{
+			int	slot=proxy->m_uniqueId&(tableSize-1);
+			while(m_stateProxies[slot].proxy) slot=(slot+1)&(tableSize-1);
+			m_stateProxies[slot].proxy=proxy;
+			m_stateProxies[slot].uid=proxy->m_uniqueId;
+			m_stateProxies[slot].stage=-1;
+			m_stateProxies[slot].leaf=0;
+		}
+	}
+
+	/* Validate everything before changing anything, each proxy must be in one list and one tree	*/ 
+	const int			listsOffset=reader.m_offset;
+	int					numListed=0;
+	for(int i=0;i<=STAGECOUNT;++i)
+	{
+		int	count=0;
+		if(!reader.read(count)||(count<0)||(count>numProxies-numListed)) return(false);
+		for(int j=0;j<count;++j)
+		{
+			int			uid=0;
+			btVector3	aabbMin,aabbMax;
+			if(!reader.read(uid)||!reader.read(aabbMin)||!reader.read(aabbMax)) return(false);
+			btDbvtStateProxy*	entry=findStateProxy(m_stateProxies,uid);
+			if(!entry||(entry->stage>=0)) return(false);
+			entry->stage=i;
+		}
+		numListed+=count;
+	}
+	if(numListed!=numProxies) return(false);
+	int					numLeaves=0;
+	for(int i=0;i<2;++i)
+	{
+		int			hasRoot=0,lkhd=0,leaves=0;
+		unsigned	opath=0;
+		if(!reader.read(hasRoot)||!reader.read(lkhd)||!reader.read(leaves)||!reader.read(opath)) return(false);
+		int			treeLeaves=0;
+		if(hasRoot&&!validateTree(reader,m_stateProxies,i,treeLeaves)) return(false);
+		if(treeLeaves!=leaves) return(false);
+		numLeaves+=leaves;
+	}
+	if((numLeaves!=numProxies)||(reader.m_offset!=size)) return(false);
+
+	/* Stage lists	*/ 
+	reader.m_offset=listsOffset;
+	for(int i=0;i<=STAGECOUNT;++i)
+	{
+		int				count=0;
+		btDbvtProxy*	previous=0;
+		reader.readValidated(count);
+		m_stageRoots[i]=0;
+		for(int j=0;j<count;++j)
+		{
+			int	uid=0;
+			reader.readValidated(uid);
+			btDbvtProxy*	proxy=findStateProxy(m_stateProxies,uid)->proxy;
+			reader.readValidated(proxy->m_aabbMin);
+			reader.readValidated(proxy->m_aabbMax);
+			proxy->stage=i;
+			proxy->links[0]=previous;
+			proxy->links[1]=0;
+			if(previous) previous->links[1]=proxy; else m_stageRoots[i]=proxy;
+			previous=proxy;
+		}
+	}
+
+	/* Trees, reusing the current nodes	*/ 
+	m_stateNodes.resize(0);
+	for(int i=0;i<2;++i)
+	{
+		if(m_sets[i].m_root) m_stateNodes.push_back(m_sets[i].m_root);
+		m_sets[i].m_root=0;
+	}
+	for(int i=0;i<m_stateNodes.size();++i)
+	{
+		if(m_stateNodes[i]->isinternal())
+		{
+			m_stateNodes.push_back(m_stateNodes[i]->childs[0]);
+			m_stateNodes.push_back(m_stateNodes[i]->childs[1]);
+		}
+	}
+	for(int i=0;i<2;++i)
+	{
+		btDbvt&	tree=m_sets[i];
+		int		hasRoot=0;
+		reader.readValidated(hasRoot);
+		reader.readValidated(tree.m_lkhd);
+		reader.readValidated(tree.m_leaves);
+		reader.readValidated(tree.m_opath);
+		if(hasRoot) tree.m_root=buildTree(reader,m_stateProxies,m_stateNodes);
+	}
+	for(int i=0;i<m_stateNodes.size();++i)
+	{
+		btAlignedFree(m_stateNodes[i]);
+	}
+	m_stateNodes.resize(0);
+
+	m_stageCurrent	=	stageCurrent;
+	m_fupdates		=	fupdates;
+	m_dupdates		=	dupdates;
+	m_cupdates		=	cupdates;
+	m_newpairs		=	newpairs;
+	m_fixedleft		=	fixedleft;
+	m_updates_call	=	updates_call;
+	m_updates_done	=	updates_done;
+	m_updates_ratio	=	updates_ratio;
+	m_pid			=	pid;
+	m_cid			=	cid;
+	m_gid			=	gid;
+	m_needcleanup	=	needcleanup!=0;
+	return(true);
+}
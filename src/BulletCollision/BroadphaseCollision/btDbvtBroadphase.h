@@ -56,6 +56,17 @@ struct btDbvtProxy : btBroadphaseProxy
 
 typedef btAlignedObjectArray<btDbvtProxy*>	btDbvtProxyArray;
 
+//
+// btDbvtStateProxy, a proxy found by its unique id during restoreState
+//
+struct btDbvtStateProxy
+{
+	btDbvtProxy*	proxy;
+	int				uid;
+	int				stage;
+	int				leaf;
+};
+
 ///The btDbvtBroadphase implements a broadphase using two dynamic AABB bounding volume hierarchies/trees (see btDbvt).
 ///One tree is used for static/non-moving objects, and another tree is used for dynamic objects. Objects can move from one tree to the other.
 ///This is a very fast broadphase, especially for very dynamic worlds where many objects are moving. Its insert/add and remove of objects is generally faster than the sweep and prune broadphases btAxisSweep3 and bt32BitAxisSweep3.
@@ -87,6 +98,8 @@ struct	btDbvtBroadphase : btBroadphaseInterface
 	bool					m_releasepaircache;			// Release pair cache on delete
 	bool					m_deferedcollide;			// Defere dynamic/static collision to collide call
 	bool					m_needcleanup;				// Need to run cleanup?
+	btAlignedObjectArray<btDbvtStateProxy>	m_stateProxies;	// Proxies by unique id, used by restoreState
+	btAlignedObjectArray<btDbvtNode*>		m_stateNodes;	// Nodes reused by restoreState
 #if DBVT_BP_PROFILE
 	btClock					m_clock;
 	struct	{
@@ -121,6 +134,12 @@ struct	btDbvtBroadphase : btBroadphaseInterface
 	///reset broadphase internal structures, to ensure determinism/reproducability
 	virtual void resetPool(btDispatcher* dispatcher);
 
+	///stores both trees, the stage lists and the update counters, so restoreState reproduces the exact pair order of later steps
+	virtual void	captureState(btAlignedObjectArray<unsigned char>& state) const;
+	///the whole state is validated against the current proxies first, the broadphase is left unchanged when it returns false.
+	///The tree nodes are reused, so restoring does not allocate once the trees have their size.
+	virtual bool	restoreState(const unsigned char* state, int size);
+
 	void	performDeferredRemoval(btDispatcher* dispatcher);
 	
 	void	setVelocityPrediction(btScalar prediction)
@@ -46,7 +46,11 @@ struct btDispatcherInfo
 		m_useEpa(true),
 		m_allowedCcdPenetration(btScalar(0.04)),
 		m_useConvexConservativeDistanceUtil(false),
-		m_convexConservativeDistanceThreshold(0.0f)
+		m_convexConservativeDistanceThreshold(0.0f),
+		m_convexCoherentMotionThreshold(0.0f),
+		m_useSpeculativeContacts(false),
+		m_narrowphaseCallCounts(0),
+		m_deterministicOverlappingPairs(false)
 	{
 
 	}
@@ -62,6 +66,18 @@ struct btDispatcherInfo
 	btScalar	m_allowedCcdPenetration;
 	bool		m_useConvexConservativeDistanceUtil;
 	btScalar	m_convexConservativeDistanceThreshold;
+	///a convex pair that moved less than this distance relative to each other since its last query keeps its contacts
+	///without a new query, so resting pairs do almost no work. 0 disables it.
+	btScalar	m_convexCoherentMotionThreshold;
+	///report contacts of a pair up to the distance its objects can close within the step, bounded by the motion from the
+	///world transform to the interpolation (predicted) transform of dynamic rigid bodies. The solver only lets them touch,
+	///so fast objects cannot tunnel, without sweep tests.
+	bool		m_useSpeculativeContacts;
+	///optional MAX_BROADPHASE_COLLISION_TYPES*MAX_BROADPHASE_COLLISION_TYPES table, counts narrowphase calls by shape type pair
+	int*		m_narrowphaseCallCounts;
+	///process overlapping pairs and island manifolds in an order that only depends on the proxy unique ids,
+	///instead of the order of the pair cache hash table and the manifold array. Costs a sort per step.
+	bool		m_deterministicOverlappingPairs;
 };
 
 ///The btDispatcher interface class can be used in combination with broadphase to dispatch calculations for overlapping pairs.
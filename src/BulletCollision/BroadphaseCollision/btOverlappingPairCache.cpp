@@ -20,6 +20,8 @@ subject to the following restrictions:
 #include "btDispatcher.h"
 #include "btCollisionAlgorithm.h"
 #include "LinearMath/btAabbUtil2.h"
+#include "LinearMath/btQuickprof.h"
+#include "LinearMath/btFrameArena.h"
 
 #include <stdio.h>
 
@@ -396,6 +398,78 @@ void	btHashedOverlappingPairCache::processAllOverlappingPairs(btOverlapCallback*
 	}
 }
 
+struct btPairProcessOrder
+{
+	int	m_uid0;
+	int	m_uid1;
+	int	m_index;
+};
+
+class btPairProcessOrderPredicate
+{
+	public:
+
+		bool operator() ( const btPairProcessOrder& a, const btPairProcessOrder& b ) const
+		{
+			return a.m_uid0 < b.m_uid0 || (a.m_uid0 == b.m_uid0 && a.m_uid1 < b.m_uid1);
+		}
+};
+
+class btGreaterIntPredicate
+{
+	public:
+
+		bool operator() ( int a, int b ) const
+		{
+			return a > b;
+		}
+};
+
+void	btHashedOverlappingPairCache::processAllOverlappingPairs(btOverlapCallback* callback,btDispatcher* dispatcher,const btDispatcherInfo& dispatchInfo)
+{
+	if (!dispatchInfo.m_deterministicOverlappingPairs)
+	{
+		processAllOverlappingPairs(callback,dispatcher);
+		return;
+	}
+
+	btFrameArena* arena = btGetThreadFrameArena();
+	btFrameArenaScope arenaScope(arena);
+	btAlignedObjectArray<btPairProcessOrder> order;
+	btAlignedObjectArray<int> removeIndices;
+	int numPairs = m_overlappingPairArray.size();
+	{
+		BT_PROFILE("sortOverlappingPairs");
+		btFrameArenaReserve(arena,order,numPairs);
+		order.resize(numPairs);
+		for (int i=0;i<numPairs;i++)
+		{
+			const btBroadphasePair& pair = m_overlappingPairArray[i];
+			order[i].m_uid0 = pair.m_pProxy0->getUid();
+			order[i].m_uid1 = pair.m_pProxy1->getUid();
+			order[i].m_index = i;
+		}
+		order.quickSort(btPairProcessOrderPredicate());
+	}
+
+	//removing a pair moves the last pair into its slot, so removal waits until all pairs are visited
+	for (int i=0;i<numPairs;i++)
+	{
+		if (callback->processOverlap(m_overlappingPairArray[order[i].m_index]))
+		{
+			removeIndices.push_back(order[i].m_index);
+		}
+	}
+	//going from the back, the pair moved into a removed slot never is one still to be removed
+	removeIndices.quickSort(btGreaterIntPredicate());
+	for (int i=0;i<removeIndices.size();i++)
+	{
+		btBroadphasePair* pair = &m_overlappingPairArray[removeIndices[i]];
+		removeOverlappingPair(pair->m_pProxy0,pair->m_pProxy1,dispatcher);
+		gOverlappingPairs--;
+	}
+}
+
 void	btHashedOverlappingPairCache::sortOverlappingPairs(btDispatcher* dispatcher)
 {
 	///need to keep hashmap in sync with pair address, so rebuild all
@@ -427,6 +501,50 @@ void	btHashedOverlappingPairCache::sortOverlappingPairs(btDispatcher* dispatcher
 }
 
 
+void	btHashedOverlappingPairCache::unlinkPair(int pairIndex,int hash)
+{
+	int index = m_hashTable[hash];
+	btAssert(index != BT_NULL_PAIR);
+
+	int previous = BT_NULL_PAIR;
+	while (index != pairIndex)
+	{
+		previous = index;
+		index = m_next[index];
+	}
+
+	if (previous != BT_NULL_PAIR)
+	{
+		m_next[previous] = m_next[pairIndex];
+	}
+	else
+	{
+		m_hashTable[hash] = m_next[pairIndex];
+	}
+}
+
+void	btHashedOverlappingPairCache::swapOverlappingPairs(int index0,int index1)
+{
+	if (index0 == index1)
+		return;
+	const btBroadphasePair& pair0 = m_overlappingPairArray[index0];
+	const btBroadphasePair& pair1 = m_overlappingPairArray[index1];
+	int mask = m_overlappingPairArray.capacity()-1;
+	int hash0 = static_cast<int>(getHash(static_cast<unsigned int>(pair0.m_pProxy0->getUid()),static_cast<unsigned int>(pair0.m_pProxy1->getUid())) & mask);
+	int hash1 = static_cast<int>(getHash(static_cast<unsigned int>(pair1.m_pProxy0->getUid()),static_cast<unsigned int>(pair1.m_pProxy1->getUid())) & mask);
+	unlinkPair(index0,hash0);
+	unlinkPair(index1,hash1);
+
+	m_overlappingPairArray.swap(index0,index1);
+
+	//index0 now holds the pair that hashes to hash1
+	m_next[index0] = m_hashTable[hash1];
+	m_hashTable[hash1] = index0;
+	m_next[index1] = m_hashTable[hash0];
+	m_hashTable[hash0] = index1;
+}
+
+
 void*	btSortedOverlappingPairCache::removeOverlappingPair(btBroadphaseProxy* proxy0,btBroadphaseProxy* proxy1, btDispatcher* dispatcher )
 {
 	if (!hasDeferredRemoval())
@@ -78,6 +78,14 @@ public:
 
 	virtual void	processAllOverlappingPairs(btOverlapCallback*,btDispatcher* dispatcher) = 0;
 
+	///processes the pairs in the order of their proxy unique ids when dispatchInfo.m_deterministicOverlappingPairs is set.
+	///The default ignores dispatchInfo, for caches whose pair order already is deterministic.
+	virtual void	processAllOverlappingPairs(btOverlapCallback* callback,btDispatcher* dispatcher,const struct btDispatcherInfo& dispatchInfo)
+	{
+		(void)dispatchInfo;
+		processAllOverlappingPairs(callback,dispatcher);
+	}
+
 	virtual btBroadphasePair* findPair(btBroadphaseProxy* proxy0, btBroadphaseProxy* proxy1) = 0;
 
 	virtual bool	hasDeferredRemoval() = 0;
@@ -86,6 +94,11 @@ public:
 
 	virtual void	sortOverlappingPairs(btDispatcher* dispatcher) = 0;
 
+	///swaps two pairs in the pair array, keeping their collision algorithms. Used to restore a stored pair order.
+	virtual void	swapOverlappingPairs(int index0,int index1)
+	{
+		getOverlappingPairArray().swap(index0,index1);
+	}
 
 };
 
@@ -142,6 +155,9 @@ public:
 	
 	virtual void	processAllOverlappingPairs(btOverlapCallback*,btDispatcher* dispatcher);
 
+	///the order of the pair array depends on the hash table, so with m_deterministicOverlappingPairs the pairs are visited sorted by proxy unique ids
+	virtual void	processAllOverlappingPairs(btOverlapCallback* callback,btDispatcher* dispatcher,const struct btDispatcherInfo& dispatchInfo);
+
 	virtual btBroadphasePair*	getOverlappingPairArrayPtr()
 	{
 		return &m_overlappingPairArray[0];
@@ -185,10 +201,16 @@ public:
 	{
 		return m_overlappingPairArray.size();
 	}
+
+	///also moves both pairs in the hash table
+	virtual void	swapOverlappingPairs(int index0,int index1);
+
 private:
 	
 	btBroadphasePair* 	internalAddPair(btBroadphaseProxy* proxy0,btBroadphaseProxy* proxy1);
 
+	void	unlinkPair(int pairIndex,int hash);
+
 	void	growTables();
 
 	SIMD_FORCE_INLINE bool equalsPair(const btBroadphasePair& pair, int proxyId1, int proxyId2)
@@ -19,8 +19,38 @@ subject to the following restrictions:
 #include "BulletCollision/CollisionDispatch/btCollisionObject.h"
 #include "btBoxBoxDetector.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+#include "BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h"
+#include "BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.h"
 #define USE_PERSISTENT_CONTACTS 1
 
+///forwards the closest points of separated boxes, for speculative contacts
+struct btSeparatedBoxesResult : public btDiscreteCollisionDetectorInterface::Result
+{
+	btManifoldResult*	m_resultOut;
+	bool				m_separated;
+
+	btSeparatedBoxesResult(btManifoldResult* resultOut)
+		:m_resultOut(resultOut),
+		m_separated(false)
+	{
+	}
+
+	virtual void setShapeIdentifiersA(int /*partId0*/,int /*index0*/)
+	{
+	}
+	virtual void setShapeIdentifiersB(int /*partId1*/,int /*index1*/)
+	{
+	}
+	virtual void addContactPoint(const btVector3& normalOnBInWorld,const btVector3& pointInWorld,btScalar depth)
+	{
+		if (depth > btScalar(0.))
+		{
+			m_separated = true;
+			m_resultOut->addContactPoint(normalOnBInWorld,pointInWorld,depth);
+		}
+	}
+};
+
 btBoxBoxCollisionAlgorithm::btBoxBoxCollisionAlgorithm(btPersistentManifold* mf,const btCollisionAlgorithmConstructionInfo& ci,const btCollisionObjectWrapper* body0Wrap,const btCollisionObjectWrapper* body1Wrap)
 : btActivatingCollisionAlgorithm(ci,body0Wrap,body1Wrap),
 m_ownManifold(false),
@@ -64,8 +94,27 @@ void btBoxBoxCollisionAlgorithm::processCollision (const btCollisionObjectWrappe
 	input.m_transformA = body0Wrap->getWorldTransform();
 	input.m_transformB = body1Wrap->getWorldTransform();
 
-	btBoxBoxDetector detector(box0,box1);
-	detector.getClosestPoints(input,*resultOut,dispatchInfo.m_debugDraw);
+	//the box box detector only reports overlapping boxes, so a speculative contact of separated boxes comes from GJK
+	bool separated = false;
+	if (resultOut->m_closestPointDistanceThreshold > btScalar(0.))
+	{
+		btVoronoiSimplexSolver simplexSolver;
+		btGjkPairDetector gjkPairDetector(box0,box1,&simplexSolver,0);
+		btDiscreteCollisionDetectorInterface::ClosestPointInput gjkInput;
+		btScalar maximumDistance = box0->getMargin() + box1->getMargin() + m_manifoldPtr->getContactBreakingThreshold() + resultOut->m_closestPointDistanceThreshold;
+		gjkInput.m_maximumDistanceSquared = maximumDistance*maximumDistance;
+		gjkInput.m_transformA = input.m_transformA;
+		gjkInput.m_transformB = input.m_transformB;
+		btSeparatedBoxesResult separatedResult(resultOut);
+		gjkPairDetector.getClosestPoints(gjkInput,separatedResult,dispatchInfo.m_debugDraw);
+		separated = separatedResult.m_separated;
+	}
+
+	if (!separated)
+	{
+		btBoxBoxDetector detector(box0,box1);
+		detector.getClosestPoints(input,*resultOut,dispatchInfo.m_debugDraw);
+	}
 
 #ifdef USE_PERSISTENT_CONTACTS
 	//  refreshContactPoints is only necessary when using persistent contact points. otherwise all points are newly added
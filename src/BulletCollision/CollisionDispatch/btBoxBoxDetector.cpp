@@ -20,6 +20,7 @@ subject to the following restrictions:
 
 #include "btBoxBoxDetector.h"
 #include "BulletCollision/CollisionShapes/btBoxShape.h"
+#include "BulletCollision/NarrowPhaseCollision/btManifoldPoint.h"
 
 #include <float.h>
 #include <string.h>
@@ -116,8 +117,11 @@ void dLineClosestApproach (const btVector3& pa, const btVector3& ua,
 // the intersection points are returned as x,y pairs in the 'ret' array.
 // the number of intersection points is returned by the function (this will
 // be in the range 0 to 8).
+// 'rettag' receives the features of each point as incoming*8+outgoing line,
+// where the quad edges are lines 0..3 (edge k runs from corner k to k+1)
+// and the sides of the rectangle are lines 4..7.
 
-static int intersectRectQuad2 (btScalar h[2], btScalar p[8], btScalar ret[16])
+static int intersectRectQuad2 (btScalar h[2], btScalar p[8], btScalar ret[16], int rettag[8])
 {
   // q (and r) contain nq (and nr) coordinate points for the current (and
   // chopped) polygons
@@ -125,48 +129,64 @@ static int intersectRectQuad2 (btScalar h[2], btScalar p[8], btScalar ret[16])
   btScalar buffer[16];
   btScalar *q = p;
   btScalar *r = ret;
+  int quadtag[4] = {3*8+0, 0*8+1, 1*8+2, 2*8+3};
+  int buffertag[8];
+  int *tq = quadtag;
+  int *tr = rettag;
   for (int dir=0; dir <= 1; dir++) {
     // direction notation: xy[0] = x axis, xy[1] = y axis
     for (int sign=-1; sign <= 1; sign += 2) {
       // chop q along the line xy[dir] = sign*h[dir]
       btScalar *pq = q;
       btScalar *pr = r;
+      int *ptq = tq;
+      int line = 4 + dir*2 + (sign > 0);
       nr = 0;
       for (int i=nq; i > 0; i--) {
 	// go through all points in q and all lines between adjacent points
-	if (sign*pq[dir] < h[dir]) {
+	bool inside = sign*pq[dir] < h[dir];
+	if (inside) {
 	  // this point is inside the chopping line
 	  pr[0] = pq[0];
 	  pr[1] = pq[1];
+	  tr[nr] = *ptq;
 	  pr += 2;
 	  nr++;
 	  if (nr & 8) {
 	    q = r;
+	    tq = tr;
 	    goto done;
 	  }
 	}
 	btScalar *nextq = (i > 1) ? pq+2 : q;
-	if ((sign*pq[dir] < h[dir]) ^ (sign*nextq[dir] < h[dir])) {
+	if (inside ^ (sign*nextq[dir] < h[dir])) {
 	  // this line crosses the chopping line
 	  pr[1-dir] = pq[1-dir] + (nextq[1-dir]-pq[1-dir]) /
 	    (nextq[dir]-pq[dir]) * (sign*h[dir]-pq[dir]);
 	  pr[dir] = sign*h[dir];
+	  int edge = *ptq & 7;
+	  tr[nr] = inside ? edge*8+line : line*8+edge;
 	  pr += 2;
 	  nr++;
 	  if (nr & 8) {
 	    q = r;
+	    tq = tr;
 	    goto done;
 	  }
 	}
 	pq += 2;
+	ptq++;
       }
       q = r;
+      tq = tr;
       r = (q==ret) ? buffer : ret;
+      tr = (q==ret) ? buffertag : rettag;
       nq = nr;
     }
   }
  done:
   if (q != ret) memcpy (ret,q,nr*2*sizeof(btScalar));
+  if (tq != rettag) memcpy (rettag,tq,nr*sizeof(int));
   return nr;
 }
 
@@ -434,8 +454,10 @@ int dBoxBox2 (const btVector3& p1, const dMatrix3 R1,
 #ifdef USE_CENTER_POINT
 	    for (i=0; i<3; i++) 
 			pointInWorld[i] = (pa[i]+pb[i])*btScalar(0.5);
+		output.setFeatureId(btContactFeatureId(code,0,0));
 		output.addContactPoint(-normal,pointInWorld,-*depth);
 #else
+		output.setFeatureId(btContactFeatureId(code,0,0));
 		output.addContactPoint(-normal,pb,-*depth);
 
 #endif //
@@ -573,9 +595,14 @@ int dBoxBox2 (const btVector3& p1, const dMatrix3 R1,
 
   // intersect the incident and reference faces
   btScalar ret[16];
-  int n = intersectRectQuad2 (rect,quad,ret);
+  int rettag[8];
+  int n = intersectRectQuad2 (rect,quad,ret,rettag);
   if (n < 1) return 0;		// this should never happen
 
+  // the contacts are identified by the reference face, the incident face and
+  // the lines of the clipped polygon meeting at the point
+  int incidentFace = lanr*2 + (nr[lanr] < 0);
+
   // convert the intersection points into reference-face coordinates,
   // and compute the contact position and depth for each point. only keep
   // those points that have a positive (penetrating) depth. delete points in
@@ -597,6 +624,7 @@ int dBoxBox2 (const btVector3& p1, const dMatrix3 R1,
     if (dep[cnum] >= 0) {
       ret[cnum*2] = ret[j*2];
       ret[cnum*2+1] = ret[j*2+1];
+      rettag[cnum] = rettag[j];
       cnum++;
     }
   }
@@ -616,6 +644,7 @@ int dBoxBox2 (const btVector3& p1, const dMatrix3 R1,
 		btVector3 pointInWorld;
 		for (i=0; i<3; i++) 
 			pointInWorld[i] = point[j*3+i] + pa[i];
+		output.setFeatureId(btContactFeatureId(code,incidentFace,rettag[j]));
 		output.addContactPoint(-normal,pointInWorld,-dep[j]);
 
     }
@@ -628,6 +657,7 @@ int dBoxBox2 (const btVector3& p1, const dMatrix3 R1,
 			for (i=0; i<3; i++) 
 				pointInWorld[i] = point[j*3+i] + pa[i]-normal[i]*dep[j];
 				//pointInWorld[i] = point[j*3+i] + pa[i];
+			output.setFeatureId(btContactFeatureId(code,incidentFace,rettag[j]));
 			output.addContactPoint(-normal,pointInWorld,-dep[j]);
 		}
 	  }
@@ -655,6 +685,7 @@ int dBoxBox2 (const btVector3& p1, const dMatrix3 R1,
 		btVector3 posInWorld;
 		for (i=0; i<3; i++) 
 			posInWorld[i] = point[iret[j]*3+i] + pa[i];
+		output.setFeatureId(btContactFeatureId(code,incidentFace,rettag[iret[j]]));
 		if (code<4) 
 	   {
 			output.addContactPoint(-normal,posInWorld,-dep[iret[j]]);
@@ -0,0 +1,604 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btCapsuleCollisionAlgorithm.h"
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcher.h"
+#include "BulletCollision/CollisionShapes/btCapsuleShape.h"
+#include "BulletCollision/CollisionShapes/btSphereShape.h"
+#include "BulletCollision/CollisionShapes/btBoxShape.h"
+#include "BulletCollision/CollisionShapes/btTriangleShape.h"
+#include "BulletCollision/CollisionDispatch/btCollisionObject.h"
+#include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+
+///segments within this angle (sine squared) of being parallel touch along an interval
+#define BT_CAPSULE_PARALLEL_TOLERANCE btScalar(0.0025)
+///prefer box faces over edges of almost equal penetration, as btBoxBoxDetector does
+#define BT_CAPSULE_EDGE_FUDGE btScalar(1.05)
+
+btCapsuleCollisionAlgorithm::btCapsuleCollisionAlgorithm(btPersistentManifold* mf,const btCollisionAlgorithmConstructionInfo& ci,const btCollisionObjectWrapper* body0Wrap,const btCollisionObjectWrapper* body1Wrap,bool swapped)
+: btActivatingCollisionAlgorithm(ci,body0Wrap,body1Wrap),
+m_ownManifold(false),
+m_manifoldPtr(mf),
+m_swapped(swapped)
+{
+	if (!m_manifoldPtr)
+	{
+		m_manifoldPtr = m_dispatcher->getNewManifold(body0Wrap->getCollisionObject(),body1Wrap->getCollisionObject());
+		m_ownManifold = true;
+	}
+}
+
+btCapsuleCollisionAlgorithm::~btCapsuleCollisionAlgorithm()
+{
+	if (m_ownManifold)
+	{
+		if (m_manifoldPtr)
+			m_dispatcher->releaseManifold(m_manifoldPtr);
+	}
+}
+
+///the segment and radius of a capsule, or the center and radius of a sphere
+static void	btGetCapsuleSegment(const btCollisionObjectWrapper* wrap, btVector3& p0, btVector3& p1, btScalar& radius)
+{
+	const btTransform& tr = wrap->getWorldTransform();
+	if (wrap->getCollisionShape()->getShapeType() == CAPSULE_SHAPE_PROXYTYPE)
+	{
+		const btCapsuleShape* capsule = (const btCapsuleShape*)wrap->getCollisionShape();
+		btVector3 halfAxis = tr.getBasis().getColumn(capsule->getUpAxis()) * capsule->getHalfHeight();
+		p0 = tr.getOrigin() - halfAxis;
+		p1 = tr.getOrigin() + halfAxis;
+		radius = capsule->getRadius();
+	} else
+	{
+		const btSphereShape* sphere = (const btSphereShape*)wrap->getCollisionShape();
+		p0 = p1 = tr.getOrigin();
+		radius = sphere->getRadius();
+	}
+}
+
+///contacts are computed with the normal pointing from the other shape towards the capsule, and the point on the other shape
+static SIMD_FORCE_INLINE void	btAddCapsuleContact(btManifoldResult* resultOut, bool swapped, const btVector3& normalOnOther, const btVector3& pointOnOther, btScalar distance)
+{
+	if (swapped)
+	{
+		resultOut->addContactPoint(-normalOnOther,pointOnOther+normalOnOther*distance,distance);
+	} else
+	{
+		resultOut->addContactPoint(normalOnOther,pointOnOther,distance);
+	}
+}
+
+///closest points c1=p1+s*(q1-p1) and c2=p2+t*(q2-p2) of two segments, returns their squared distance
+static btScalar	btClosestPointsSegmentSegment(const btVector3& p1, const btVector3& q1, const btVector3& p2, const btVector3& q2, btVector3& c1, btVector3& c2)
+{
+	btVector3 d1 = q1-p1;
+	btVector3 d2 = q2-p2;
+	btVector3 r = p1-p2;
+	btScalar a = d1.length2();
+	btScalar e = d2.length2();
+	btScalar f = d2.dot(r);
+	btScalar s = btScalar(0.);
+	btScalar t = btScalar(0.);
+
+	if (a > SIMD_EPSILON)
+	{
+		btScalar c = d1.dot(r);
+		if (e > SIMD_EPSILON)
+		{
+			btScalar b = d1.dot(d2);
+			btScalar denom = a*e-b*b;
+			if (denom != btScalar(0.))
+				s = btClamped((b*f-c*e)/denom,btScalar(0.),btScalar(1.));
+			t = (b*s+f)/e;
+			if (t < btScalar(0.))
+			{
+				t = btScalar(0.);
+				s = btClamped(-c/a,btScalar(0.),btScalar(1.));
+			} else if (t > btScalar(1.))
+			{
+				t = btScalar(1.);
+				s = btClamped((b-c)/a,btScalar(0.),btScalar(1.));
+			}
+		} else
+		{
+			s = btClamped(-c/a,btScalar(0.),btScalar(1.));
+		}
+	} else if (e > SIMD_EPSILON)
+	{
+		t = btClamped(f/e,btScalar(0.),btScalar(1.));
+	}
+
+	c1 = p1 + d1*s;
+	c2 = p2 + d2*t;
+	return (c1-c2).length2();
+}
+
+static void	btCollideCapsuleCapsule(const btVector3& a0, const btVector3& a1, btScalar radiusA,
+	const btVector3& b0, const btVector3& b1, btScalar radiusB,
+	btScalar threshold, btManifoldResult* resultOut, bool swapped)
+{
+	btVector3 pointA,pointB;
+	btScalar dist2 = btClosestPointsSegmentSegment(a0,a1,b0,b1,pointA,pointB);
+	btScalar radius = radiusA+radiusB;
+	if (dist2 > (radius+threshold)*(radius+threshold))
+		return;
+
+	btScalar dist = btSqrt(dist2);
+	btVector3 dirA = a1-a0;
+	btVector3 dirB = b1-b0;
+	btVector3 normal(btScalar(1.),btScalar(0.),btScalar(0.));
+	if (dist > SIMD_EPSILON)
+	{
+		normal = (pointA-pointB)/dist;
+	} else
+	{
+		//the segments intersect, any direction perpendicular to them separates
+		btVector3 q;
+		btVector3 cross = dirA.cross(dirB);
+		if (cross.length2() > SIMD_EPSILON)
+			normal = cross.normalized();
+		else if (dirA.length2() > SIMD_EPSILON)
+			btPlaneSpace1(dirA,normal,q);
+		else if (dirB.length2() > SIMD_EPSILON)
+			btPlaneSpace1(dirB,normal,q);
+	}
+
+	//parallel segments touch along the overlap of A with the projection of B, report both of its ends
+	btScalar lenA2 = dirA.length2();
+	btScalar lenB2 = dirB.length2();
+	if (lenA2 > SIMD_EPSILON && lenB2 > SIMD_EPSILON && dirA.cross(dirB).length2() < BT_CAPSULE_PARALLEL_TOLERANCE*lenA2*lenB2)
+	{
+		btScalar t0 = (b0-a0).dot(dirA)/lenA2;
+		btScalar t1 = (b1-a0).dot(dirA)/lenA2;
+		btScalar lo = btMax(btScalar(0.),btMin(t0,t1));
+		btScalar hi = btMin(btScalar(1.),btMax(t0,t1));
+		if (hi > lo && (hi-lo)*(hi-lo)*lenA2 > SIMD_EPSILON)
+		{
+			for (int i=0;i<2;i++)
+			{
+				btVector3 endA = a0 + dirA*(i ? hi : lo);
+				btVector3 endB = b0 + dirB*btClamped((endA-b0).dot(dirB)/lenB2,btScalar(0.),btScalar(1.));
+				btVector3 diff = endA-endB;
+				btScalar len = diff.length();
+				btVector3 endNormal = len > SIMD_EPSILON ? diff/len : normal;
+				if (len-radius < threshold)
+					btAddCapsuleContact(resultOut,swapped,endNormal,endB+endNormal*radiusB,len-radius);
+			}
+			return;
+		}
+	}
+
+	btAddCapsuleContact(resultOut,swapped,normal,pointB+normal*radiusB,dist-radius);
+}
+
+///clips the segment a+t*d, t in [0,1], in box space to the face of axis k on side sign, and reports its ends. Returns the number of contacts.
+static int	btClipCapsuleBoxFace(const btVector3& a, const btVector3& d, const btVector3& halfExtents, int k, btScalar sign,
+	btScalar radius, const btTransform& boxTrans, btScalar threshold, btManifoldResult* resultOut, bool swapped)
+{
+	btScalar lo = btScalar(0.);
+	btScalar hi = btScalar(1.);
+	for (int j=0;j<3;j++)
+	{
+		if (j == k)
+			continue;
+		if (d[j] == btScalar(0.))
+		{
+			if (btFabs(a[j]) > halfExtents[j])
+				return 0;
+			continue;
+		}
+		btScalar t0 = (-halfExtents[j]-a[j])/d[j];
+		btScalar t1 = (halfExtents[j]-a[j])/d[j];
+		lo = btMax(lo,btMin(t0,t1));
+		hi = btMin(hi,btMax(t0,t1));
+	}
+	if (lo > hi)
+		return 0;
+
+	btVector3 normal = boxTrans.getBasis().getColumn(k)*sign;
+	int numContacts = 0;
+	for (int i=0;i<2;i++)
+	{
+		if (i && (hi-lo)*(hi-lo)*d.length2() <= SIMD_EPSILON)
+			break;
+		btVector3 point = a + d*(i ? hi : lo);
+		btScalar dist = sign*point[k] - halfExtents[k] - radius;
+		if (dist < threshold)
+		{
+			point[k] = sign*halfExtents[k];
+			btAddCapsuleContact(resultOut,swapped,normal,boxTrans(point),dist);
+			numContacts++;
+		}
+	}
+	return numContacts;
+}
+
+static void	btCollideCapsuleBox(const btVector3& a0, const btVector3& a1, btScalar radius, const btBoxShape* box, const btTransform& boxTrans,
+	btScalar threshold, btManifoldResult* resultOut, bool swapped)
+{
+	const btVector3 halfExtents = box->getHalfExtentsWithMargin();
+	const btVector3 a = boxTrans.invXform(a0);
+	const btVector3 d = boxTrans.invXform(a1) - a;
+
+	//the squared distance from a+t*d to the box is a convex piecewise quadratic in t,
+	//with a new piece wherever a coordinate crosses a face plane. Minimize each piece in closed form.
+	btScalar ts[8];
+	int numTs = 0;
+	ts[numTs++] = btScalar(0.);
+	ts[numTs++] = btScalar(1.);
+	for (int i=0;i<3;i++)
+	{
+		if (d[i] == btScalar(0.))
+			continue;
+		for (int s=-1;s<=1;s+=2)
+		{
+			btScalar t = (s*halfExtents[i]-a[i])/d[i];
+			if (t > btScalar(0.) && t < btScalar(1.))
+			{
+				int j = numTs++;
+				for (;ts[j-1] > t;j--)
+					ts[j] = ts[j-1];
+				ts[j] = t;
+			}
+		}
+	}
+
+	btScalar bestDist2 = BT_LARGE_FLOAT;
+	btScalar bestT = btScalar(0.);
+	for (int k=0;k+1<numTs;k++)
+	{
+		btScalar mid = btScalar(0.5)*(ts[k]+ts[k+1]);
+		btScalar num = btScalar(0.);
+		btScalar den = btScalar(0.);
+		for (int i=0;i<3;i++)
+		{
+			btScalar p = a[i]+mid*d[i];
+			if (btFabs(p) > halfExtents[i])
+			{
+				btScalar c = p > btScalar(0.) ? halfExtents[i] : -halfExtents[i];
+				num += (a[i]-c)*d[i];
+				den += d[i]*d[i];
+			}
+		}
+		btScalar t = den > btScalar(0.) ? btClamped(-num/den,ts[k],ts[k+1]) : mid;
+		btVector3 p = a + d*t;
+		btVector3 q(btClamped(p[0],-halfExtents[0],halfExtents[0]),
+			btClamped(p[1],-halfExtents[1],halfExtents[1]),
+			btClamped(p[2],-halfExtents[2],halfExtents[2]));
+		btScalar dist2 = (p-q).length2();
+		if (dist2 < bestDist2)
+		{
+			bestDist2 = dist2;
+			bestT = t;
+		}
+	}
+
+	if (bestDist2 > (radius+threshold)*(radius+threshold))
+		return;
+
+	if (bestDist2 > SIMD_EPSILON*SIMD_EPSILON)
+	{
+		//the segment is outside the box: the closest point on a face gets clipped contacts, an edge or vertex one contact
+		btVector3 p = a + d*bestT;
+		btVector3 q;
+		int numOutside = 0;
+		int faceAxis = 0;
+		for (int i=0;i<3;i++)
+		{
+			q[i] = btClamped(p[i],-halfExtents[i],halfExtents[i]);
+			if (btFabs(p[i]) > halfExtents[i])
+			{
+				numOutside++;
+				faceAxis = i;
+			}
+		}
+		if (numOutside == 1 && btClipCapsuleBoxFace(a,d,halfExtents,faceAxis,p[faceAxis] > btScalar(0.) ? btScalar(1.) : btScalar(-1.),radius,boxTrans,threshold,resultOut,swapped))
+			return;
+
+		btScalar dist = btSqrt(bestDist2);
+		btVector3 normal = boxTrans.getBasis()*((p-q)/dist);
+		btAddCapsuleContact(resultOut,swapped,normal,boxTrans(q),dist-radius);
+		return;
+	}
+
+	//the segment intersects the box: find the axis of least penetration among the face normals and the
+	//segment direction crossed with the edge directions
+	btScalar bestOverlap = BT_LARGE_FLOAT;
+	btVector3 bestAxis(btScalar(0.),btScalar(0.),btScalar(0.));
+	int bestFace = -1;
+	int bestEdge = -1;
+	for (int i=0;i<3;i++)
+	{
+		btScalar p0 = a[i];
+		btScalar p1 = a[i]+d[i];
+		btScalar overlapPositive = halfExtents[i] - btMin(p0,p1);
+		btScalar overlapNegative = btMax(p0,p1) + halfExtents[i];
+		btScalar overlap = btMin(overlapPositive,overlapNegative);
+		if (overlap < bestOverlap)
+		{
+			bestOverlap = overlap;
+			bestAxis.setValue(btScalar(0.),btScalar(0.),btScalar(0.));
+			bestAxis[i] = overlapPositive <= overlapNegative ? btScalar(1.) : btScalar(-1.);
+			bestFace = i;
+		}
+	}
+	for (int i=0;i<3;i++)
+	{
+		btVector3 edgeDir(btScalar(0.),btScalar(0.),btScalar(0.));
+		edgeDir[i] = btScalar(1.);
+		btVector3 axis = d.cross(edgeDir);
+		btScalar len2 = axis.length2();
+		if (len2 <= SIMD_EPSILON*d.length2())
+			continue;
+		axis /= btSqrt(len2);
+		//the segment projects to a single point on an axis perpendicular to it
+		btScalar boxRadius = halfExtents.dot(axis.absolute());
+		btScalar p = a.dot(axis);
+		btScalar overlapPositive = boxRadius - p;
+		btScalar overlapNegative = p + boxRadius;
+		btScalar overlap = btMin(overlapPositive,overlapNegative);
+		if (overlap*BT_CAPSULE_EDGE_FUDGE < bestOverlap)
+		{
+			bestOverlap = overlap;
+			bestAxis = overlapPositive <= overlapNegative ? axis : -axis;
+			bestFace = -1;
+			bestEdge = i;
+		}
+	}
+
+	if (bestFace >= 0)
+	{
+		if (btClipCapsuleBoxFace(a,d,halfExtents,bestFace,bestAxis[bestFace],radius,boxTrans,threshold,resultOut,swapped))
+			return;
+		btVector3 q = a + d*bestT;
+		q[bestFace] = bestAxis[bestFace]*halfExtents[bestFace];
+		btAddCapsuleContact(resultOut,swapped,boxTrans.getBasis()*bestAxis,boxTrans(q),-bestOverlap-radius);
+		return;
+	}
+
+	//edge contact, with the box edge along bestEdge that is furthest in the direction of the axis
+	btVector3 edgeCenter;
+	for (int i=0;i<3;i++)
+	{
+		edgeCenter[i] = i == bestEdge ? btScalar(0.) : (bestAxis[i] > btScalar(0.) ? halfExtents[i] : -halfExtents[i]);
+	}
+	btVector3 edgeHalf(btScalar(0.),btScalar(0.),btScalar(0.));
+	edgeHalf[bestEdge] = halfExtents[bestEdge];
+	btVector3 pointOnSegment,pointOnEdge;
+	btClosestPointsSegmentSegment(a,a+d,edgeCenter-edgeHalf,edgeCenter+edgeHalf,pointOnSegment,pointOnEdge);
+	btAddCapsuleContact(resultOut,swapped,boxTrans.getBasis()*bestAxis,boxTrans(pointOnEdge),-bestOverlap-radius);
+}
+
+///closest point on the triangle v0,v1,v2 to p
+static btVector3	btClosestPointTriangle(const btVector3& p, const btVector3& v0, const btVector3& v1, const btVector3& v2)
+{
+	btVector3 ab = v1-v0;
+	btVector3 ac = v2-v0;
+	btVector3 ap = p-v0;
+	btScalar d1 = ab.dot(ap);
+	btScalar d2 = ac.dot(ap);
+	if (d1 <= btScalar(0.) && d2 <= btScalar(0.))
+		return v0;
+
+	btVector3 bp = p-v1;
+	btScalar d3 = ab.dot(bp);
+	btScalar d4 = ac.dot(bp);
+	if (d3 >= btScalar(0.) && d4 <= d3)
+		return v1;
+
+	btScalar vc = d1*d4 - d3*d2;
+	if (vc <= btScalar(0.) && d1 >= btScalar(0.) && d3 <= btScalar(0.))
+		return v0 + ab*(d1/(d1-d3));
+
+	btVector3 cp = p-v2;
+	btScalar d5 = ab.dot(cp);
+	btScalar d6 = ac.dot(cp);
+	if (d6 >= btScalar(0.) && d5 <= d6)
+		return v2;
+
+	btScalar vb = d5*d2 - d1*d6;
+	if (vb <= btScalar(0.) && d2 >= btScalar(0.) && d6 <= btScalar(0.))
+		return v0 + ac*(d2/(d2-d6));
+
+	btScalar va = d3*d6 - d5*d4;
+	if (va <= btScalar(0.) && (d4-d3) >= btScalar(0.) && (d5-d6) >= btScalar(0.))
+		return v1 + (v2-v1)*((d4-d3)/((d4-d3)+(d5-d6)));
+
+	btScalar denom = btScalar(1.)/(va+vb+vc);
+	return v0 + ab*(vb*denom) + ac*(vc*denom);
+}
+
+///clips the segment a0+t*d, t in [0,1], to the prism over the triangle and reports its ends against the face with normal faceNormal.
+///Returns the number of contacts.
+static int	btClipCapsuleTriangleFace(const btVector3& a0, const btVector3& d, const btVector3* vertices, const btVector3& triangleNormal,
+	const btVector3& faceNormal, btScalar radius, btScalar margin, btScalar threshold, btManifoldResult* resultOut, bool swapped)
+{
+	btScalar lo = btScalar(0.);
+	btScalar hi = btScalar(1.);
+	for (int i=0;i<3;i++)
+	{
+		btVector3 inward = triangleNormal.cross(vertices[(i+1)%3]-vertices[i]);
+		btScalar dist = (a0-vertices[i]).dot(inward);
+		btScalar rate = d.dot(inward);
+		if (rate == btScalar(0.))
+		{
+			if (dist < btScalar(0.))
+				return 0;
+			continue;
+		}
+		btScalar t = -dist/rate;
+		if (rate > btScalar(0.))
+			lo = btMax(lo,t);
+		else
+			hi = btMin(hi,t);
+	}
+	if (lo > hi)
+		return 0;
+
+	int numContacts = 0;
+	for (int i=0;i<2;i++)
+	{
+		if (i && (hi-lo)*(hi-lo)*d.length2() <= SIMD_EPSILON)
+			break;
+		btVector3 point = a0 + d*(i ? hi : lo);
+		btScalar height = (point-vertices[0]).dot(faceNormal);
+		btScalar dist = height - radius - margin;
+		if (dist < threshold)
+		{
+			btAddCapsuleContact(resultOut,swapped,faceNormal,point-faceNormal*(height-margin),dist);
+			numContacts++;
+		}
+	}
+	return numContacts;
+}
+
+static void	btCollideCapsuleTriangle(const btVector3& a0, const btVector3& a1, btScalar radius, const btTriangleShape* triangle, const btTransform& triTrans,
+	btScalar threshold, btManifoldResult* resultOut, bool swapped)
+{
+	btVector3 vertices[3];
+	for (int i=0;i<3;i++)
+	{
+		vertices[i] = triTrans(triangle->m_vertices1[i]);
+	}
+	btVector3 triangleNormal = (vertices[1]-vertices[0]).cross(vertices[2]-vertices[0]);
+	if (triangleNormal.length2() <= SIMD_EPSILON*SIMD_EPSILON)
+		return;
+	triangleNormal.normalize();
+	//the triangle margin rounds it, as in the convex-convex algorithm
+	btScalar margin = triangle->getMargin();
+	btScalar totalRadius = radius + margin;
+	btVector3 d = a1-a0;
+
+	//closest points: the segment ends against the triangle, the segment against the edges, or the segment crossing the triangle
+	btVector3 pointOnSegment = a0;
+	btVector3 pointOnTriangle = btClosestPointTriangle(a0,vertices[0],vertices[1],vertices[2]);
+	btScalar bestDist2 = (pointOnSegment-pointOnTriangle).length2();
+	btVector3 q = btClosestPointTriangle(a1,vertices[0],vertices[1],vertices[2]);
+	if ((a1-q).length2() < bestDist2)
+	{
+		bestDist2 = (a1-q).length2();
+		pointOnSegment = a1;
+		pointOnTriangle = q;
+	}
+	for (int i=0;i<3;i++)
+	{
+		btVector3 p;
+		btScalar dist2 = btClosestPointsSegmentSegment(a0,a1,vertices[i],vertices[(i+1)%3],p,q);
+		if (dist2 < bestDist2)
+		{
+			bestDist2 = dist2;
+			pointOnSegment = p;
+			pointOnTriangle = q;
+		}
+	}
+	btScalar height0 = (a0-vertices[0]).dot(triangleNormal);
+	btScalar height1 = (a1-vertices[0]).dot(triangleNormal);
+	if (height0*height1 <= btScalar(0.) && height0 != height1)
+	{
+		btVector3 crossing = a0 + d*(height0/(height0-height1));
+		bool inside = true;
+		for (int i=0;i<3 && inside;i++)
+		{
+			inside = (crossing-vertices[i]).dot(triangleNormal.cross(vertices[(i+1)%3]-vertices[i])) >= btScalar(0.);
+		}
+		if (inside)
+		{
+			bestDist2 = btScalar(0.);
+			pointOnSegment = pointOnTriangle = crossing;
+		}
+	}
+
+	if (bestDist2 > (totalRadius+threshold)*(totalRadius+threshold))
+		return;
+
+	if (bestDist2 > SIMD_EPSILON*SIMD_EPSILON)
+	{
+		btScalar dist = btSqrt(bestDist2);
+		btVector3 normal = (pointOnSegment-pointOnTriangle)/dist;
+		btScalar normalDotFace = normal.dot(triangleNormal);
+		//closest to the inside of the face: clip the segment to the face
+		if (btFabs(normalDotFace) > btScalar(0.9999))
+		{
+			btVector3 faceNormal = normalDotFace > btScalar(0.) ? triangleNormal : -triangleNormal;
+			if (btClipCapsuleTriangleFace(a0,d,vertices,triangleNormal,faceNormal,radius,margin,threshold,resultOut,swapped))
+				return;
+		}
+		btAddCapsuleContact(resultOut,swapped,normal,pointOnTriangle+normal*margin,dist-totalRadius);
+		return;
+	}
+
+	//the segment crosses the triangle, push it out along the face normal on the side of its center
+	btVector3 faceNormal = height0+height1 >= btScalar(0.) ? triangleNormal : -triangleNormal;
+	if (btClipCapsuleTriangleFace(a0,d,vertices,triangleNormal,faceNormal,radius,margin,threshold,resultOut,swapped))
+		return;
+	btAddCapsuleContact(resultOut,swapped,faceNormal,pointOnTriangle+faceNormal*margin,-totalRadius);
+}
+
+void btCapsuleCollisionAlgorithm::processCollision (const btCollisionObjectWrapper* body0Wrap,const btCollisionObjectWrapper* body1Wrap,const btDispatcherInfo& dispatchInfo,btManifoldResult* resultOut)
+{
+	(void)dispatchInfo;
+
+	if (!m_manifoldPtr)
+		return;
+
+	const btCollisionObjectWrapper* capsuleWrap = m_swapped ? body1Wrap : body0Wrap;
+	const btCollisionObjectWrapper* otherWrap = m_swapped ? body0Wrap : body1Wrap;
+
+	resultOut->setPersistentManifold(m_manifoldPtr);
+	btScalar threshold = m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold;
+
+	btVector3 a0,a1;
+	btScalar radius;
+	btGetCapsuleSegment(capsuleWrap,a0,a1,radius);
+
+	switch (otherWrap->getCollisionShape()->getShapeType())
+	{
+	case CAPSULE_SHAPE_PROXYTYPE:
+	case SPHERE_SHAPE_PROXYTYPE:
+		{
+			btVector3 b0,b1;
+			btScalar radiusB;
+			btGetCapsuleSegment(otherWrap,b0,b1,radiusB);
+			btCollideCapsuleCapsule(a0,a1,radius,b0,b1,radiusB,threshold,resultOut,m_swapped);
+			break;
+		}
+	case BOX_SHAPE_PROXYTYPE:
+		{
+			btCollideCapsuleBox(a0,a1,radius,(const btBoxShape*)otherWrap->getCollisionShape(),otherWrap->getWorldTransform(),threshold,resultOut,m_swapped);
+			break;
+		}
+	case TRIANGLE_SHAPE_PROXYTYPE:
+		{
+			btCollideCapsuleTriangle(a0,a1,radius,(const btTriangleShape*)otherWrap->getCollisionShape(),otherWrap->getWorldTransform(),threshold,resultOut,m_swapped);
+			break;
+		}
+	default:
+		btAssert(0);
+	}
+
+	if (m_ownManifold)
+		resultOut->refreshContactPoints();
+}
+
+btScalar btCapsuleCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* body0,btCollisionObject* body1,const btDispatcherInfo& dispatchInfo,btManifoldResult* resultOut)
+{
+	(void)resultOut;
+	(void)dispatchInfo;
+	(void)body0;
+	(void)body1;
+
+	//not yet
+	return btScalar(1.);
+}
@@ -26,6 +26,7 @@ subject to the following restrictions:
 #include "LinearMath/btPoolAllocator.h"
 #include "BulletCollision/CollisionDispatch/btCollisionConfiguration.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+#include "LinearMath/btTransformUtil.h"
 
 int gNumManifold = 0;
 
@@ -91,10 +92,16 @@ btPersistentManifold*	btCollisionDispatcher::getNewManifold(const btCollisionObj
 		mem = m_persistentManifoldPoolAllocator->allocate(sizeof(btPersistentManifold));
 	} else
 	{
-		//we got a pool memory overflow, by default we fallback to dynamically allocate memory. If we require a contiguous contact pool then assert.
+		//we got a pool memory overflow, by default we grow the pool or fallback to dynamically allocate memory. If we require a contiguous contact pool then assert.
 		if ((m_dispatcherFlags&CD_DISABLE_CONTACTPOOL_DYNAMIC_ALLOCATION)==0)
 		{
-			mem = btAlignedAlloc(sizeof(btPersistentManifold),16);
+			if (m_persistentManifoldPoolAllocator->canAllocate())
+			{
+				mem = m_persistentManifoldPoolAllocator->allocate(sizeof(btPersistentManifold));
+			} else
+			{
+				mem = btAlignedAlloc(sizeof(btPersistentManifold),16);
+			}
 		} else
 		{
 			btAssert(0);
@@ -241,7 +248,7 @@ void	btCollisionDispatcher::dispatchAllCollisionPairs(btOverlappingPairCache* pa
 
 	btCollisionPairCallback	collisionCallback(dispatchInfo,this);
 
-	pairCache->processAllOverlappingPairs(&collisionCallback,dispatcher);
+	pairCache->processAllOverlappingPairs(&collisionCallback,dispatcher,dispatchInfo);
 
 	//m_blockedForChanges = false;
 
@@ -250,6 +257,25 @@ void	btCollisionDispatcher::dispatchAllCollisionPairs(btOverlappingPairCache* pa
 
 
 
+///bound on the distance any point of a dynamic rigid body travels from its world transform to its interpolation transform
+static btScalar	btPredictedMotion(const btCollisionObject* colObj)
+{
+	if (colObj->getInternalType()!=btCollisionObject::CO_RIGID_BODY || colObj->isStaticOrKinematicObject())
+		return btScalar(0.);
+
+	const btTransform& fromTrans = colObj->getWorldTransform();
+	const btTransform& toTrans = colObj->getInterpolationWorldTransform();
+	btScalar motion = (toTrans.getOrigin()-fromTrans.getOrigin()).length();
+	btVector3 axis;
+	btScalar angle;
+	btTransformUtil::calculateDiffAxisAngle(fromTrans,toTrans,axis,angle);
+	if (angle > SIMD_EPSILON)
+	{
+		motion += angle*colObj->getCollisionShape()->getAngularMotionDisc();
+	}
+	return motion;
+}
+
 //by default, Bullet will use this near callback
 void btCollisionDispatcher::defaultNearCallback(btBroadphasePair& collisionPair, btCollisionDispatcher& dispatcher, const btDispatcherInfo& dispatchInfo)
 {
@@ -271,6 +297,15 @@ void btCollisionDispatcher::defaultNearCallback(btBroadphasePair& collisionPair,
 			if (collisionPair.m_algorithm)
 			{
 				btManifoldResult contactPointResult(&obj0Wrap,&obj1Wrap);
+				if (dispatchInfo.m_useSpeculativeContacts)
+				{
+					contactPointResult.m_closestPointDistanceThreshold = btPredictedMotion(colObj0) + btPredictedMotion(colObj1);
+				}
+
+				if (dispatchInfo.m_narrowphaseCallCounts)
+				{
+					dispatchInfo.m_narrowphaseCallCounts[obj0Wrap.getCollisionShape()->getShapeType()*MAX_BROADPHASE_COLLISION_TYPES+obj1Wrap.getCollisionShape()->getShapeType()]++;
+				}
 				
 				if (dispatchInfo.m_dispatchFunc == 		btDispatcherInfo::DISPATCH_DISCRETE)
 				{
@@ -293,7 +328,7 @@ void btCollisionDispatcher::defaultNearCallback(btBroadphasePair& collisionPair,
 
 void* btCollisionDispatcher::allocateCollisionAlgorithm(int size)
 {
-	if (m_collisionAlgorithmPoolAllocator->getFreeCount())
+	if (m_collisionAlgorithmPoolAllocator->canAllocate() && size<=m_collisionAlgorithmPoolAllocator->getElementSize())
 	{
 		return m_collisionAlgorithmPoolAllocator->allocate(size);
 	}
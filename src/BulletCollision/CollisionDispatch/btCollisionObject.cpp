@@ -39,7 +39,8 @@ btCollisionObject::btCollisionObject()
 		m_ccdSweptSphereRadius(btScalar(0.)),
 		m_ccdMotionThreshold(btScalar(0.)),
 		m_checkCollideWith(false),
-		m_updateRevision(0)
+		m_updateRevision(0),
+		m_worldArrayIndex(-1)
 {
 	m_worldTransform.setIdentity();
 }
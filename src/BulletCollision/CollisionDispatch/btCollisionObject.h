@@ -113,6 +113,9 @@ protected:
 	///internal update revision number. It will be increased when the object changes. This allows some subsystems to perform lazy evaluation.
 	int			m_updateRevision;
 
+	///index of this object in the collision object array of its btCollisionWorld, -1 when it is not in a world
+	int			m_worldArrayIndex;
+
 	virtual bool	checkCollideWithOverride(const btCollisionObject* /* co */) const
 	{
 		return true;
@@ -469,6 +472,17 @@ public:
 		return m_updateRevision;
 	}
 
+	int	getWorldArrayIndex() const
+	{
+		return m_worldArrayIndex;
+	}
+
+	///only used by btCollisionWorld, to keep track of the position in its collision object array
+	void	setWorldArrayIndex(int index)
+	{
+		m_worldArrayIndex = index;
+	}
+
 
 	inline bool checkCollideWith(const btCollisionObject* co) const
 	{
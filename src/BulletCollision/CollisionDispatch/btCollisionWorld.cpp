@@ -116,6 +116,7 @@ void	btCollisionWorld::addCollisionObject(btCollisionObject* collisionObject,sho
 	//check that the object isn't already added
 	btAssert( m_collisionObjects.findLinearSearch(collisionObject)  == m_collisionObjects.size());
 
+	collisionObject->setWorldArrayIndex(m_collisionObjects.size());
 	m_collisionObjects.push_back(collisionObject);
 
 	//calculate new AABB
@@ -153,7 +154,7 @@ void	btCollisionWorld::updateSingleAabb(btCollisionObject* colObj)
 	minAabb -= contactThreshold;
 	maxAabb += contactThreshold;
 
-	if(getDispatchInfo().m_useContinuous && colObj->getInternalType()==btCollisionObject::CO_RIGID_BODY && !colObj->isStaticOrKinematicObject())
+	if((getDispatchInfo().m_useContinuous || getDispatchInfo().m_useSpeculativeContacts) && colObj->getInternalType()==btCollisionObject::CO_RIGID_BODY && !colObj->isStaticOrKinematicObject())
 	{
 		btVector3 minAabb2,maxAabb2;
 		colObj->getCollisionShape()->getAabb(colObj->getInterpolationWorldTransform(),minAabb2,maxAabb2);
@@ -254,7 +255,18 @@ void	btCollisionWorld::removeCollisionObject(btCollisionObject* collisionObject)
 
 
 	//swapremove
-	m_collisionObjects.remove(collisionObject);
+	int index = collisionObject->getWorldArrayIndex();
+	if (index >= 0 && index < m_collisionObjects.size() && m_collisionObjects[index] == collisionObject)
+	{
+		m_collisionObjects.swap(index,m_collisionObjects.size()-1);
+		m_collisionObjects.pop_back();
+		if (index < m_collisionObjects.size())
+			m_collisionObjects[index]->setWorldArrayIndex(index);
+	} else
+	{
+		m_collisionObjects.remove(collisionObject);
+	}
+	collisionObject->setWorldArrayIndex(-1);
 
 }
 
@@ -1112,6 +1124,8 @@ struct btBridgedManifoldResult : public btManifoldResult
 			newPt.m_index0  = m_index0;
 			newPt.m_index1  = m_index1;
 		}
+		newPt.m_featureId = m_featureId;
+		m_featureId = 0;
 
 		//experimental feature info, for per-triangle material etc.
 		const btCollisionObjectWrapper* obj0Wrap = isSwapped? m_body1Wrap : m_body0Wrap;
@@ -1491,7 +1505,7 @@ void	btCollisionWorld::debugDrawWorld()
 
 					btVector3 minAabb2,maxAabb2;
 
-					if(getDispatchInfo().m_useContinuous && colObj->getInternalType()==btCollisionObject::CO_RIGID_BODY && !colObj->isStaticOrKinematicObject())
+					if((getDispatchInfo().m_useContinuous || getDispatchInfo().m_useSpeculativeContacts) && colObj->getInternalType()==btCollisionObject::CO_RIGID_BODY && !colObj->isStaticOrKinematicObject())
 					{
 						colObj->getCollisionShape()->getAabb(colObj->getInterpolationWorldTransform(),minAabb2,maxAabb2);
 						minAabb2 -= contactThreshold;
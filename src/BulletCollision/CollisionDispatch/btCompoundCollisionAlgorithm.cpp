@@ -20,6 +20,7 @@ subject to the following restrictions:
 #include "BulletCollision/BroadphaseCollision/btDbvt.h"
 #include "LinearMath/btIDebugDraw.h"
 #include "LinearMath/btAabbUtil2.h"
+#include "LinearMath/btInlineObjectArray.h"
 #include "btManifoldResult.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
 
@@ -131,6 +132,9 @@ public:
 		btVector3 aabbMin0,aabbMax0,aabbMin1,aabbMax1;
 		childShape->getAabb(newChildWorldTrans,aabbMin0,aabbMax0);
 		m_otherObjWrap->getCollisionShape()->getAabb(m_otherObjWrap->getWorldTransform(),aabbMin1,aabbMax1);
+		btVector3 extra(m_resultOut->m_closestPointDistanceThreshold,m_resultOut->m_closestPointDistanceThreshold,m_resultOut->m_closestPointDistanceThreshold);
+		aabbMin1 -= extra;
+		aabbMax1 += extra;
 
 		if (gCompoundChildShapePairCallback)
 		{
@@ -242,7 +246,7 @@ void btCompoundCollisionAlgorithm::processCollision (const btCollisionObjectWrap
 	///so we should add a 'refreshManifolds' in the btCollisionAlgorithm
 	{
 		int i;
-		btManifoldArray manifoldArray;
+		btInlineObjectArray<btPersistentManifold*,16> manifoldArray;
 		for (i=0;i<m_childCollisionAlgorithms.size();i++)
 		{
 			if (m_childCollisionAlgorithms[i])
@@ -269,6 +273,9 @@ void btCompoundCollisionAlgorithm::processCollision (const btCollisionObjectWrap
 		btTransform otherInCompoundSpace;
 		otherInCompoundSpace = colObjWrap->getWorldTransform().inverse() * otherObjWrap->getWorldTransform();
 		otherObjWrap->getCollisionShape()->getAabb(otherInCompoundSpace,localAabbMin,localAabbMax);
+		btVector3 extra(resultOut->m_closestPointDistanceThreshold,resultOut->m_closestPointDistanceThreshold,resultOut->m_closestPointDistanceThreshold);
+		localAabbMin -= extra;
+		localAabbMax += extra;
 
 		const ATTRIBUTE_ALIGNED16(btDbvtVolume)	bounds=btDbvtVolume::FromMM(localAabbMin,localAabbMax);
 		//process all children, that overlap with  the given AABB bounds
@@ -289,7 +296,7 @@ void btCompoundCollisionAlgorithm::processCollision (const btCollisionObjectWrap
 				//iterate over all children, perform an AABB check inside ProcessChildShape
 		int numChildren = m_childCollisionAlgorithms.size();
 		int i;
-		btManifoldArray	manifoldArray;
+		btInlineObjectArray<btPersistentManifold*,16>	manifoldArray;
         const btCollisionShape* childShape = 0;
         btTransform	orgTrans;
         btTransform	orgInterpolationTrans;
@@ -310,6 +317,9 @@ void btCompoundCollisionAlgorithm::processCollision (const btCollisionObjectWrap
 				//perform an AABB check first
 				childShape->getAabb(newChildWorldTrans,aabbMin0,aabbMax0);
 				otherObjWrap->getCollisionShape()->getAabb(otherObjWrap->getWorldTransform(),aabbMin1,aabbMax1);
+				btVector3 extra(resultOut->m_closestPointDistanceThreshold,resultOut->m_closestPointDistanceThreshold,resultOut->m_closestPointDistanceThreshold);
+				aabbMin1 -= extra;
+				aabbMax1 += extra;
 
 				if (!TestAabbAgainstAabb2(aabbMin0,aabbMax0,aabbMin1,aabbMax1))
 				{
@@ -20,6 +20,7 @@ subject to the following restrictions:
 #include "BulletCollision/BroadphaseCollision/btDbvt.h"
 #include "LinearMath/btIDebugDraw.h"
 #include "LinearMath/btAabbUtil2.h"
+#include "LinearMath/btInlineObjectArray.h"
 #include "BulletCollision/CollisionDispatch/btManifoldResult.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
 
@@ -235,7 +236,10 @@ static inline void		MycollideTT(	const btDbvtNode* root0,
 		{
 			int								depth=1;
 			int								treshold=btDbvt::DOUBLE_STACKSIZE-4;
+			btFrameArena*					arena=btGetThreadFrameArena();
+			btFrameArenaScope				arenaScope(arena);
 			btAlignedObjectArray<btDbvt::sStkNN>	stkStack;
+			btFrameArenaReserve(arena,stkStack,btDbvt::DOUBLE_STACKSIZE);
 			stkStack.resize(btDbvt::DOUBLE_STACKSIZE);
 			stkStack[0]=btDbvt::sStkNN(root0,root1);
 			do	{
@@ -313,7 +317,7 @@ void btCompoundCompoundCollisionAlgorithm::processCollision (const btCollisionOb
 	///so we should add a 'refreshManifolds' in the btCollisionAlgorithm
 	{
 		int i;
-		btManifoldArray manifoldArray;
+		btInlineObjectArray<btPersistentManifold*,16> manifoldArray;
 		btSimplePairArray& pairs = m_childCollisionAlgorithmCache->getOverlappingPairArray();
 		for (i=0;i<pairs.size();i++)
 		{
@@ -355,7 +359,7 @@ void btCompoundCompoundCollisionAlgorithm::processCollision (const btCollisionOb
 		btSimplePairArray& pairs = m_childCollisionAlgorithmCache->getOverlappingPairArray();
 		
 		int i;
-		btManifoldArray	manifoldArray;
+		btInlineObjectArray<btPersistentManifold*,16>	manifoldArray;
         
 		
 
@@ -26,6 +26,8 @@ subject to the following restrictions:
 #include "LinearMath/btIDebugDraw.h"
 #include "BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+#include "BulletCollision/CollisionDispatch/btInternalEdgeUtility.h"
+#include "BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h"
 
 btConvexConcaveCollisionAlgorithm::btConvexConcaveCollisionAlgorithm( const btCollisionAlgorithmConstructionInfo& ci, const btCollisionObjectWrapper* body0Wrap,const btCollisionObjectWrapper* body1Wrap,bool isSwapped)
 : btActivatingCollisionAlgorithm(ci,body0Wrap,body1Wrap),
@@ -88,20 +90,11 @@ partId, int triangleIndex)
         //just for debugging purposes
         //printf("triangle %d",m_triangleCount++);
 
-        const btCollisionObject* ob = const_cast<btCollisionObject*>(m_triBodyWrap->getCollisionObject());
-
-	btCollisionAlgorithmConstructionInfo ci;
-	ci.m_dispatcher1 = m_dispatcher;
-
-	//const btCollisionObject* ob = static_cast<btCollisionObject*>(m_triBodyWrap->getCollisionObject());
-
-	
-
-
 #if 0	
 	///debug drawing of the overlapping triangles
 	if (m_dispatchInfoPtr && m_dispatchInfoPtr->m_debugDraw && (m_dispatchInfoPtr->m_debugDraw->getDebugMode() &btIDebugDraw::DBG_DrawWireframe ))
 	{
+		const btCollisionObject* ob = const_cast<btCollisionObject*>(m_triBodyWrap->getCollisionObject());
 		btVector3 color(1,1,0);
 		btTransform& tr = ob->getWorldTransform();
 		m_dispatchInfoPtr->m_debugDraw->drawLine(tr(triangle[0]),tr(triangle[1]),color);
@@ -109,47 +102,180 @@ partId, int triangleIndex)
 		m_dispatchInfoPtr->m_debugDraw->drawLine(tr(triangle[2]),tr(triangle[0]),color);
 	}
 #endif
-	
-	if (m_convexBodyWrap->getCollisionShape()->isConvex())
+
+	GatheredTriangle& gathered = m_triangles.expandNonInitializing();
+	gathered.m_vertices[0] = triangle[0];
+	gathered.m_vertices[1] = triangle[1];
+	gathered.m_vertices[2] = triangle[2];
+	gathered.m_partId = partId;
+	gathered.m_triangleIndex = triangleIndex;
+}
+
+
+///btInternalEdgeManifoldResult applies btAdjustInternalEdgeContacts to the contacts of a mesh with a btTriangleInfoMap
+///before they enter the manifold, so the corrected normals also take part in the contact matching
+class btInternalEdgeManifoldResult : public btManifoldResult
+{
+	const btCollisionObjectWrapper*	m_triangleWrap;
+	const btCollisionObjectWrapper*	m_convexWrap;
+
+public:
+	btInternalEdgeManifoldResult(const btManifoldResult& result,const btCollisionObjectWrapper* triangleWrap,const btCollisionObjectWrapper* convexWrap)
+		:btManifoldResult(result),
+		m_triangleWrap(triangleWrap),
+		m_convexWrap(convexWrap)
 	{
-		btTriangleShape tm(triangle[0],triangle[1],triangle[2]);	
-		tm.setMargin(m_collisionMarginTriangle);
-		
-		
-		btCollisionObjectWrapper triObWrap(m_triBodyWrap,&tm,m_triBodyWrap->getCollisionObject(),m_triBodyWrap->getWorldTransform(),partId,triangleIndex);//correct transform?
-		btCollisionAlgorithm* colAlgo = ci.m_dispatcher1->findAlgorithm(m_convexBodyWrap,&triObWrap,m_manifoldPtr);
+	}
 
-		const btCollisionObjectWrapper* tmpWrap = 0;
+	virtual	void addContactPoint(const btVector3& normalOnBInWorld,const btVector3& pointInWorld,btScalar depth)
+	{
+		//the normal points from the triangle to the convex, whatever the order of the bodies
+		btManifoldPoint cp;
+		cp.m_normalWorldOnB = normalOnBInWorld;
+		cp.m_positionWorldOnB = pointInWorld;
+		cp.m_positionWorldOnA = pointInWorld + normalOnBInWorld * depth;
+		cp.m_localPointB = m_triangleWrap->getWorldTransform().invXform(pointInWorld);
+		cp.m_distance1 = depth;
+		btAdjustInternalEdgeContacts(cp,m_triangleWrap,m_convexWrap,m_triangleWrap->m_partId,m_triangleWrap->m_index);
+		btManifoldResult::addContactPoint(cp.m_normalWorldOnB,cp.m_positionWorldOnB,depth);
+	}
+};
 
-		if (m_resultOut->getBody0Internal() == m_triBodyWrap->getCollisionObject())
+void	btConvexTriangleCallback::processTriangles()
+{
+	int numTriangles = m_triangles.size();
+	if (!numTriangles || !m_convexBodyWrap->getCollisionShape()->isConvex())
+	{
+		return;
+	}
+
+	const btConvexShape* convexShape = static_cast<const btConvexShape*>(m_convexBodyWrap->getCollisionShape());
+	btTransform convexInTriangleSpace = m_triBodyWrap->getWorldTransform().inverseTimes(m_convexBodyWrap->getWorldTransform());
+	const btMatrix3x3& convexBasis = convexInTriangleSpace.getBasis();
+
+	//separating axis test along the triangle normal and the outward normals of its edges in the triangle plane:
+	//the convex needs to come within the margins plus the contact breaking threshold of the triangle on each axis,
+	//or no algorithm would report a contact. The axes of all triangles go through one batched support query.
+	//Spheres and capsules skip it, their closed form triangle tests cost less than the test itself.
+	bool separatingAxisTest = convexShape->getShapeType() != SPHERE_SHAPE_PROXYTYPE && convexShape->getShapeType() != CAPSULE_SHAPE_PROXYTYPE;
+	const btVector3& convexOrigin = convexInTriangleSpace.getOrigin();
+	int i,j;
+	if (separatingAxisTest)
+	{
+		m_supportDirections.resizeNoInitialize(5*numTriangles);
+		m_supportVertices.resizeNoInitialize(5*numTriangles);
+	}
+	for (i=0;i<numTriangles && separatingAxisTest;i++)
+	{
+		GatheredTriangle& triangle = m_triangles[i];
+		btVector3* directions = &m_supportDirections[5*i];
+		btVector3 normal = (triangle.m_vertices[1]-triangle.m_vertices[0]).cross(triangle.m_vertices[2]-triangle.m_vertices[0]);
+		btScalar length2 = normal.length2();
+		normal = length2 > SIMD_EPSILON*SIMD_EPSILON ? normal / btSqrt(length2) : btVector3(0,0,0);
+		triangle.m_convexOffsets[0] = normal.dot(convexOrigin-triangle.m_vertices[0]);
+		directions[0] = normal * convexBasis;
+		directions[1] = -directions[0];
+		for (j=0;j<3;j++)
 		{
-			tmpWrap = m_resultOut->getBody0Wrap();
-			m_resultOut->setBody0Wrap(&triObWrap);
-			m_resultOut->setShapeIdentifiersA(partId,triangleIndex);
+			btVector3 edgeNormal = (triangle.m_vertices[(j+1)%3]-triangle.m_vertices[j]).cross(normal);
+			length2 = edgeNormal.length2();
+			edgeNormal = length2 > SIMD_EPSILON*SIMD_EPSILON ? edgeNormal / btSqrt(length2) : btVector3(0,0,0);
+			triangle.m_convexOffsets[j+1] = edgeNormal.dot(convexOrigin-triangle.m_vertices[j]);
+			directions[j+2] = -(edgeNormal * convexBasis);
 		}
-		else
+	}
+	if (separatingAxisTest)
+	{
+		convexShape->batchedUnitVectorGetSupportingVertexWithoutMargin(&m_supportDirections[0],&m_supportVertices[0],5*numTriangles);
+	}
+
+	btScalar reach = convexShape->getMargin() + m_collisionMarginTriangle + m_manifoldPtr->getContactBreakingThreshold() + m_resultOut->m_closestPointDistanceThreshold;
+	btTriangleShape tm(m_triangles[0].m_vertices[0],m_triangles[0].m_vertices[1],m_triangles[0].m_vertices[2]);
+	tm.setMargin(m_collisionMarginTriangle);
+	btCollisionObjectWrapper triObWrap(m_triBodyWrap,&tm,m_triBodyWrap->getCollisionObject(),m_triBodyWrap->getWorldTransform(),-1,-1);//correct transform?
+
+	//internal edge correction inline, unless a contact added callback takes care of it
+	const btCollisionShape* triShape = m_triBodyWrap->getCollisionShape();
+	const btCollisionObject* triObject = m_triBodyWrap->getCollisionObject();
+	const btBvhTriangleMeshShape* trimesh = 0;
+	if (triShape == triObject->getCollisionShape())
+	{
+		if (triShape->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE)
+			trimesh = static_cast<const btBvhTriangleMeshShape*>(triShape);
+		else if (triShape->getShapeType() == SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE)
+			trimesh = static_cast<const btScaledBvhTriangleMeshShape*>(triShape)->getChildShape();
+	}
+	bool customMaterial = gContactAddedCallback && ((triObject->getCollisionFlags() | m_convexBodyWrap->getCollisionObject()->getCollisionFlags()) & btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
+	btInternalEdgeManifoldResult edgeResult(*m_resultOut,&triObWrap,m_convexBodyWrap);
+	btManifoldResult* resultOut = (trimesh && trimesh->getTriangleInfoMap() && !customMaterial) ? &edgeResult : m_resultOut;
+
+	const btCollisionObjectWrapper* tmpWrap = 0;
+	bool triangleIsBody0 = resultOut->getBody0Internal() == triObject;
+	if (triangleIsBody0)
+	{
+		tmpWrap = resultOut->getBody0Wrap();
+		resultOut->setBody0Wrap(&triObWrap);
+	}
+	else
+	{
+		tmpWrap = resultOut->getBody1Wrap();
+		resultOut->setBody1Wrap(&triObWrap);
+	}
+
+	//the algorithms for a convex against a triangle keep no state of their own besides the shared manifold,
+	//so one instance serves all triangles of the batch
+	btCollisionAlgorithm* colAlgo = 0;
+	for (i=0;i<numTriangles;i++)
+	{
+		const GatheredTriangle& triangle = m_triangles[i];
+		if (separatingAxisTest)
 		{
-			tmpWrap = m_resultOut->getBody1Wrap();
-			m_resultOut->setBody1Wrap(&triObWrap);
-			m_resultOut->setShapeIdentifiersB(partId,triangleIndex);
+			//distances of the convex support points to the triangle plane and edges
+			const btVector3* directions = &m_supportDirections[5*i];
+			const btVector3* supportVertices = &m_supportVertices[5*i];
+			if (directions[1].dot(supportVertices[1]) + reach < triangle.m_convexOffsets[0] ||
+				directions[0].dot(supportVertices[0]) + reach < -triangle.m_convexOffsets[0] ||
+				directions[2].dot(supportVertices[2]) + reach < triangle.m_convexOffsets[1] ||
+				directions[3].dot(supportVertices[3]) + reach < triangle.m_convexOffsets[2] ||
+				directions[4].dot(supportVertices[4]) + reach < triangle.m_convexOffsets[3])
+			{
+				continue;
+			}
 		}
-	
-		colAlgo->processCollision(m_convexBodyWrap,&triObWrap,*m_dispatchInfoPtr,m_resultOut);
 
-		if (m_resultOut->getBody0Internal() == m_triBodyWrap->getCollisionObject())
+		tm.m_vertices1[0] = triangle.m_vertices[0];
+		tm.m_vertices1[1] = triangle.m_vertices[1];
+		tm.m_vertices1[2] = triangle.m_vertices[2];
+		triObWrap.m_partId = triangle.m_partId;
+		triObWrap.m_index = triangle.m_triangleIndex;
+		if (triangleIsBody0)
 		{
-			m_resultOut->setBody0Wrap(tmpWrap);
+			resultOut->setShapeIdentifiersA(triangle.m_partId,triangle.m_triangleIndex);
 		} else
 		{
-			m_resultOut->setBody1Wrap(tmpWrap);
+			resultOut->setShapeIdentifiersB(triangle.m_partId,triangle.m_triangleIndex);
 		}
-		
 
+		if (!colAlgo)
+		{
+			colAlgo = m_dispatcher->findAlgorithm(m_convexBodyWrap,&triObWrap,m_manifoldPtr);
+		}
+		colAlgo->processCollision(m_convexBodyWrap,&triObWrap,*m_dispatchInfoPtr,resultOut);
+	}
 
-		colAlgo->~btCollisionAlgorithm();
-		ci.m_dispatcher1->freeCollisionAlgorithm(colAlgo);
+	if (triangleIsBody0)
+	{
+		resultOut->setBody0Wrap(tmpWrap);
+	} else
+	{
+		resultOut->setBody1Wrap(tmpWrap);
 	}
 
+	if (colAlgo)
+	{
+		colAlgo->~btCollisionAlgorithm();
+		m_dispatcher->freeCollisionAlgorithm(colAlgo);
+	}
 }
 
 
@@ -162,6 +288,7 @@ void	btConvexTriangleCallback::setTimeStepAndCounters(btScalar collisionMarginTr
 	m_dispatchInfoPtr = &dispatchInfo;
 	m_collisionMarginTriangle = collisionMarginTriangle;
 	m_resultOut = resultOut;
+	m_triangles.resize(0);
 
 	//recalc aabbs
 	btTransform convexInTriangleSpace;
@@ -169,7 +296,7 @@ void	btConvexTriangleCallback::setTimeStepAndCounters(btScalar collisionMarginTr
 	const btCollisionShape* convexShape = static_cast<const btCollisionShape*>(m_convexBodyWrap->getCollisionShape());
 	//CollisionShape* triangleShape = static_cast<btCollisionShape*>(triBody->m_collisionShape);
 	convexShape->getAabb(convexInTriangleSpace,m_aabbMin,m_aabbMax);
-	btScalar extraMargin = collisionMarginTriangle;
+	btScalar extraMargin = collisionMarginTriangle + resultOut->m_closestPointDistanceThreshold;
 	btVector3 extra(extraMargin,extraMargin,extraMargin);
 
 	m_aabbMax += extra;
@@ -207,6 +334,7 @@ void btConvexConcaveCollisionAlgorithm::processCollision (const btCollisionObjec
 			m_btConvexTriangleCallback.m_manifoldPtr->setBodies(convexBodyWrap->getCollisionObject(),triBodyWrap->getCollisionObject());
 
 			concaveShape->processAllTriangles( &m_btConvexTriangleCallback,m_btConvexTriangleCallback.getAabbMin(),m_btConvexTriangleCallback.getAabbMax());
+			m_btConvexTriangleCallback.processTriangles();
 			
 			resultOut->refreshContactPoints();
 
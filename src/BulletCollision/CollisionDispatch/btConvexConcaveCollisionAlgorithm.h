@@ -21,13 +21,26 @@ subject to the following restrictions:
 #include "BulletCollision/BroadphaseCollision/btBroadphaseInterface.h"
 #include "BulletCollision/CollisionShapes/btTriangleCallback.h"
 #include "BulletCollision/NarrowPhaseCollision/btPersistentManifold.h"
+#include "LinearMath/btAlignedObjectArray.h"
 class btDispatcher;
 #include "BulletCollision/BroadphaseCollision/btBroadphaseProxy.h"
 #include "btCollisionCreateFunc.h"
 
 ///For each triangle in the concave mesh that overlaps with the AABB of a convex (m_convexProxy), processTriangle is called.
+///processTriangle only gathers the triangles, processTriangles then collides the whole batch: a separating axis test along
+///the triangle normals, with one batched support query of the convex, discards the triangles out of reach, and the remaining
+///ones share a single collision algorithm, triangle shape and wrapper instead of a dispatch per triangle.
 class btConvexTriangleCallback : public btTriangleCallback
 {
+	struct	GatheredTriangle
+	{
+		btVector3	m_vertices[3];
+		int		m_partId;
+		int		m_triangleIndex;
+		///distances of the convex origin to the triangle plane and to its edges
+		btScalar	m_convexOffsets[4];
+	};
+
 	const btCollisionObjectWrapper* m_convexBodyWrap;
 	const btCollisionObjectWrapper* m_triBodyWrap;
 
@@ -39,6 +52,10 @@ class btConvexTriangleCallback : public btTriangleCallback
 	btDispatcher*	m_dispatcher;
 	const btDispatcherInfo* m_dispatchInfoPtr;
 	btScalar m_collisionMarginTriangle;
+
+	btAlignedObjectArray<GatheredTriangle>	m_triangles;
+	btAlignedObjectArray<btVector3>	m_supportDirections;
+	btAlignedObjectArray<btVector3>	m_supportVertices;
 	
 public:
 int	m_triangleCount;
@@ -57,6 +74,9 @@ int	m_triangleCount;
 	virtual ~btConvexTriangleCallback();
 
 	virtual void processTriangle(btVector3* triangle, int partId, int triangleIndex);
+
+	///collides the convex against the triangles gathered since setTimeStepAndCounters
+	void	processTriangles();
 	
 	void clearCache();
 
@@ -53,6 +53,7 @@ subject to the following restrictions:
 #include "BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h"
 #include "BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.h"
 #include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+#include "LinearMath/btInlineObjectArray.h"
 
 ///////////
 
@@ -203,7 +204,10 @@ m_sepDistance((static_cast<btConvexShape*>(body0->getCollisionShape()))->getAngu
 			  (static_cast<btConvexShape*>(body1->getCollisionShape()))->getAngularMotionDisc()),
 #endif
 m_numPerturbationIterations(numPerturbationIterations),
-m_minimumPointsPerturbationThreshold(minimumPointsPerturbationThreshold)
+m_minimumPointsPerturbationThreshold(minimumPointsPerturbationThreshold),
+m_cachedSeparatingAxis(btScalar(0.),btScalar(1.),btScalar(0.)),
+m_hasCachedSeparatingAxis(false),
+m_hasCachedRelativeTransform(false)
 {
 	(void)body0Wrap;
 	(void)body1Wrap;
@@ -285,6 +289,120 @@ struct btPerturbedContactResult : public btManifoldResult
 
 extern btScalar gContactBreakingThreshold;
 
+///whether the line through point along direction, both in local space, passes through the box
+static bool	lineIntersectsAabb(const btVector3& point, const btVector3& direction, const btVector3& aabbMin, const btVector3& aabbMax)
+{
+	btScalar tMin = -BT_LARGE_FLOAT;
+	btScalar tMax = BT_LARGE_FLOAT;
+	for (int i=0;i<3;i++)
+	{
+		if (btFabs(direction[i]) < SIMD_EPSILON)
+		{
+			if (point[i] < aabbMin[i] || point[i] > aabbMax[i])
+				return false;
+			continue;
+		}
+		btScalar t0 = (aabbMin[i]-point[i])/direction[i];
+		btScalar t1 = (aabbMax[i]-point[i])/direction[i];
+		if (t0 > t1)
+			btSwap(t0,t1);
+		tMin = btMax(tMin,t0);
+		tMax = btMin(tMax,t1);
+	}
+	return tMin <= tMax;
+}
+
+///whether the line through point along direction passes through the triangle, all in the same space
+static bool	lineIntersectsTriangle(const btVector3& point, const btVector3& direction, const btVector3* vertices)
+{
+	bool positive = false;
+	bool negative = false;
+	for (int i=0;i<3;i++)
+	{
+		const btScalar side = (vertices[(i+1)%3]-vertices[i]).cross(point-vertices[i]).dot(direction);
+		positive |= side > btScalar(0.);
+		negative |= side < btScalar(0.);
+	}
+	return !(positive && negative);
+}
+
+///adds the vertices of the supporting feature of a polyhedron, the ones within a tenth of its radius of the closest one,
+///as contacts with the supporting plane of the other shape. normalOnB points from B to A. A separated pair only gets
+///the closest point from GJK, so without these a face could rotate around that point into the other shape within
+///the step of a speculative contact. Vertices that would pass beside the other shape, a triangle or else its local bounding box,
+///are skipped. Otherwise a vertex in front of one triangle of a mesh would also get the tilted plane of a neighbouring one.
+static void	addSpeculativeVertexContacts(const btConvexShape* polyhedron, const btTransform& polyhedronTrans, const btConvexShape* other, const btTransform& otherTrans,
+										 const btVector3& normalOnB, bool polyhedronIsA, btScalar maxDistance, btManifoldResult* resultOut)
+{
+	//the plane faces the polyhedron
+	const btVector3 normal = polyhedronIsA ? normalOnB : -normalOnB;
+	const btVector3 otherSupport = otherTrans(other->localGetSupportVertexWithoutMarginNonVirtual(normal*otherTrans.getBasis()));
+	const btScalar planeConstant = normal.dot(otherSupport) + other->getMarginNonVirtual();
+	btVector3 otherAabbMin,otherAabbMax;
+	other->getAabb(btTransform::getIdentity(),otherAabbMin,otherAabbMax);
+	const btVector3 localNormal = normal*otherTrans.getBasis();
+	const btTriangleShape* triangle = other->getShapeType()==TRIANGLE_SHAPE_PROXYTYPE ? static_cast<const btTriangleShape*>(other) : 0;
+
+	///btBoxShape is an exception: its vertices are created WITH margin
+	const btScalar margin = polyhedron->getShapeType()==BOX_SHAPE_PROXYTYPE ? btScalar(0.) : polyhedron->getMarginNonVirtual();
+	const btPolyhedralConvexShape* polyhedralShape = static_cast<const btPolyhedralConvexShape*>(polyhedron);
+	const int numVertices = polyhedralShape->getNumVertices();
+	int i;
+	btVector3 vertex;
+	btScalar minDistance = BT_LARGE_FLOAT;
+	for (i=0;i<numVertices;i++)
+	{
+		polyhedralShape->getVertex(i,vertex);
+		minDistance = btMin(minDistance,normal.dot(polyhedronTrans(vertex)));
+	}
+	minDistance -= margin + planeConstant;
+	maxDistance = btMin(maxDistance,minDistance + btMax(gContactBreakingThreshold,btScalar(0.1)*polyhedron->getAngularMotionDisc()));
+
+	for (i=0;i<numVertices;i++)
+	{
+		polyhedralShape->getVertex(i,vertex);
+		const btVector3 pointOnPolyhedron = polyhedronTrans(vertex) - normal*margin;
+		const btScalar distance = normal.dot(pointOnPolyhedron) - planeConstant;
+		if (distance > maxDistance)
+			continue;
+		const btVector3 localPoint = otherTrans.invXform(pointOnPolyhedron);
+		if (triangle ? !lineIntersectsTriangle(localPoint,localNormal,triangle->m_vertices1) : !lineIntersectsAabb(localPoint,localNormal,otherAabbMin,otherAabbMax))
+			continue;
+		if (polyhedronIsA)
+		{
+			resultOut->addContactPoint(normalOnB,pointOnPolyhedron-normal*distance,distance);
+		} else
+		{
+			resultOut->addContactPoint(normalOnB,pointOnPolyhedron,distance);
+		}
+	}
+}
+
+static btScalar	separationAlongAxis(const btConvexShape* min0, const btTransform& transA, const btConvexShape* min1, const btTransform& transB, const btVector3& normalOnB)
+{
+	const btVector3 supportA = transA(min0->localGetSupportVertexWithoutMarginNonVirtual((-normalOnB)*transA.getBasis()));
+	const btVector3 supportB = transB(min1->localGetSupportVertexWithoutMarginNonVirtual(normalOnB*transB.getBasis()));
+	return normalOnB.dot(supportA-supportB) - min0->getMarginNonVirtual() - min1->getMarginNonVirtual();
+}
+
+///speculative contacts along the separating axis normalOnB of GJK, which points from B to A. The pair may penetrate
+///along it by no more than the contact breaking threshold, otherwise the axis says little about the contact.
+static void	addSpeculativeContacts(const btConvexShape* min0, const btTransform& transA, const btConvexShape* min1, const btTransform& transB,
+								   const btVector3& normalOnB, btScalar maxDistance, btManifoldResult* resultOut)
+{
+	const btScalar separation = separationAlongAxis(min0,transA,min1,transB,normalOnB);
+	if (separation < -gContactBreakingThreshold)
+		return;
+
+	if (min0->isPolyhedral())
+	{
+		addSpeculativeVertexContacts(min0,transA,min1,transB,normalOnB,true,maxDistance,resultOut);
+	}
+	if (min1->isPolyhedral())
+	{
+		addSpeculativeVertexContacts(min1,transB,min0,transA,normalOnB,false,maxDistance,resultOut);
+	}
+}
 
 //
 // Convex-Convex collision algorithm
@@ -317,7 +435,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 	//	btVector3 localScalingA = capsuleA->getLocalScaling();
 	//	btVector3 localScalingB = capsuleB->getLocalScaling();
 		
-		btScalar threshold = m_manifoldPtr->getContactBreakingThreshold();
+		btScalar threshold = m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold;
 
 		btScalar dist = capsuleCapsuleDistance(normalOnB,	pointOnBWorld,capsuleA->getHalfHeight(),capsuleA->getRadius(),
 			capsuleB->getHalfHeight(),capsuleB->getRadius(),capsuleA->getUpAxis(),capsuleB->getUpAxis(),
@@ -333,7 +451,46 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 	}
 #endif //BT_DISABLE_CAPSULE_CAPSULE_COLLIDER
 
+	const btTransform& transA = body0Wrap->getWorldTransform();
+	const btTransform& transB = body1Wrap->getWorldTransform();
 
+	//keep the contacts of a pair that hardly moved relative to each other since its last query,
+	//bounding the motion of A in the frame of B by the change of origin and rotation
+	if (dispatchInfo.m_convexCoherentMotionThreshold>btScalar(0.) && m_ownManifold)
+	{
+		const btTransform relativeTransform = transB.inverseTimes(transA);
+		if (m_hasCachedRelativeTransform)
+		{
+			const btMatrix3x3& basis = relativeTransform.getBasis();
+			const btMatrix3x3& cachedBasis = m_cachedRelativeTransform.getBasis();
+			const btScalar rotation2 = (basis[0]-cachedBasis[0]).length2() + (basis[1]-cachedBasis[1]).length2() + (basis[2]-cachedBasis[2]).length2();
+			const btScalar motion = (relativeTransform.getOrigin()-m_cachedRelativeTransform.getOrigin()).length() +
+				btSqrt(rotation2)*min0->getAngularMotionDisc();
+			if (motion < dispatchInfo.m_convexCoherentMotionThreshold)
+			{
+				resultOut->refreshContactPoints();
+				return;
+			}
+		}
+		m_cachedRelativeTransform = relativeTransform;
+		m_hasCachedRelativeTransform = true;
+	}
+
+	//a pair that is still separated along the last axis of GJK has no contacts within the breaking threshold
+	if (m_hasCachedSeparatingAxis)
+	{
+		const btVector3 supportA = transA(min0->localGetSupportVertexWithoutMarginNonVirtual((-m_cachedSeparatingAxis)*transA.getBasis()));
+		const btVector3 supportB = transB(min1->localGetSupportVertexWithoutMarginNonVirtual(m_cachedSeparatingAxis*transB.getBasis()));
+		const btScalar separation = m_cachedSeparatingAxis.dot(supportA-supportB) - min0->getMarginNonVirtual() - min1->getMarginNonVirtual();
+		if (separation > m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold)
+		{
+			if (m_ownManifold)
+			{
+				resultOut->refreshContactPoints();
+			}
+			return;
+		}
+	}
 
 
 #ifdef USE_SEPDISTANCE_UTIL2
@@ -354,6 +511,11 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 	//TODO: if (dispatchInfo.m_useContinuous)
 	gjkPairDetector.setMinkowskiA(min0);
 	gjkPairDetector.setMinkowskiB(min1);
+	if (m_hasCachedSeparatingAxis)
+	{
+		gjkPairDetector.setUseCachedSeparatingAxis(true);
+		gjkPairDetector.setCachedSeperatingAxis(m_cachedSeparatingAxis);
+	}
 
 #ifdef USE_SEPDISTANCE_UTIL2
 	if (dispatchInfo.m_useConvexConservativeDistanceUtil)
@@ -367,7 +529,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 		//	input.m_maximumDistanceSquared = min0->getMargin() + min1->getMargin() + m_manifoldPtr->getContactProcessingThreshold();
 		//} else
 		//{
-		input.m_maximumDistanceSquared = min0->getMargin() + min1->getMargin() + m_manifoldPtr->getContactBreakingThreshold();
+		input.m_maximumDistanceSquared = min0->getMargin() + min1->getMargin() + m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold;
 //		}
 
 		input.m_maximumDistanceSquared*= input.m_maximumDistanceSquared;
@@ -460,7 +622,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 
 			
 
-			btScalar threshold = m_manifoldPtr->getContactBreakingThreshold();
+			btScalar threshold = m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold;
 
 			btScalar minDist = -1e30f;
 			btVector3 sepNormalWorldSpace;
@@ -472,7 +634,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 					*polyhedronA->getConvexPolyhedron(), *polyhedronB->getConvexPolyhedron(),
 					body0Wrap->getWorldTransform(), 
 					body1Wrap->getWorldTransform(),
-					sepNormalWorldSpace,*resultOut);
+					sepNormalWorldSpace,*resultOut,&m_separatingAxisCache);
 			} else
 			{
 #ifdef ZERO_MARGIN
@@ -484,6 +646,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 				gjkPairDetector.getClosestPoints(input,withoutMargin,dispatchInfo.m_debugDraw);
 				//gjkPairDetector.getClosestPoints(input,dummy,dispatchInfo.m_debugDraw);
 #endif //ZERO_MARGIN
+				cacheSeparatingAxis(gjkPairDetector.getCachedSeparatingAxis());
 				//btScalar l2 = gjkPairDetector.getCachedSeparatingAxis().length2();
 				//if (l2>SIMD_EPSILON)
 				{
@@ -507,6 +670,9 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 					body0Wrap->getWorldTransform(), 
 					body1Wrap->getWorldTransform(), minDist-threshold, threshold, *resultOut);
  				
+			} else if (resultOut->m_closestPointDistanceThreshold > btScalar(0.) && m_hasCachedSeparatingAxis)
+			{
+				addSpeculativeContacts(min0,transA,min1,transB,m_cachedSeparatingAxis,threshold,resultOut);
 			}
 			if (m_ownManifold)
 			{
@@ -520,7 +686,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 			if (polyhedronA->getConvexPolyhedron() && polyhedronB->getShapeType()==TRIANGLE_SHAPE_PROXYTYPE)
 			{
 
-				btVertexArray vertices;
+				btInlineObjectArray<btVector3,8> vertices;
 				btTriangleShape* tri = (btTriangleShape*)polyhedronB;
 				vertices.push_back(	body1Wrap->getWorldTransform()*tri->m_vertices1[0]);
 				vertices.push_back(	body1Wrap->getWorldTransform()*tri->m_vertices1[1]);
@@ -528,7 +694,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 				
 				//tri->initializePolyhedralFeatures();
 
-				btScalar threshold = m_manifoldPtr->getContactBreakingThreshold();
+				btScalar threshold = m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold;
 
 				btVector3 sepNormalWorldSpace;
 				btScalar minDist =-1e30f;
@@ -553,6 +719,7 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 #else
 					gjkPairDetector.getClosestPoints(input,dummy,dispatchInfo.m_debugDraw);
 #endif//ZERO_MARGIN
+					cacheSeparatingAxis(gjkPairDetector.getCachedSeparatingAxis());
 					
 					btScalar l2 = gjkPairDetector.getCachedSeparatingAxis().length2();
 					if (l2>SIMD_EPSILON)
@@ -587,6 +754,13 @@ void btConvexConvexAlgorithm ::processCollision (const btCollisionObjectWrapper*
 	}
 	
 	gjkPairDetector.getClosestPoints(input,*resultOut,dispatchInfo.m_debugDraw);
+	cacheSeparatingAxis(gjkPairDetector.getCachedSeparatingAxis());
+
+	if (resultOut->m_closestPointDistanceThreshold > btScalar(0.) && m_hasCachedSeparatingAxis)
+	{
+		addSpeculativeContacts(min0,transA,min1,transB,m_cachedSeparatingAxis,
+			m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold,resultOut);
+	}
 
 	//now perform 'm_numPerturbationIterations' collision queries with the perturbated collision objects
 	
@@ -21,6 +21,7 @@ subject to the following restrictions:
 #include "BulletCollision/NarrowPhaseCollision/btPersistentManifold.h"
 #include "BulletCollision/BroadphaseCollision/btBroadphaseProxy.h"
 #include "BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.h"
+#include "BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.h"
 #include "btCollisionCreateFunc.h"
 #include "btCollisionDispatcher.h"
 #include "LinearMath/btTransformUtil.h" //for btConvexSeparatingDistanceUtil
@@ -55,7 +56,25 @@ class btConvexConvexAlgorithm : public btActivatingCollisionAlgorithm
 
 
 	///cache separating vector to speedup collision detection
-	
+	///the separating axis test of polyhedra starts with the axis of the previous frame
+	btSeparatingAxisCache	m_separatingAxisCache;
+	///the separating axis found by GJK, pointing from B to A. GJK starts from it, and a pair that is still
+	///separated along it beyond the contact breaking threshold skips GJK.
+	btVector3	m_cachedSeparatingAxis;
+	bool		m_hasCachedSeparatingAxis;
+	///the transform of A relative to B at the last query, see btDispatcherInfo::m_convexCoherentMotionThreshold
+	btTransform	m_cachedRelativeTransform;
+	bool		m_hasCachedRelativeTransform;
+
+	void	cacheSeparatingAxis(const btVector3& axis)
+	{
+		const btScalar l2 = axis.length2();
+		m_hasCachedSeparatingAxis = l2>SIMD_EPSILON;
+		if (m_hasCachedSeparatingAxis)
+		{
+			m_cachedSeparatingAxis = axis/btSqrt(l2);
+		}
+	}
 
 public:
 
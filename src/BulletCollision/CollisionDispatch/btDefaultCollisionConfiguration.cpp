@@ -28,6 +28,7 @@ subject to the following restrictions:
 #include "BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.h"
 #endif //USE_BUGGY_SPHERE_BOX_ALGORITHM
 #include "BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.h"
+#include "BulletCollision/CollisionDispatch/btCapsuleCollisionAlgorithm.h"
 #include "BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h"
 #include "BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.h"
 #include "BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.h"
@@ -100,6 +101,13 @@ btDefaultCollisionConfiguration::btDefaultCollisionConfiguration(const btDefault
 	mem = btAlignedAlloc (sizeof(btConvexPlaneCollisionAlgorithm::CreateFunc),16);
 	m_planeConvexCF = new (mem) btConvexPlaneCollisionAlgorithm::CreateFunc;
 	m_planeConvexCF->m_swapped = true;
+
+	//capsules and spheres versus capsules, spheres, boxes and triangles
+	mem = btAlignedAlloc (sizeof(btCapsuleCollisionAlgorithm::CreateFunc),16);
+	m_capsuleCF = new (mem) btCapsuleCollisionAlgorithm::CreateFunc;
+	mem = btAlignedAlloc (sizeof(btCapsuleCollisionAlgorithm::CreateFunc),16);
+	m_swappedCapsuleCF = new (mem) btCapsuleCollisionAlgorithm::CreateFunc;
+	m_swappedCapsuleCF->m_swapped = true;
 	
 	///calculate maximum element size, big enough to fit any collision algorithm in the memory pool
 	int maxSize = sizeof(btConvexConvexAlgorithm);
@@ -120,7 +128,7 @@ btDefaultCollisionConfiguration::btDefaultCollisionConfiguration(const btDefault
 	{
 		m_ownsPersistentManifoldPool = true;
 		void* mem = btAlignedAlloc(sizeof(btPoolAllocator),16);
-		m_persistentManifoldPool = new (mem) btPoolAllocator(sizeof(btPersistentManifold),constructionInfo.m_defaultMaxPersistentManifoldPoolSize);
+		m_persistentManifoldPool = new (mem) btPoolAllocator(sizeof(btPersistentManifold),constructionInfo.m_defaultMaxPersistentManifoldPoolSize,constructionInfo.m_persistentManifoldPoolGrowSize);
 	}
 	
 	if (constructionInfo.m_collisionAlgorithmPool)
@@ -131,7 +139,7 @@ btDefaultCollisionConfiguration::btDefaultCollisionConfiguration(const btDefault
 	{
 		m_ownsCollisionAlgorithmPool = true;
 		void* mem = btAlignedAlloc(sizeof(btPoolAllocator),16);
-		m_collisionAlgorithmPool = new(mem) btPoolAllocator(collisionAlgorithmMaxElementSize,constructionInfo.m_defaultMaxCollisionAlgorithmPoolSize);
+		m_collisionAlgorithmPool = new(mem) btPoolAllocator(collisionAlgorithmMaxElementSize,constructionInfo.m_defaultMaxCollisionAlgorithmPoolSize,constructionInfo.m_collisionAlgorithmPoolGrowSize);
 	}
 
 
@@ -192,6 +200,11 @@ btDefaultCollisionConfiguration::~btDefaultCollisionConfiguration()
 	m_planeConvexCF->~btCollisionAlgorithmCreateFunc();
 	btAlignedFree( m_planeConvexCF);
 
+	m_capsuleCF->~btCollisionAlgorithmCreateFunc();
+	btAlignedFree( m_capsuleCF);
+	m_swappedCapsuleCF->~btCollisionAlgorithmCreateFunc();
+	btAlignedFree( m_swappedCapsuleCF);
+
 	m_simplexSolver->~btVoronoiSimplexSolver();
 	btAlignedFree(m_simplexSolver);
 
@@ -239,6 +252,28 @@ btCollisionAlgorithmCreateFunc* btDefaultCollisionConfiguration::getCollisionAlg
 	{
 		return m_boxBoxCF;
 	}
+
+	if ((proxyType0 == CAPSULE_SHAPE_PROXYTYPE) || (proxyType0 == SPHERE_SHAPE_PROXYTYPE))
+	{
+		if ((proxyType1 == CAPSULE_SHAPE_PROXYTYPE) || (proxyType1 == SPHERE_SHAPE_PROXYTYPE) || (proxyType1 == BOX_SHAPE_PROXYTYPE))
+		{
+			return m_capsuleCF;
+		}
+		if ((proxyType0 == CAPSULE_SHAPE_PROXYTYPE) && (proxyType1 == TRIANGLE_SHAPE_PROXYTYPE))
+		{
+			return m_capsuleCF;
+		}
+	}
+
+	if (((proxyType1 == CAPSULE_SHAPE_PROXYTYPE) || (proxyType1 == SPHERE_SHAPE_PROXYTYPE)) && (proxyType0 == BOX_SHAPE_PROXYTYPE))
+	{
+		return m_swappedCapsuleCF;
+	}
+
+	if ((proxyType1 == CAPSULE_SHAPE_PROXYTYPE) && (proxyType0 == TRIANGLE_SHAPE_PROXYTYPE))
+	{
+		return m_swappedCapsuleCF;
+	}
 	
 	if (btBroadphaseProxy::isConvex(proxyType0) && (proxyType1 == STATIC_PLANE_PROXYTYPE))
 	{
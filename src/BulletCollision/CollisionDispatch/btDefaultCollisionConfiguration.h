@@ -26,6 +26,9 @@ struct	btDefaultCollisionConstructionInfo
 	btPoolAllocator*	m_collisionAlgorithmPool;
 	int					m_defaultMaxPersistentManifoldPoolSize;
 	int					m_defaultMaxCollisionAlgorithmPoolSize;
+	///number of elements added to the default pools each time they run out, 0 keeps them at their initial size
+	int					m_persistentManifoldPoolGrowSize;
+	int					m_collisionAlgorithmPoolGrowSize;
 	int					m_customCollisionAlgorithmMaxElementSize;
 	int					m_useEpaPenetrationAlgorithm;
 
@@ -34,6 +37,8 @@ struct	btDefaultCollisionConstructionInfo
 		m_collisionAlgorithmPool(0),
 		m_defaultMaxPersistentManifoldPoolSize(4096),
 		m_defaultMaxCollisionAlgorithmPoolSize(4096),
+		m_persistentManifoldPoolGrowSize(1024),
+		m_collisionAlgorithmPoolGrowSize(1024),
 		m_customCollisionAlgorithmMaxElementSize(0),
 		m_useEpaPenetrationAlgorithm(true)
 	{
@@ -82,6 +87,8 @@ protected:
 	btCollisionAlgorithmCreateFunc*	m_triangleSphereCF;
 	btCollisionAlgorithmCreateFunc*	m_planeConvexCF;
 	btCollisionAlgorithmCreateFunc*	m_convexPlaneCF;
+	btCollisionAlgorithmCreateFunc*	m_capsuleCF;
+	btCollisionAlgorithmCreateFunc*	m_swappedCapsuleCF;
 	
 public:
 
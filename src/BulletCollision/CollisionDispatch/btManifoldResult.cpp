@@ -70,6 +70,8 @@ btManifoldResult::btManifoldResult(const btCollisionObjectWrapper* body0Wrap,con
 	m_index0(-1),
 	m_index1(-1)
 #endif //DEBUG_PART_INDEX
+		,m_featureId(0),
+		m_closestPointDistanceThreshold(0)
 {
 }
 
@@ -79,7 +81,10 @@ void btManifoldResult::addContactPoint(const btVector3& normalOnBInWorld,const b
 	btAssert(m_manifoldPtr);
 	//order in manifold needs to match
 
-	if (depth > m_manifoldPtr->getContactBreakingThreshold())
+	int featureId = m_featureId;
+	m_featureId = 0;
+
+	if (depth > m_manifoldPtr->getContactBreakingThreshold()+m_closestPointDistanceThreshold)
 //	if (depth > m_manifoldPtr->getContactProcessingThreshold())
 		return;
 
@@ -104,16 +109,7 @@ void btManifoldResult::addContactPoint(const btVector3& normalOnBInWorld,const b
 	newPt.m_positionWorldOnA = pointA;
 	newPt.m_positionWorldOnB = pointInWorld;
 	
-	int insertIndex = m_manifoldPtr->getCacheEntry(newPt);
-
-	newPt.m_combinedFriction = calculateCombinedFriction(m_body0Wrap->getCollisionObject(),m_body1Wrap->getCollisionObject());
-	newPt.m_combinedRestitution = calculateCombinedRestitution(m_body0Wrap->getCollisionObject(),m_body1Wrap->getCollisionObject());
-	newPt.m_combinedRollingFriction = calculateCombinedRollingFriction(m_body0Wrap->getCollisionObject(),m_body1Wrap->getCollisionObject());
-	btPlaneSpace1(newPt.m_normalWorldOnB,newPt.m_lateralFrictionDir1,newPt.m_lateralFrictionDir2);
-	
-
-	
-   //BP mod, store contact triangles.
+	//BP mod, store contact triangles.
 	if (isSwapped)
 	{
 		newPt.m_partId0 = m_partId1;
@@ -127,11 +123,29 @@ void btManifoldResult::addContactPoint(const btVector3& normalOnBInWorld,const b
 		newPt.m_index0  = m_index0;
 		newPt.m_index1  = m_index1;
 	}
+	newPt.m_featureId = featureId;
+
+	int insertIndex = m_manifoldPtr->getCacheEntry(newPt);
+
+	newPt.m_combinedFriction = calculateCombinedFriction(m_body0Wrap->getCollisionObject(),m_body1Wrap->getCollisionObject());
+	newPt.m_combinedRestitution = calculateCombinedRestitution(m_body0Wrap->getCollisionObject(),m_body1Wrap->getCollisionObject());
+	newPt.m_combinedRollingFriction = calculateCombinedRollingFriction(m_body0Wrap->getCollisionObject(),m_body1Wrap->getCollisionObject());
+	btPlaneSpace1(newPt.m_normalWorldOnB,newPt.m_lateralFrictionDir1,newPt.m_lateralFrictionDir2);
+	
 	//printf("depth=%f\n",depth);
 	///@todo, check this for any side effects
 	if (insertIndex >= 0)
 	{
-		//const btManifoldPoint& oldPoint = m_manifoldPtr->getContactPoint(insertIndex);
+		//a speculative contact does not replace a closer point, for example when the same vertex of a convex
+		//faces two triangles of a mesh, the plane of the one in front of it is the one to keep
+		if (depth > m_manifoldPtr->getContactBreakingThreshold())
+		{
+			const btManifoldPoint& oldPoint = m_manifoldPtr->getContactPoint(insertIndex);
+			const btTransform& trA = isSwapped ? m_body1Wrap->getCollisionObject()->getWorldTransform() : m_body0Wrap->getCollisionObject()->getWorldTransform();
+			const btTransform& trB = isSwapped ? m_body0Wrap->getCollisionObject()->getWorldTransform() : m_body1Wrap->getCollisionObject()->getWorldTransform();
+			if ((trA(oldPoint.m_localPointA) - trB(oldPoint.m_localPointB)).dot(oldPoint.m_normalWorldOnB) < depth)
+				return;
+		}
 		m_manifoldPtr->replaceContactPoint(newPt,insertIndex);
 	} else
 	{
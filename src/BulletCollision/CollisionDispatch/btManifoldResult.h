@@ -48,18 +48,25 @@ protected:
 	int m_partId1;
 	int m_index0;
 	int m_index1;
+	int m_featureId;
 	
 
 public:
 
+	///contacts up to this distance beyond the contact breaking threshold are reported, for speculative contacts
+	///of objects that approach each other. See btDispatcherInfo::m_useSpeculativeContacts.
+	btScalar	m_closestPointDistanceThreshold;
+
 	btManifoldResult()
-#ifdef DEBUG_PART_INDEX
 		:
+#ifdef DEBUG_PART_INDEX
 	m_partId0(-1),
 	m_partId1(-1),
 	m_index0(-1),
-	m_index1(-1)
+	m_index1(-1),
 #endif //DEBUG_PART_INDEX
+	m_featureId(0),
+	m_closestPointDistanceThreshold(0)
 	{
 	}
 
@@ -67,9 +74,14 @@ public:
 
 	virtual ~btManifoldResult() {};
 
+	///the manifold takes over m_closestPointDistanceThreshold, so its speculative contacts survive refreshContactPoints
 	void	setPersistentManifold(btPersistentManifold* manifoldPtr)
 	{
 		m_manifoldPtr = manifoldPtr;
+		if (m_manifoldPtr)
+		{
+			m_manifoldPtr->setSpeculativeMargin(m_closestPointDistanceThreshold);
+		}
 	}
 
 	const btPersistentManifold*	getPersistentManifold() const
@@ -93,6 +105,12 @@ public:
 		m_index1=index1;
 	}
 
+	///the feature id only applies to the next addContactPoint
+	virtual void setFeatureId(int featureId)
+	{
+		m_featureId = featureId;
+	}
+
 
 	virtual void addContactPoint(const btVector3& normalOnBInWorld,const btVector3& pointInWorld,btScalar depth);
 
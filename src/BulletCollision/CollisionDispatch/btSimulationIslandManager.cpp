@@ -43,7 +43,9 @@ void btSimulationIslandManager::initUnionFind(int n)
 
 void btSimulationIslandManager::findUnions(btDispatcher* /* dispatcher */,btCollisionWorld* colWorld)
 {
-	
+	//also applies to the constraints the dynamics world unites afterwards
+	m_unionFind.setSmallestIndexRoot(colWorld->getDispatchInfo().m_deterministicOverlappingPairs);
+
 	{
 		btOverlappingPairCache* pairCachePtr = colWorld->getPairCache();
 		const int numOverlappingPairs = pairCachePtr->getNumOverlappingPairs();
@@ -199,6 +201,30 @@ class btPersistentManifoldSortPredicate
 		}
 };
 
+///orders manifolds by island, then by the unique ids of both objects. Manifolds of the same pair keep their relative order
+///in the dispatcher, so the order does not depend on the order in which pairs created their manifolds.
+class btPersistentManifoldSortPredicateDeterministic
+{
+	public:
+
+		SIMD_FORCE_INLINE bool operator() ( const btPersistentManifold* lhs, const btPersistentManifold* rhs ) const
+		{
+			int islandL = getIslandId(lhs);
+			int islandR = getIslandId(rhs);
+			if (islandL != islandR)
+				return islandL < islandR;
+			int uidL0 = lhs->getBody0()->getBroadphaseHandle()->getUid();
+			int uidR0 = rhs->getBody0()->getBroadphaseHandle()->getUid();
+			if (uidL0 != uidR0)
+				return uidL0 < uidR0;
+			int uidL1 = lhs->getBody1()->getBroadphaseHandle()->getUid();
+			int uidR1 = rhs->getBody1()->getBroadphaseHandle()->getUid();
+			if (uidL1 != uidR1)
+				return uidL1 < uidR1;
+			return lhs->m_index1a < rhs->m_index1a;
+		}
+};
+
 
 void btSimulationIslandManager::buildIslands(btDispatcher* dispatcher,btCollisionWorld* collisionWorld)
 {
@@ -367,6 +393,15 @@ void btSimulationIslandManager::buildAndProcessIslands(btDispatcher* dispatcher,
 	{
 		btPersistentManifold** manifold = dispatcher->getInternalManifoldPointer();
 		int maxNumManifolds = dispatcher->getNumManifolds();
+		if (collisionWorld->getDispatchInfo().m_deterministicOverlappingPairs && maxNumManifolds)
+		{
+			m_islandmanifold.resize(0);
+			m_islandmanifold.reserve(maxNumManifolds);
+			for (int i=0;i<maxNumManifolds;i++)
+				m_islandmanifold.push_back(manifold[i]);
+			m_islandmanifold.quickSort(btPersistentManifoldSortPredicateDeterministic());
+			manifold = &m_islandmanifold[0];
+		}
 		callback->processIsland(&collisionObjects[0],collisionObjects.size(),manifold,maxNumManifolds, -1);
 	}
 	else
@@ -379,7 +414,10 @@ void btSimulationIslandManager::buildAndProcessIslands(btDispatcher* dispatcher,
 
 		//tried a radix sort, but quicksort/heapsort seems still faster
 		//@todo rewrite island management
-		m_islandmanifold.quickSort(btPersistentManifoldSortPredicate());
+		if (collisionWorld->getDispatchInfo().m_deterministicOverlappingPairs)
+			m_islandmanifold.quickSort(btPersistentManifoldSortPredicateDeterministic());
+		else
+			m_islandmanifold.quickSort(btPersistentManifoldSortPredicate());
 		//m_islandmanifold.heapSort(btPersistentManifoldSortPredicate());
 
 		//now process all active islands (sets of manifolds for now)
@@ -52,7 +52,6 @@ btSphereBoxCollisionAlgorithm::~btSphereBoxCollisionAlgorithm()
 void btSphereBoxCollisionAlgorithm::processCollision (const btCollisionObjectWrapper* body0Wrap, const btCollisionObjectWrapper* body1Wrap, const btDispatcherInfo& dispatchInfo, btManifoldResult* resultOut)
 {
 	(void)dispatchInfo;
-	(void)resultOut;
 	if (!m_manifoldPtr)
 		return;
 
@@ -66,7 +65,7 @@ void btSphereBoxCollisionAlgorithm::processCollision (const btCollisionObjectWra
 	btVector3 sphereCenter = sphereObjWrap->getWorldTransform().getOrigin();
 	const btSphereShape* sphere0 = (const btSphereShape*)sphereObjWrap->getCollisionShape();
 	btScalar radius = sphere0->getRadius();
-	btScalar maxContactDistance = m_manifoldPtr->getContactBreakingThreshold();
+	btScalar maxContactDistance = m_manifoldPtr->getContactBreakingThreshold()+resultOut->m_closestPointDistanceThreshold;
 
 	resultOut->setPersistentManifold(m_manifoldPtr);
 
@@ -61,8 +61,8 @@ void btSphereSphereCollisionAlgorithm::processCollision (const btCollisionObject
 	m_manifoldPtr->clearManifold(); //don't do this, it disables warmstarting
 #endif
 
-	///iff distance positive, don't generate a new contact
-	if ( len > (radius0+radius1))
+	///iff distance positive, don't generate a new contact, unless it is within the speculative margin
+	if ( len > (radius0+radius1+resultOut->m_closestPointDistanceThreshold))
 	{
 #ifndef CLEAR_MANIFOLD
 		resultOut->refreshContactPoints();
@@ -36,6 +36,7 @@ class btUnionFind
   {
     private:
 		btAlignedObjectArray<btElement>	m_elements;
+		bool	m_smallestIndexRoot;
 
     public:
 	  
@@ -70,6 +71,17 @@ class btUnionFind
 	  void	allocate(int N);
 	  void	Free();
 
+	  ///makes the smallest index the root of a merged set, so island ids don't depend on the order of the unite calls.
+	  ///Used by the deterministic mode, the default keeps the cheaper rule.
+	  void	setSmallestIndexRoot(bool smallestIndexRoot)
+	  {
+		  m_smallestIndexRoot = smallestIndexRoot;
+	  }
+	  bool	isSmallestIndexRoot() const
+	  {
+		  return m_smallestIndexRoot;
+	  }
+
 
 
 
@@ -95,6 +107,8 @@ class btUnionFind
 				m_elements[j].m_id = i; m_elements[i].m_sz += m_elements[j].m_sz; 
 			}
 #else
+			if (m_smallestIndexRoot && j > i)
+				btSwap(i,j);
 			m_elements[i].m_id = j; m_elements[j].m_sz += m_elements[i].m_sz; 
 #endif //USE_PATH_COMPRESSION
 		}
@@ -22,6 +22,10 @@ subject to the following restrictions:
 
 #include "LinearMath/btQuaternion.h"
 #include "LinearMath/btSerializer.h"
+#include "btConvexPolyhedron.h"
+
+///below this number of points a single pass of maxDot over all of them is faster than the walk over the polyhedron
+static const int SUPPORT_SEARCH_THRESHOLD = 128;
 
 btConvexHullShape ::btConvexHullShape (const btScalar* points,int numPoints,int stride) : btPolyhedralConvexAabbCachingShape ()
 {
@@ -52,11 +56,133 @@ void btConvexHullShape::setLocalScaling(const btVector3& scaling)
 void btConvexHullShape::addPoint(const btVector3& point, bool recalculateLocalAabb)
 {
 	m_unscaledPoints.push_back(point);
+	m_polyhedronPointIndices.resize(0);
 	if (recalculateLocalAabb)
 		recalcLocalAabb();
 
 }
 
+bool	btConvexHullShape::initializePolyhedralFeatures(int shiftVerticesByMargin)
+{
+	bool result = btPolyhedralConvexAabbCachingShape::initializePolyhedralFeatures(shiftVerticesByMargin);
+	if (shiftVerticesByMargin)
+		m_polyhedronPointIndices.resize(0);
+	else
+		initializeSupportSearch();
+	return result;
+}
+
+void	btConvexHullShape::setPolyhedralFeatures(const btConvexPolyhedron& polyhedron)
+{
+	btPolyhedralConvexAabbCachingShape::setPolyhedralFeatures(polyhedron);
+	initializeSupportSearch();
+}
+
+void	btConvexHullShape::initializeSupportSearch()
+{
+	m_polyhedronPointIndices.resize(0);
+	const int numPoints = m_unscaledPoints.size();
+	//without edges the polyhedron is flat, its adjacency does not hold once the scaling changes
+	if (!m_polyhedron || numPoints<SUPPORT_SEARCH_THRESHOLD || !m_polyhedron->m_edges.size())
+		return;
+
+	//the walk evaluates the points themselves, so every vertex of the polyhedron needs to be one of them.
+	//That is not the case for a polyhedron shifted by the margin or computed from other points.
+	const btAlignedObjectArray<btVector3>& vertices = m_polyhedron->m_vertices;
+	const int numVertices = vertices.size();
+	//btConvexHullComputer rounds the coordinates to steps of 1/10216 of the extent of the points
+	btVector3 pointsMin = getScaledPoint(0);
+	btVector3 pointsMax = pointsMin;
+	for (int i=1;i<numPoints;i++)
+	{
+		pointsMin.setMin(getScaledPoint(i));
+		pointsMax.setMax(getScaledPoint(i));
+	}
+	const btScalar tolerance = (pointsMax-pointsMin).length()/btScalar(10216);
+	btAlignedObjectArray<int> pointIndices;
+	pointIndices.resize(numVertices);
+	for (int v=0;v<numVertices;v++)
+	{
+		int closest = 0;
+		btScalar closestDistance2 = vertices[v].distance2(getScaledPoint(0));
+		for (int i=1;i<numPoints && closestDistance2>btScalar(0.);i++)
+		{
+			btScalar distance2 = vertices[v].distance2(getScaledPoint(i));
+			if (distance2<closestDistance2)
+			{
+				closest = i;
+				closestDistance2 = distance2;
+			}
+		}
+		if (closestDistance2>tolerance*tolerance)
+			return;
+		pointIndices[v] = closest;
+	}
+
+	for (int axis=0;axis<3;axis++)
+	{
+		int minVertex = -1;
+		int maxVertex = -1;
+		for (int v=0;v<numVertices;v++)
+		{
+			if (m_polyhedron->m_vertexAdjacencyOffsets[v]==m_polyhedron->m_vertexAdjacencyOffsets[v+1])
+				continue;
+			const btScalar coordinate = m_unscaledPoints[pointIndices[v]][axis];
+			if (minVertex<0 || coordinate<m_unscaledPoints[pointIndices[minVertex]][axis])
+				minVertex = v;
+			if (maxVertex<0 || coordinate>m_unscaledPoints[pointIndices[maxVertex]][axis])
+				maxVertex = v;
+		}
+		if (minVertex<0)
+			return;
+		m_supportStartVertices[axis*2] = minVertex;
+		m_supportStartVertices[axis*2+1] = maxVertex;
+	}
+	m_polyhedronPointIndices.copyFromArray(pointIndices);
+}
+
+///returns the index of the point with the largest dot product with scaledDir, the direction multiplied by the scaling
+int	btConvexHullShape::supportingPointIndex(const btVector3& scaledDir, btScalar& maxDot) const
+{
+	if (!m_polyhedronPointIndices.size())
+		return (int) scaledDir.maxDot( &m_unscaledPoints[0], m_unscaledPoints.size(), maxDot);
+
+	//a linear function over a convex polyhedron has no local maximum on its edge graph other than the global one,
+	//so a walk to the best neighbour until none is better ends at the supporting vertex.
+	//It visits a few vertices from one of the extreme ones, instead of all the points.
+	const int* offsets = &m_polyhedron->m_vertexAdjacencyOffsets[0];
+	const int* adjacency = &m_polyhedron->m_vertexAdjacency[0];
+	const int* pointIndices = &m_polyhedronPointIndices[0];
+	int vertex = m_supportStartVertices[0];
+	maxDot = scaledDir.dot(m_unscaledPoints[pointIndices[vertex]]);
+	for (int s=1;s<6;s++)
+	{
+		const btScalar dot = scaledDir.dot(m_unscaledPoints[pointIndices[m_supportStartVertices[s]]]);
+		if (dot>maxDot)
+		{
+			maxDot = dot;
+			vertex = m_supportStartVertices[s];
+		}
+	}
+	for (;;)
+	{
+		int next = -1;
+		for (int n=offsets[vertex];n<offsets[vertex+1];n++)
+		{
+			const btScalar dot = scaledDir.dot(m_unscaledPoints[pointIndices[adjacency[n]]]);
+			if (dot>maxDot)
+			{
+				maxDot = dot;
+				next = adjacency[n];
+			}
+		}
+		if (next<0)
+			break;
+		vertex = next;
+	}
+	return pointIndices[vertex];
+}
+
 btVector3	btConvexHullShape::localGetSupportingVertexWithoutMargin(const btVector3& vec)const
 {
 	btVector3 supVec(btScalar(0.),btScalar(0.),btScalar(0.));
@@ -66,7 +192,7 @@ btVector3	btConvexHullShape::localGetSupportingVertexWithoutMargin(const btVecto
     if( 0 < m_unscaledPoints.size() )
     {
         btVector3 scaled = vec * m_localScaling;
-        int index = (int) scaled.maxDot( &m_unscaledPoints[0], m_unscaledPoints.size(), maxDot); // FIXME: may violate encapsulation of m_unscaledPoints
+        int index = supportingPointIndex( scaled, maxDot); // FIXME: may violate encapsulation of m_unscaledPoints
         return m_unscaledPoints[index] * m_localScaling;
     }
 
@@ -89,7 +215,7 @@ void	btConvexHullShape::batchedUnitVectorGetSupportingVertexWithoutMargin(const
         btVector3 vec = vectors[j] * m_localScaling;        // dot(a*b,c) = dot(a,b*c)
         if( 0 <  m_unscaledPoints.size() )
         {
-            int i = (int) vec.maxDot( &m_unscaledPoints[0], m_unscaledPoints.size(), newDot);
+            int i = supportingPointIndex( vec, newDot);
             supportVerticesOut[j] = getScaledPoint(i);
             supportVerticesOut[j][3] = newDot;        
         }
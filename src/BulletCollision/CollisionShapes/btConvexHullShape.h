@@ -27,6 +27,14 @@ ATTRIBUTE_ALIGNED16(class) btConvexHullShape : public btPolyhedralConvexAabbCach
 {
 	btAlignedObjectArray<btVector3>	m_unscaledPoints;
 
+	///the point of m_unscaledPoints at each vertex of m_polyhedron, empty when the support search cannot walk the polyhedron
+	btAlignedObjectArray<int>	m_polyhedronPointIndices;
+	///the vertices of m_polyhedron furthest along -x, +x, -y, +y, -z and +z, the walk starts at the best of them
+	int	m_supportStartVertices[6];
+
+	void	initializeSupportSearch();
+	int	supportingPointIndex(const btVector3& scaledDir, btScalar& maxDot) const;
+
 public:
 	BT_DECLARE_ALIGNED_ALLOCATOR();
 
@@ -39,6 +47,7 @@ public:
 	void addPoint(const btVector3& point, bool recalculateLocalAabb = true);
 
 	
+	///call initializePolyhedralFeatures again after moving the points, if it was called before
 	btVector3* getUnscaledPoints()
 	{
 		return &m_unscaledPoints[0];
@@ -91,6 +100,10 @@ public:
 	///in case we receive negative scaling
 	virtual void	setLocalScaling(const btVector3& scaling);
 
+	///the support functions of large hulls walk along the edges of the polyhedron instead of testing every point
+	virtual bool	initializePolyhedralFeatures(int shiftVerticesByMargin=0);
+	virtual void	setPolyhedralFeatures(const btConvexPolyhedron& polyhedron);
+
 	virtual	int	calculateSerializeBufferSize() const;
 
 	///fills the dataBuffer and returns the struct name (and 0 on failure)
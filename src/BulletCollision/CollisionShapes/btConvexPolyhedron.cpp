@@ -19,6 +19,7 @@ subject to the following restrictions:
 ///And contact clipping based on work from Simon Hobbs
 
 #include "btConvexPolyhedron.h"
+#include "LinearMath/btConvexHullComputer.h"
 #include "LinearMath/btHashMap.h"
 
 btConvexPolyhedron::btConvexPolyhedron()
@@ -190,6 +191,7 @@ void	btConvexPolyhedron::initialize()
 	}
 	m_localCenter /= TotalArea;
 
+	initializeSeparatingAxisData();
 
 
 
@@ -274,7 +276,185 @@ void	btConvexPolyhedron::initialize()
 #endif
 }
 
-void btConvexPolyhedron::project(const btTransform& trans, const btVector3& dir, btScalar& minProj, btScalar& maxProj, btVector3& witnesPtMin,btVector3& witnesPtMax) const
+void	btConvexPolyhedron::initializeSeparatingAxisData()
+{
+	int numVertices = m_vertices.size();
+	int numBlocks = (numVertices+3)/4;
+	m_vertexBlocks.resize(numBlocks*12);
+	for (int i=0;i<numBlocks*4;i++)
+	{
+		const btVector3& vertex = m_vertices[btMin(i,numVertices-1)];
+		btScalar* block = &m_vertexBlocks[(i/4)*12+(i&3)];
+		block[0] = vertex.x();
+		block[4] = vertex.y();
+		block[8] = vertex.z();
+	}
+
+	m_hullNormals.resize(0);
+	m_hullEdgeDirections.resize(0);
+	m_edges.resize(0);
+	m_vertexAdjacencyOffsets.resize(0);
+	m_vertexAdjacency.resize(0);
+	if (numVertices<3)
+		return;
+
+	btConvexHullComputer conv;
+	conv.compute(&m_vertices[0].getX(),sizeof(btVector3),numVertices,0.f,0.f);
+	const int numFaces = conv.faces.size();
+	const int numEdges = conv.edges.size();
+
+	//the hull vertices are quantized copies of m_vertices, map each of them to the closest one
+	const int numHullVertices = conv.vertices.size();
+	btAlignedObjectArray<int> vertexIndex;
+	vertexIndex.resize(numHullVertices);
+	for (int v=0;v<numHullVertices;v++)
+	{
+		int closest = 0;
+		btScalar closestDistance2 = conv.vertices[v].distance2(m_vertices[0]);
+		for (int j=1;j<numVertices && closestDistance2>btScalar(0.);j++)
+		{
+			btScalar distance2 = conv.vertices[v].distance2(m_vertices[j]);
+			if (distance2<closestDistance2)
+			{
+				closest = j;
+				closestDistance2 = distance2;
+			}
+		}
+		vertexIndex[v] = closest;
+	}
+	//every edge of the hull is stored in both directions, so each one adds the target to the neighbours of its source
+	m_vertexAdjacencyOffsets.resize(numVertices+1,0);
+	for (int e=0;e<numEdges;e++)
+	{
+		m_vertexAdjacencyOffsets[vertexIndex[conv.edges[e].getSourceVertex()]+1]++;
+	}
+	for (int v=0;v<numVertices;v++)
+	{
+		m_vertexAdjacencyOffsets[v+1] += m_vertexAdjacencyOffsets[v];
+	}
+	m_vertexAdjacency.resize(numEdges);
+	btAlignedObjectArray<int> fill;
+	fill.resize(numVertices);
+	for (int v=0;v<numVertices;v++)
+	{
+		fill[v] = m_vertexAdjacencyOffsets[v];
+	}
+	for (int e=0;e<numEdges;e++)
+	{
+		const btConvexHullComputer::Edge& edge = conv.edges[e];
+		m_vertexAdjacency[fill[vertexIndex[edge.getSourceVertex()]]++] = vertexIndex[edge.getTargetVertex()];
+	}
+
+	btAlignedObjectArray<int> faceOfEdge;
+	faceOfEdge.resize(numEdges,-1);
+	m_hullNormals.resize(numFaces);
+	for (int i=0;i<numFaces;i++)
+	{
+		//Newell's method, the faces of btConvexHullComputer are planar and counter-clockwise seen from the outside
+		const btConvexHullComputer::Edge* firstEdge = &conv.edges[conv.faces[i]];
+		const btConvexHullComputer::Edge* edge = firstEdge;
+		btVector3 normal(0,0,0);
+		do
+		{
+			faceOfEdge[int(edge-&conv.edges[0])] = i;
+			const btVector3& v0 = conv.vertices[edge->getSourceVertex()];
+			const btVector3& v1 = conv.vertices[edge->getTargetVertex()];
+			normal += v0.cross(v1);
+			edge = edge->getNextEdgeOfFace();
+		} while (edge!=firstEdge);
+		if (normal.isZero())
+		{
+			m_hullNormals.resize(0);
+			return;
+		}
+		m_hullNormals[i] = normal.normalized();
+	}
+
+	bool closed = numFaces>2;
+	for (int i=0;i<numEdges;i++)
+	{
+		const btConvexHullComputer::Edge& edge = conv.edges[i];
+		const int reverse = int(edge.getReverseEdge()-&conv.edges[0]);
+		if (reverse<i)
+			continue;
+		btVector3 direction = conv.vertices[edge.getTargetVertex()]-conv.vertices[edge.getSourceVertex()];
+		direction.normalize();
+		int index = -1;
+		for (int p=0;p<m_hullEdgeDirections.size();p++)
+		{
+			if (IsAlmostZero(m_hullEdgeDirections[p]-direction) || IsAlmostZero(m_hullEdgeDirections[p]+direction))
+			{
+				index = p;
+				break;
+			}
+		}
+		if (index<0)
+		{
+			index = m_hullEdgeDirections.size();
+			m_hullEdgeDirections.push_back(direction);
+		}
+		btPolyhedronEdge& hullEdge = m_edges.expand();
+		hullEdge.m_face0 = faceOfEdge[i];
+		hullEdge.m_face1 = faceOfEdge[reverse];
+		hullEdge.m_direction = index;
+		if (hullEdge.m_face0<0 || hullEdge.m_face1<0)
+		{
+			closed = false;
+			continue;
+		}
+		//the two faces of a flat hull are opposite, its arcs are not defined by their normals
+		const btVector3& normal0 = m_hullNormals[hullEdge.m_face0];
+		const btVector3& normal1 = m_hullNormals[hullEdge.m_face1];
+		if (normal0.dot(normal1)<0 && normal0.cross(normal1).fuzzyZero())
+			closed = false;
+	}
+	if (!closed)
+		m_edges.resize(0);
+}
+
+void btConvexPolyhedron::project(const btTransform& trans, const btVector3& dir, btScalar& minProj, btScalar& maxProj) const
+{
+	int numBlocks = m_vertexBlocks.size()/12;
+	if (!numBlocks)
+	{
+		btVector3 witnesPtMin,witnesPtMax;
+		project(trans,dir,minProj,maxProj,witnesPtMin,witnesPtMax);
+		return;
+	}
+
+	//project the local vertices onto the direction rotated into local space,
+	//in 4 lanes of independent minima and maxima so the loop maps onto SIMD instructions
+	const btVector3 localDir = dir*trans.getBasis();
+	const btScalar dx = localDir.x();
+	const btScalar dy = localDir.y();
+	const btScalar dz = localDir.z();
+	const btScalar* block = &m_vertexBlocks[0];
+	btScalar minLane[4],maxLane[4];
+	int k;
+	for (k=0;k<4;k++)
+	{
+		minLane[k] = maxLane[k] = block[k]*dx + block[4+k]*dy + block[8+k]*dz;
+	}
+	for (int b=1;b<numBlocks;b++)
+	{
+		block += 12;
+		btScalar dp[4];
+		for (k=0;k<4;k++)
+		{
+			dp[k] = block[k]*dx + block[4+k]*dy + block[8+k]*dz;
+		}
+		for (k=0;k<4;k++)
+		{
+			minLane[k] = dp[k] < minLane[k] ? dp[k] : minLane[k];
+			maxLane[k] = dp[k] > maxLane[k] ? dp[k] : maxLane[k];
+		}
+	}
+	const btScalar offset = dir.dot(trans.getOrigin());
+	minProj = btMin(btMin(minLane[0],minLane[1]),btMin(minLane[2],minLane[3])) + offset;
+	maxProj = btMax(btMax(maxLane[0],maxLane[1]),btMax(maxLane[2],maxLane[3])) + offset;
+}
+
+void btConvexPolyhedron::project(const btTransform& trans, const btVector3& dir, btScalar& minProj, btScalar& maxProj, btVector3& witnesPtMin,btVector3& witnesPtMax) const
 {
 	minProj = FLT_MAX;
 	maxProj = -FLT_MAX;
@@ -33,6 +33,16 @@ struct btFace
 	btScalar	m_plane[4];
 };
 
+///an edge of the convex hull of a btConvexPolyhedron, it is the arc between the normals of its two faces on the Gauss map
+struct btPolyhedronEdge
+{
+	///the faces in m_hullNormals
+	int	m_face0;
+	int	m_face1;
+	///the index of its direction in m_hullEdgeDirections
+	int	m_direction;
+};
+
 
 ATTRIBUTE_ALIGNED16(class) btConvexPolyhedron
 {
@@ -53,10 +63,30 @@ ATTRIBUTE_ALIGNED16(class) btConvexPolyhedron
 	btVector3		mC;
 	btVector3		mE;
 
+	///the vertices in blocks of 4 x, 4 y and 4 z coordinates, so 4 vertices can be projected at a time.
+	///The last block is padded with copies of the last vertex.
+	btAlignedObjectArray<btScalar>	m_vertexBlocks;
+	///the separating axis test uses the exact convex hull of the vertices: m_faces merges nearly coplanar
+	///triangles, so its normals and m_uniqueEdges can miss the axis of least penetration.
+	///These are the face normals of the hull, its edge directions without parallel duplicates, and its edges.
+	btAlignedObjectArray<btVector3>	m_hullNormals;
+	btAlignedObjectArray<btVector3>	m_hullEdgeDirections;
+	///used to skip the edge pairs that do not form a face of the Minkowski difference, empty for flat hulls
+	btAlignedObjectArray<btPolyhedronEdge>	m_edges;
+	///the neighbours on the hull of vertex i are m_vertexAdjacency[m_vertexAdjacencyOffsets[i]] up to m_vertexAdjacency[m_vertexAdjacencyOffsets[i+1]],
+	///in the indices of m_vertices. A walk along them to a neighbour further in a direction finds the supporting vertex in that direction.
+	btAlignedObjectArray<int>	m_vertexAdjacencyOffsets;
+	btAlignedObjectArray<int>	m_vertexAdjacency;
+
 	void	initialize();
+	///computes m_vertexBlocks and the hull data above from m_vertices. Called by initialize, call it after filling
+	///in the polyhedron by other means. Without it the separating axis test uses m_faces, m_uniqueEdges and all edge pairs.
+	void	initializeSeparatingAxisData();
 	bool testContainment() const;
 
-	void project(const btTransform& trans, const btVector3& dir, btScalar& minProj, btScalar& maxProj, btVector3& witnesPtMin,btVector3& witnesPtMax) const;
+	void project(const btTransform& trans, const btVector3& dir, btScalar& minProj, btScalar& maxProj, btVector3& witnesPtMin,btVector3& witnesPtMax) const;
+	///projection without the witness points, 4 vertices at a time when m_vertexBlocks is available
+	void project(const btTransform& trans, const btVector3& dir, btScalar& minProj, btScalar& maxProj) const;
 };
 
 	
@@ -41,16 +41,58 @@ btMultiSphereShape::btMultiSphereShape (const btVector3* positions,const btScala
 
 }
 
-#ifndef MIN
-	#define MIN( _a, _b)    ((_a) < (_b) ? (_a) : (_b))
-#endif
+///returns the sphere with the support point furthest along vec, the support point of a sphere is
+///pos + vec*scaling*rad - vec*margin, so its dot product with vec is pos.dot(vec) + rad*radiusDot minus a constant.
+///The spheres are scanned in 4 lanes of independent maxima, so the loop maps onto SIMD instructions.
+static int	supportingSphere(const btVector3* pos,const btScalar* rad,int numSpheres,const btVector3& vec,btScalar radiusDot)
+{
+	btScalar laneDot[4];
+	int laneIndex[4];
+	int k;
+	for (k=0;k<4;k++)
+	{
+		laneDot[k] = btScalar(-BT_LARGE_FLOAT);
+		laneIndex[k] = 0;
+	}
+	int i=0;
+	for (;i+4<=numSpheres;i+=4)
+	{
+		btScalar dot[4];
+		for (k=0;k<4;k++)
+		{
+			dot[k] = vec.dot(pos[i+k]) + rad[i+k]*radiusDot;
+		}
+		for (k=0;k<4;k++)
+		{
+			if (dot[k] > laneDot[k])
+			{
+				laneDot[k] = dot[k];
+				laneIndex[k] = i+k;
+			}
+		}
+	}
+	for (;i<numSpheres;i++)
+	{
+		btScalar dot = vec.dot(pos[i]) + rad[i]*radiusDot;
+		if (dot > laneDot[0])
+		{
+			laneDot[0] = dot;
+			laneIndex[0] = i;
+		}
+	}
+	int best = 0;
+	for (k=1;k<4;k++)
+	{
+		if (laneDot[k] > laneDot[best])
+			best = k;
+	}
+	return laneIndex[best];
+}
+
  btVector3	btMultiSphereShape::localGetSupportingVertexWithoutMargin(const btVector3& vec0)const
 {
 	btVector3 supVec(0,0,0);
 
-	btScalar maxDot(btScalar(-BT_LARGE_FLOAT));
-
-
 	btVector3 vec = vec0;
 	btScalar lenSqr = vec.length2();
 	if (lenSqr < (SIMD_EPSILON*SIMD_EPSILON))
@@ -62,30 +104,12 @@ btMultiSphereShape::btMultiSphereShape (const btVector3* positions,const btScala
 		vec *= rlen;
 	}
 
-	btVector3 vtx;
-	btScalar newDot;
-
-	const btVector3* pos = &m_localPositionArray[0];
-	const btScalar* rad = &m_radiArray[0];
 	int numSpheres = m_localPositionArray.size();
-
-	for( int k = 0; k < numSpheres; k+= 128 )
+	if (numSpheres)
 	{
-		btVector3 temp[128];
-		int inner_count = MIN( numSpheres - k, 128 );
-        for( long i = 0; i < inner_count; i++ )
-        {
-            temp[i] = (*pos) +vec*m_localScaling*(*rad) - vec * getMargin();
-            pos++;
-            rad++;
-        }
-        long i = vec.maxDot( temp, inner_count, newDot);
-        if( newDot > maxDot )
-		{
-			maxDot = newDot;
-			supVec = temp[i];
-		}
-    }
+		int i = supportingSphere(&m_localPositionArray[0],&m_radiArray[0],numSpheres,vec,vec.dot(vec*m_localScaling));
+		supVec = m_localPositionArray[i] + vec*m_localScaling*m_radiArray[i] - vec * getMargin();
+	}
 
 	return supVec;
 
@@ -93,38 +117,17 @@ btMultiSphereShape::btMultiSphereShape (const btVector3* positions,const btScala
 
  void	btMultiSphereShape::batchedUnitVectorGetSupportingVertexWithoutMargin(const btVector3* vectors,btVector3* supportVerticesOut,int numVectors) const
 {
+	int numSpheres = m_localPositionArray.size();
+	if (!numSpheres)
+		return;
 
+	const btVector3* pos = &m_localPositionArray[0];
+	const btScalar* rad = &m_radiArray[0];
 	for (int j=0;j<numVectors;j++)
 	{
-		btScalar maxDot(btScalar(-BT_LARGE_FLOAT));
-
 		const btVector3& vec = vectors[j];
-
-		btVector3 vtx;
-		btScalar newDot;
-
-		const btVector3* pos = &m_localPositionArray[0];
-		const btScalar* rad = &m_radiArray[0];
-		int numSpheres = m_localPositionArray.size();
-
-        for( int k = 0; k < numSpheres; k+= 128 )
-        {
-            btVector3 temp[128];
-            int inner_count = MIN( numSpheres - k, 128 );
-            for( long i = 0; i < inner_count; i++ )
-            {
-                temp[i] = (*pos) +vec*m_localScaling*(*rad) - vec * getMargin();
-                pos++;
-                rad++;
-            }
-            long i = vec.maxDot( temp, inner_count, newDot);
-            if( newDot > maxDot )
-            {
-                maxDot = newDot;
-                supportVerticesOut[j] = temp[i];
-            }
-        }
-        
+		int i = supportingSphere(pos,rad,numSpheres,vec,vec.dot(vec*m_localScaling));
+		supportVerticesOut[j] = pos[i] + vec*m_localScaling*rad[i] - vec * getMargin();
 	}
 }
 
@@ -40,6 +40,27 @@ btPolyhedralConvexShape::~btPolyhedralConvexShape()
 }
 
 
+void	btPolyhedralConvexShape::setPolyhedralFeatures(const btConvexPolyhedron& polyhedron)
+{
+	if (m_polyhedron)
+	{
+		m_polyhedron->~btConvexPolyhedron();
+		btAlignedFree(m_polyhedron);
+	}
+
+	void* mem = btAlignedAlloc(sizeof(btConvexPolyhedron),16);
+	m_polyhedron = new (mem) btConvexPolyhedron;
+	m_polyhedron->m_vertices.copyFromArray(polyhedron.m_vertices);
+	m_polyhedron->m_faces.copyFromArray(polyhedron.m_faces);
+	m_polyhedron->m_uniqueEdges.copyFromArray(polyhedron.m_uniqueEdges);
+	m_polyhedron->m_localCenter = polyhedron.m_localCenter;
+	m_polyhedron->m_extents = polyhedron.m_extents;
+	m_polyhedron->m_radius = polyhedron.m_radius;
+	m_polyhedron->mC = polyhedron.mC;
+	m_polyhedron->mE = polyhedron.mE;
+	m_polyhedron->initializeSeparatingAxisData();
+}
+
 bool	btPolyhedralConvexShape::initializePolyhedralFeatures(int shiftVerticesByMargin)
 {
 
@@ -43,6 +43,9 @@ public:
 	///experimental/work-in-progress
 	virtual bool	initializePolyhedralFeatures(int shiftVerticesByMargin=0);
 
+	///sets polyhedral features computed before, for example loaded from a shape cache, instead of computing them
+	virtual void	setPolyhedralFeatures(const btConvexPolyhedron& polyhedron);
+
 	const btConvexPolyhedron*	getConvexPolyhedron() const
 	{
 		return m_polyhedron;
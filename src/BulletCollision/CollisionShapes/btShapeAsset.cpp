@@ -0,0 +1,228 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btShapeAsset.h"
+#include "btCompoundShape.h"
+#include "btBvhTriangleMeshShape.h"
+#include "btScaledBvhTriangleMeshShape.h"
+#include "btConvexHullShape.h"
+#include "btConvexPointCloudShape.h"
+#include "btConvexTriangleMeshShape.h"
+#include "btUniformScalingShape.h"
+#include "btTriangleInfoMap.h"
+#include "btOptimizedBvh.h"
+
+#if defined(_WIN32) && !defined(_XBOX)
+#include <windows.h>
+#endif
+
+static int btShapeAssetAtomicAdd(volatile int* value, int delta)
+{
+#if defined(_WIN32) && !defined(_XBOX)
+	return InterlockedExchangeAdd((volatile LONG*)value,delta)+delta;
+#elif defined(__GNUC__)
+	return __sync_add_and_fetch(value,delta);
+#else
+	return (*value) += delta;
+#endif
+}
+
+btShapeAsset::btShapeAsset(btCollisionShape* shape)
+:m_shape(shape),
+m_refCount(1)
+{
+	adoptShape(shape);
+}
+
+btShapeAsset::~btShapeAsset()
+{
+	int i;
+	for (i=m_ownedShapes.size()-1;i>=0;i--)
+	{
+		delete m_ownedShapes[i];
+	}
+	for (i=0;i<m_ownedMeshes.size();i++)
+	{
+		delete m_ownedMeshes[i];
+	}
+	for (i=0;i<m_ownedTriangleInfoMaps.size();i++)
+	{
+		delete m_ownedTriangleInfoMaps[i];
+	}
+	for (i=0;i<m_ownedBvhs.size();i++)
+	{
+		m_ownedBvhs[i]->~btOptimizedBvh();
+		btAlignedFree(m_ownedBvhs[i]);
+	}
+}
+
+void	btShapeAsset::adoptShape(btCollisionShape* shape)
+{
+	if (!shape || m_ownedShapeSet.find(shape))
+		return;
+	btAssert(shape->getShapeType() != GIMPACT_SHAPE_PROXYTYPE);
+
+	//children are adopted before their parent, so deleting in reverse order destroys parents first
+	switch (shape->getShapeType())
+	{
+	case COMPOUND_SHAPE_PROXYTYPE:
+		{
+			btCompoundShape* compound = (btCompoundShape*)shape;
+			for (int i=0;i<compound->getNumChildShapes();i++)
+			{
+				adoptShape(compound->getChildShape(i));
+			}
+			break;
+		}
+	case TRIANGLE_MESH_SHAPE_PROXYTYPE:
+	case MULTIMATERIAL_TRIANGLE_MESH_PROXYTYPE:
+		{
+			btBvhTriangleMeshShape* mesh = (btBvhTriangleMeshShape*)shape;
+			if (mesh->getMeshInterface() && m_ownedMeshes.findLinearSearch(mesh->getMeshInterface()) == m_ownedMeshes.size())
+				m_ownedMeshes.push_back(mesh->getMeshInterface());
+			if (mesh->getTriangleInfoMap() && m_ownedTriangleInfoMaps.findLinearSearch(mesh->getTriangleInfoMap()) == m_ownedTriangleInfoMaps.size())
+				m_ownedTriangleInfoMaps.push_back(mesh->getTriangleInfoMap());
+			//a bvh set with setOptimizedBvh is not deleted by the shape
+			if (!mesh->getOwnsBvh() && mesh->getOptimizedBvh() && m_ownedBvhs.findLinearSearch(mesh->getOptimizedBvh()) == m_ownedBvhs.size())
+				m_ownedBvhs.push_back(mesh->getOptimizedBvh());
+			break;
+		}
+	case CONVEX_TRIANGLEMESH_SHAPE_PROXYTYPE:
+		{
+			btConvexTriangleMeshShape* mesh = (btConvexTriangleMeshShape*)shape;
+			if (mesh->getMeshInterface() && m_ownedMeshes.findLinearSearch(mesh->getMeshInterface()) == m_ownedMeshes.size())
+				m_ownedMeshes.push_back(mesh->getMeshInterface());
+			break;
+		}
+	case SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE:
+		{
+			adoptShape(((btScaledBvhTriangleMeshShape*)shape)->getChildShape());
+			break;
+		}
+	case UNIFORM_SCALING_SHAPE_PROXYTYPE:
+		{
+			adoptShape(((btUniformScalingShape*)shape)->getChildShape());
+			break;
+		}
+	default:
+		break;
+	}
+
+	m_ownedShapeSet.insert(shape,m_ownedShapes.size());
+	m_ownedShapes.push_back(shape);
+}
+
+void	btShapeAsset::addRef()
+{
+	btShapeAssetAtomicAdd(&m_refCount,1);
+}
+
+void	btShapeAsset::release()
+{
+	if (btShapeAssetAtomicAdd(&m_refCount,-1) == 0)
+	{
+		delete this;
+	}
+}
+
+bool	btShapeAsset::ownsShape(const btCollisionShape* shape) const
+{
+	return m_ownedShapeSet.find(shape) != 0;
+}
+
+btCollisionShape*	btShapeAsset::createInstance(const btVector3& scaling)
+{
+	btCollisionShape* instance = m_shape;
+	if (scaling != btVector3(btScalar(1.),btScalar(1.),btScalar(1.)))
+	{
+		instance = createScaledShape(m_shape,scaling);
+	}
+	if (instance)
+	{
+		addRef();
+	}
+	return instance;
+}
+
+void	btShapeAsset::releaseInstance(btCollisionShape* instance)
+{
+	if (!instance)
+		return;
+	destroyScaledShape(instance);
+	release();
+}
+
+btCollisionShape*	btShapeAsset::createScaledShape(btCollisionShape* shape, const btVector3& scaling) const
+{
+	switch (shape->getShapeType())
+	{
+	case TRIANGLE_MESH_SHAPE_PROXYTYPE:
+	case MULTIMATERIAL_TRIANGLE_MESH_PROXYTYPE:
+		{
+			return new btScaledBvhTriangleMeshShape((btBvhTriangleMeshShape*)shape,scaling);
+		}
+	case CONVEX_HULL_SHAPE_PROXYTYPE:
+		{
+			//the point cloud references the points of the hull instead of copying them
+			btConvexHullShape* hull = (btConvexHullShape*)shape;
+			btConvexPointCloudShape* cloud = new btConvexPointCloudShape(hull->getUnscaledPoints(),hull->getNumPoints(),hull->getLocalScaling()*scaling,false);
+			cloud->setMargin(hull->getMargin());
+			cloud->recalcLocalAabb();
+			return cloud;
+		}
+	case COMPOUND_SHAPE_PROXYTYPE:
+		{
+			btCompoundShape* compound = (btCompoundShape*)shape;
+			btCompoundShape* scaledCompound = new btCompoundShape(compound->getDynamicAabbTree() != 0);
+			scaledCompound->setMargin(compound->getMargin());
+			for (int i=0;i<compound->getNumChildShapes();i++)
+			{
+				btCollisionShape* child = createScaledShape(compound->getChildShape(i),scaling);
+				if (!child)
+				{
+					destroyScaledShape(scaledCompound);
+					return 0;
+				}
+				btTransform childTransform = compound->getChildTransform(i);
+				childTransform.setOrigin(childTransform.getOrigin()*scaling);
+				scaledCompound->addChildShape(childTransform,child);
+			}
+			return scaledCompound;
+		}
+	default:
+		{
+			if (shape->isConvex() && scaling.x() == scaling.y() && scaling.x() == scaling.z())
+			{
+				return new btUniformScalingShape((btConvexShape*)shape,scaling.x());
+			}
+		}
+	}
+	return 0;
+}
+
+void	btShapeAsset::destroyScaledShape(btCollisionShape* shape) const
+{
+	if (ownsShape(shape))
+		return;
+	if (shape->getShapeType() == COMPOUND_SHAPE_PROXYTYPE)
+	{
+		btCompoundShape* compound = (btCompoundShape*)shape;
+		for (int i=0;i<compound->getNumChildShapes();i++)
+		{
+			destroyScaledShape(compound->getChildShape(i));
+		}
+	}
+	delete shape;
+}
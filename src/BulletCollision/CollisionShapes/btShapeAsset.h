@@ -0,0 +1,100 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_SHAPE_ASSET_H
+#define BT_SHAPE_ASSET_H
+
+#include "LinearMath/btVector3.h"
+#include "LinearMath/btAlignedObjectArray.h"
+#include "LinearMath/btHashMap.h"
+
+class btCollisionShape;
+class btStridingMeshInterface;
+struct btTriangleInfoMap;
+class btOptimizedBvh;
+
+///btShapeAsset is a reference counted, immutable collision shape that many collision objects, in any number of worlds
+///and threads, can share. It owns the whole shape hierarchy passed to its constructor: the children of compound shapes,
+///the mesh interface, bvh and triangle info map of triangle mesh shapes. Collision queries only read shapes, so a shared
+///shape is safe to use from several worlds stepping in parallel, as long as nobody modifies it (no setLocalScaling,
+///setMargin, addChildShape or bvh refit) once the asset is created.
+///Per-instance state lives outside the asset: use createInstance for a scaled instance and the user pointer of the
+///btCollisionObject instead of the one of the shape. Create assets while no btAllocatorContext is installed, so releasing
+///the memory of one world does not free a shape others still use. btGImpact shapes lock their mesh during queries and can't be shared.
+class btShapeAsset
+{
+	btCollisionShape*	m_shape;
+	volatile int		m_refCount;
+
+	//everything deleted with the asset, including m_shape
+	btAlignedObjectArray<btCollisionShape*>	m_ownedShapes;
+	btAlignedObjectArray<btStridingMeshInterface*>	m_ownedMeshes;
+	btAlignedObjectArray<btTriangleInfoMap*>	m_ownedTriangleInfoMaps;
+	btAlignedObjectArray<btOptimizedBvh*>	m_ownedBvhs;
+	btHashMap<btHashPtr,int>	m_ownedShapeSet;
+
+	void	adoptShape(btCollisionShape* shape);
+	btCollisionShape*	createScaledShape(btCollisionShape* shape, const btVector3& scaling) const;
+	void	destroyScaledShape(btCollisionShape* shape) const;
+
+	btShapeAsset(const btShapeAsset&);
+	btShapeAsset& operator=(const btShapeAsset&);
+
+	///use release
+	~btShapeAsset();
+
+public:
+
+	///takes ownership of shape and everything it references, which must not be part of another asset.
+	///The reference count starts at one, owned by the caller.
+	btShapeAsset(btCollisionShape* shape);
+
+	void	addRef();
+
+	///drops a reference, the asset and its shapes are deleted with the last one
+	void	release();
+
+	int		getRefCount() const
+	{
+		return m_refCount;
+	}
+
+	///the shared shape. Hand it to collision objects as is, but don't modify it
+	btCollisionShape*	getShape() const
+	{
+		return m_shape;
+	}
+
+	///returns the shape to use for a collision object scaled by scaling, and adds a reference to the asset.
+	///Unit scaling returns the shared shape itself. Otherwise a small wrapper referencing the shared data is created:
+	///a btScaledBvhTriangleMeshShape for triangle meshes, a btConvexPointCloudShape on the points of a convex hull,
+	///a btUniformScalingShape for other convex shapes (uniform scaling only) and a compound of scaled children for compounds.
+	///Returns 0 when the shape can't be scaled this way. Pass the result to releaseInstance when the object is destroyed.
+	btCollisionShape*	createInstance(const btVector3& scaling = btVector3(btScalar(1.),btScalar(1.),btScalar(1.)));
+
+	///deletes the wrapper shapes of an instance, if any, and drops its reference. The asset may be deleted.
+	void	releaseInstance(btCollisionShape* instance);
+
+	///true when shape is part of the asset (the shared shape or one of its children)
+	bool	ownsShape(const btCollisionShape* shape) const;
+
+	///number of collision shapes owned by the asset, the shared shape included
+	int		getNumOwnedShapes() const
+	{
+		return m_ownedShapes.size();
+	}
+};
+
+#endif //BT_SHAPE_ASSET_H
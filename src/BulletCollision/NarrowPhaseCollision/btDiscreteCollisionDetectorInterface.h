@@ -37,6 +37,11 @@ struct btDiscreteCollisionDetectorInterface
 		virtual void setShapeIdentifiersA(int partId0,int index0)=0;
 		virtual void setShapeIdentifiersB(int partId1,int index1)=0;
 		virtual void addContactPoint(const btVector3& normalOnBInWorld,const btVector3& pointInWorld,btScalar depth)=0;
+		///setFeatureId passes the btManifoldPoint::m_featureId of the next addContactPoint, detectors that track features call it before each point
+		virtual void setFeatureId(int featureId)
+		{
+			(void)featureId;
+		}
 	};
 
 	struct ClosestPointInput
@@ -49,6 +49,7 @@ m_shapeTypeB(objectB->getShapeType()),
 m_marginA(objectA->getMargin()),
 m_marginB(objectB->getMargin()),
 m_ignoreMargin(false),
+m_useCachedSeparatingAxis(false),
 m_lastUsedMethod(-1),
 m_catchDegeneracies(1),
 m_fixContactNormalDirection(1)
@@ -65,6 +66,7 @@ m_shapeTypeB(shapeTypeB),
 m_marginA(marginA),
 m_marginB(marginB),
 m_ignoreMargin(false),
+m_useCachedSeparatingAxis(false),
 m_lastUsedMethod(-1),
 m_catchDegeneracies(1),
 m_fixContactNormalDirection(1)
@@ -117,7 +119,9 @@ void btGjkPairDetector::getClosestPointsNonVirtual(const ClosestPointInput& inpu
 
 	m_curIter = 0;
 	int gGjkMaxIter = 1000;//this is to catch invalid input, perhaps check for #NaN?
-	m_cachedSeparatingAxis.setValue(0,1,0);
+	//start from the axis of the previous query only when asked to, see setUseCachedSeparatingAxis
+	if (!m_useCachedSeparatingAxis || m_cachedSeparatingAxis.fuzzyZero())
+		m_cachedSeparatingAxis.setValue(0,1,0);
 
 	bool isValid = false;
 	bool checkSimplex = false;
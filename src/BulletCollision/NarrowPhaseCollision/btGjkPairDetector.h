@@ -42,6 +42,7 @@ class btGjkPairDetector : public btDiscreteCollisionDetectorInterface
 	btScalar	m_marginB;
 
 	bool		m_ignoreMargin;
+	bool		m_useCachedSeparatingAxis;
 	btScalar	m_cachedSeparatingDistance;
 	
 
@@ -72,6 +73,7 @@ public:
 	{
 		m_minkowskiB = minkB;
 	}
+	///with setUseCachedSeparatingAxis(true) GJK starts from this axis instead of (0,1,0), the separating axis of a previous query of the pair makes it converge in fewer iterations
 	void setCachedSeperatingAxis(const btVector3& seperatingAxis)
 	{
 		m_cachedSeparatingAxis = seperatingAxis;
@@ -97,6 +99,12 @@ public:
 		m_ignoreMargin = ignoreMargin;
 	}
 
+	///keep the cached separating axis between queries, off by default. Only useful when the detector is fed the axis of the same pair
+	void	setUseCachedSeparatingAxis(bool useCachedSeparatingAxis)
+	{
+		m_useCachedSeparatingAxis = useCachedSeparatingAxis;
+	}
+
 
 };
 
@@ -37,6 +37,17 @@ typedef sce::PhysicsEffects::PfxConstraintRow btConstraintRow;
 
 
 
+///combines the indices of the features that generate a contact point into a btManifoldPoint::m_featureId, which is never 0
+SIMD_FORCE_INLINE int	btContactFeatureId(int featureA, int featureB, int featureC)
+{
+	unsigned int hash = 2166136261u;
+	hash = (hash ^ (unsigned int)featureA) * 16777619u;
+	hash = (hash ^ (unsigned int)featureB) * 16777619u;
+	hash = (hash ^ (unsigned int)featureC) * 16777619u;
+	hash &= 0x7fffffff;
+	return hash ? int(hash) : 1;
+}
+
 /// ManifoldContactPoint collects and maintains persistent contactpoints.
 /// used to improve stability and performance of rigidbody dynamics response.
 class btManifoldPoint
@@ -52,7 +63,8 @@ class btManifoldPoint
 				m_contactMotion2(0.f),
 				m_contactCFM1(0.f),
 				m_contactCFM2(0.f),
-				m_lifeTime(0)
+				m_lifeTime(0),
+				m_featureId(0)
 			{
 			}
 
@@ -75,7 +87,8 @@ class btManifoldPoint
 					m_contactMotion2(0.f),
 					m_contactCFM1(0.f),
 					m_contactCFM2(0.f),
-					m_lifeTime(0)
+					m_lifeTime(0),
+					m_featureId(0)
 			{
 				
 			}
@@ -112,6 +125,10 @@ class btManifoldPoint
 			btScalar		m_contactCFM2;
 
 			int				m_lifeTime;//lifetime of the contactpoint in frames
+
+			///identifies the features (faces, edges, vertices) that generated the point, see btContactFeatureId.
+			///Points with a feature id are matched to the cached points by id instead of distance, 0 means unknown.
+			int				m_featureId;
 			
 			btVector3		m_lateralFrictionDir1;
 			btVector3		m_lateralFrictionDir2;
@@ -31,6 +31,7 @@ btPersistentManifold::btPersistentManifold()
 m_body0(0),
 m_body1(0),
 m_cachedPoints (0),
+m_speculativeMargin(btScalar(0.)),
 m_index1a(0)
 {
 }
@@ -185,10 +186,127 @@ int btPersistentManifold::sortCachedPoints(const btManifoldPoint& pt)
 }
 
 
+///twice the area of the convex hull of the points, and the largest squared distance between them for hulls without area
+static void	btContactPolygonSize(btVector3* points, int numPoints, const btVector3& normal, btScalar& area, btScalar& diameter)
+{
+	btVector3 axis0,axis1;
+	btPlaneSpace1(normal,axis0,axis1);
+	btScalar u[MANIFOLD_CACHE_SIZE+1],v[MANIFOLD_CACHE_SIZE+1];
+	int i,j;
+	diameter = btScalar(0.);
+	for (i=0;i<numPoints;i++)
+	{
+		u[i] = axis0.dot(points[i]);
+		v[i] = axis1.dot(points[i]);
+		for (j=0;j<i;j++)
+		{
+			diameter = btMax(diameter,(points[i]-points[j]).length2());
+		}
+	}
+
+	//gift wrapping, the polygons only have a few points
+	area = btScalar(0.);
+	if (numPoints < 3)
+		return;
+	int start = 0;
+	for (i=1;i<numPoints;i++)
+	{
+		if (u[i] < u[start] || (u[i] == u[start] && v[i] < v[start]))
+			start = i;
+	}
+	int current = start;
+	for (int count=0;count<numPoints;count++)
+	{
+		int next = -1;
+		for (i=0;i<numPoints;i++)
+		{
+			btScalar du = u[i]-u[current];
+			btScalar dv = v[i]-v[current];
+			if (du == btScalar(0.) && dv == btScalar(0.))
+				continue;
+			if (next < 0)
+			{
+				next = i;
+				continue;
+			}
+			btScalar nu = u[next]-u[current];
+			btScalar nv = v[next]-v[current];
+			btScalar cross = nu*dv - nv*du;
+			if (cross < btScalar(0.) || (cross == btScalar(0.) && du*du+dv*dv > nu*nu+nv*nv))
+				next = i;
+		}
+		if (next < 0)
+			break;
+		area += u[current]*v[next] - u[next]*v[current];
+		current = next;
+		if (current == start)
+			break;
+	}
+	area = btFabs(area);
+}
+
+int btPersistentManifold::reduceCachedPoints(const btManifoldPoint& pt)
+{
+	int numPoints = getNumContacts();
+	int maxPenetrationIndex = -1;
+	btScalar maxPenetration = pt.getDistance();
+	int i,j;
+	for (i=0;i<numPoints;i++)
+	{
+		if (m_pointCache[i].getDistance() < maxPenetration)
+		{
+			maxPenetrationIndex = i;
+			maxPenetration = m_pointCache[i].getDistance();
+		}
+	}
+
+	//the new point always stays, remove the cached point that is covered best by the others
+	int bestIndex = maxPenetrationIndex==0 && numPoints>1 ? 1 : 0;
+	btScalar bestArea(-1.),bestDiameter(-1.);
+	btVector3 points[MANIFOLD_CACHE_SIZE+1];
+	for (i=0;i<numPoints;i++)
+	{
+		if (i == maxPenetrationIndex)
+			continue;
+		int count = 0;
+		points[count++] = pt.m_positionWorldOnA;
+		for (j=0;j<numPoints;j++)
+		{
+			if (j != i)
+				points[count++] = m_pointCache[j].m_positionWorldOnA;
+		}
+		btScalar area,diameter;
+		btContactPolygonSize(points,count,pt.m_normalWorldOnB,area,diameter);
+		if (area > bestArea || (area == bestArea && diameter > bestDiameter))
+		{
+			bestArea = area;
+			bestDiameter = diameter;
+			bestIndex = i;
+		}
+	}
+	return bestIndex;
+}
+
+
 int btPersistentManifold::getCacheEntry(const btManifoldPoint& newPoint) const
 {
-	btScalar shortestDist =  getContactBreakingThreshold() * getContactBreakingThreshold();
 	int size = getNumContacts();
+	if (newPoint.m_featureId)
+	{
+		//points generated by the same features, for example by polyhedral clipping, match exactly
+		for( int i = 0; i < size; i++ )
+		{
+			const btManifoldPoint &mp = m_pointCache[i];
+			if (mp.m_featureId == newPoint.m_featureId &&
+				mp.m_partId0 == newPoint.m_partId0 && mp.m_index0 == newPoint.m_index0 &&
+				mp.m_partId1 == newPoint.m_partId1 && mp.m_index1 == newPoint.m_index1)
+			{
+				return i;
+			}
+		}
+	}
+
+	btScalar shortestDist =  getContactBreakingThreshold() * getContactBreakingThreshold();
 	int nearestPoint = -1;
 	for( int i = 0; i < size; i++ )
 	{
@@ -215,11 +333,11 @@ int btPersistentManifold::addManifoldPoint(const btManifoldPoint& newPoint, bool
 	int insertIndex = getNumContacts();
 	if (insertIndex == MANIFOLD_CACHE_SIZE)
 	{
-#if MANIFOLD_CACHE_SIZE >= 4
+#if MANIFOLD_CACHE_SIZE == 4
 		//sort cache so best points come first, based on area
 		insertIndex = sortCachedPoints(newPoint);
 #else
-		insertIndex = 0;
+		insertIndex = reduceCachedPoints(newPoint);
 #endif
 		clearUserCache(m_pointCache[insertIndex]);
 		
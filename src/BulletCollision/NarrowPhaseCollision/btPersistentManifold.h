@@ -40,14 +40,19 @@ enum btContactManifoldTypes
 	BT_PERSISTENT_MANIFOLD_TYPE
 };
 
+///MANIFOLD_CACHE_SIZE is the capacity of a contact manifold. It can be configured for the whole build, including the code
+///that includes Bullet, for example with the BULLET_MANIFOLD_CACHE_SIZE cmake option.
+#ifndef MANIFOLD_CACHE_SIZE
 #define MANIFOLD_CACHE_SIZE 4
+#endif
 
 ///btPersistentManifold is a contact point cache, it stays persistent as long as objects are overlapping in the broadphase.
 ///Those contact points are created by the collision narrow phase.
-///The cache can be empty, or hold 1,2,3 or 4 points. Some collision algorithms (GJK) might only add one point at a time.
+///The cache can be empty, or hold up to MANIFOLD_CACHE_SIZE points. Some collision algorithms (GJK) might only add one point at a time.
 ///updates/refreshes old contact points, and throw them away if necessary (distance becomes too large)
-///reduces the cache to 4 points, when more then 4 points are added, using following rules:
+///reduces the cache to MANIFOLD_CACHE_SIZE points, when more points are added, using following rules:
 ///the contact point with deepest penetration is always kept, and it tries to maximuze the area covered by the points
+///new points replace the cached point with the same btManifoldPoint::m_featureId, or else the nearest one
 ///note that some pairs of objects might have more then one contact manifold.
 
 
@@ -65,11 +70,16 @@ ATTRIBUTE_ALIGNED128( class) btPersistentManifold : public btTypedObject
 
 	btScalar	m_contactBreakingThreshold;
 	btScalar	m_contactProcessingThreshold;
+	///speculative contacts up to this distance beyond the contact breaking threshold stay in the manifold
+	btScalar	m_speculativeMargin;
 
 	
 	/// sort cached points so most isolated points come first
 	int	sortCachedPoints(const btManifoldPoint& pt);
 
+	///reduction for other cache sizes than 4, returns the cached point whose removal leaves the largest contact polygon
+	int	reduceCachedPoints(const btManifoldPoint& pt);
+
 	int		findContactPoint(const btManifoldPoint* unUsed, int numUnused,const btManifoldPoint& pt);
 
 public:
@@ -87,7 +97,8 @@ public:
 		: btTypedObject(BT_PERSISTENT_MANIFOLD_TYPE),
 	m_body0(body0),m_body1(body1),m_cachedPoints(0),
 		m_contactBreakingThreshold(contactBreakingThreshold),
-		m_contactProcessingThreshold(contactProcessingThreshold)
+		m_contactProcessingThreshold(contactProcessingThreshold),
+		m_speculativeMargin(btScalar(0.))
 	{
 	}
 
@@ -143,6 +154,17 @@ public:
 	{
 		m_contactProcessingThreshold = contactProcessingThreshold;
 	}
+
+	btScalar	getSpeculativeMargin() const
+	{
+		return m_speculativeMargin;
+	}
+
+	///set by btManifoldResult::setPersistentManifold, see btDispatcherInfo::m_useSpeculativeContacts
+	void setSpeculativeMargin(btScalar speculativeMargin)
+	{
+		m_speculativeMargin = speculativeMargin;
+	}
 	
 	
 
@@ -212,7 +234,7 @@ public:
 	
 	bool validContactDistance(const btManifoldPoint& pt) const
 	{
-		return pt.m_distance1 <= getContactBreakingThreshold();
+		return pt.m_distance1 <= getContactBreakingThreshold()+m_speculativeMargin;
 	}
 	/// calculated new worldspace coordinates and depth, and reject points that exceed the collision margin
 	void	refreshContactPoints(  const btTransform& trA,const btTransform& trB);
@@ -21,6 +21,10 @@ subject to the following restrictions:
 
 #include "btPolyhedralContactClipping.h"
 #include "BulletCollision/CollisionShapes/btConvexPolyhedron.h"
+#include "btManifoldPoint.h"
+
+#include "LinearMath/btFrameArena.h"
+#include "LinearMath/btInlineObjectArray.h"
 
 #include <float.h> //for FLT_MAX
 
@@ -76,6 +80,61 @@ void btPolyhedralContactClipping::clipFace(const btVertexArray& pVtxIn, btVertex
 	}
 }
 
+void btPolyhedralContactClipping::clipFace(const btVertexArray& pVtxIn, btVertexArray& ppVtxOut, const btVector3& planeNormalWS,btScalar planeEqWS,
+										   const btVertexFeatureArray& featuresIn, btVertexFeatureArray& featuresOut, int planeLabel)
+{
+	int ve;
+	btScalar ds, de;
+	int numVerts = pVtxIn.size();
+	if (numVerts < 2)
+		return;
+
+	btVector3 firstVertex=pVtxIn[pVtxIn.size()-1];
+	btVector3 endVertex = pVtxIn[0];
+	int firstFeature = featuresIn[numVerts-1];
+	
+	ds = planeNormalWS.dot(firstVertex)+planeEqWS;
+
+	for (ve = 0; ve < numVerts; ve++)
+	{
+		endVertex=pVtxIn[ve];
+		int endFeature = featuresIn[ve];
+		//the edge from firstVertex to endVertex
+		int edgeLabel = firstFeature & 0xffff;
+
+		de = planeNormalWS.dot(endVertex)+planeEqWS;
+
+		if (ds<0)
+		{
+			if (de<0)
+			{
+				ppVtxOut.push_back(endVertex);
+				featuresOut.push_back(endFeature);
+			}
+			else
+			{
+				// leaves through the plane
+				ppVtxOut.push_back( 	firstVertex.lerp(endVertex,btScalar(ds * 1.f/(ds - de))));
+				featuresOut.push_back((edgeLabel<<16)|planeLabel);
+			}
+		}
+		else
+		{
+			if (de<0)
+			{
+				// enters through the plane
+				ppVtxOut.push_back(firstVertex.lerp(endVertex,btScalar(ds * 1.f/(ds - de))));
+				featuresOut.push_back((planeLabel<<16)|edgeLabel);
+				ppVtxOut.push_back(endVertex);
+				featuresOut.push_back(endFeature);
+			}
+		}
+		firstVertex = endVertex;
+		firstFeature = endFeature;
+		ds = de;
+	}
+}
+
 
 static bool TestSepAxis(const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, const btVector3& sep_axis, btScalar& depth, btVector3& witnessPointA, btVector3& witnessPointB)
 {
@@ -110,6 +169,20 @@ static bool TestSepAxis(const btConvexPolyhedron& hullA, const btConvexPolyhedro
 	return true;
 }
 
+///TestSepAxis without the witness points, using the faster projection
+static bool TestSepAxis(const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, const btVector3& sep_axis, btScalar& depth)
+{
+	btScalar Min0,Max0;
+	btScalar Min1,Max1;
+	hullA.project(transA,sep_axis,Min0,Max0);
+	hullB.project(transB,sep_axis,Min1,Max1);
+
+	if(Max0<Min1 || Max1<Min0)
+		return false;
+
+	depth = btMin(Max0 - Min1,Max1 - Min0);
+	return true;
+}
 
 
 static int gActualSATPairTests=0;
@@ -237,7 +310,94 @@ void InverseTransformPoint3x3(btVector3& out, const btVector3& in, const btTrans
 
 
 
-bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, btVector3& sep, btDiscreteCollisionDetectorInterface::Result& resultOut)
+///the separating axis test takes the face normals and edge directions of the exact hull when the polyhedron has them
+static SIMD_FORCE_INLINE int	GetNumSeparatingNormals(const btConvexPolyhedron& hull)
+{
+	return hull.m_hullNormals.size() ? hull.m_hullNormals.size() : hull.m_faces.size();
+}
+
+static SIMD_FORCE_INLINE btVector3	GetSeparatingNormal(const btConvexPolyhedron& hull, int i)
+{
+	if (hull.m_hullNormals.size())
+		return hull.m_hullNormals[i];
+	const btFace& face = hull.m_faces[i];
+	return btVector3(face.m_plane[0],face.m_plane[1],face.m_plane[2]);
+}
+
+static SIMD_FORCE_INLINE const btAlignedObjectArray<btVector3>&	GetSeparatingEdges(const btConvexPolyhedron& hull)
+{
+	return hull.m_hullNormals.size() ? hull.m_hullEdgeDirections : hull.m_uniqueEdges;
+}
+
+///arcs closer than this to the plane of the other arc count as crossing it, to keep the edge pairs of touching
+///arcs despite the rounding of the normals
+#define BT_GAUSS_MAP_TOLERANCE btScalar(1e-4)
+
+static SIMD_FORCE_INLINE bool	IsOnSameSide(btScalar d0, btScalar d1, btScalar tolerance)
+{
+	return (d0 > tolerance && d1 > tolerance) || (d0 < -tolerance && d1 < -tolerance);
+}
+
+///the Gauss map arcs of edge a of A (between normals a0,a1) and edge b of B (between the negated normals b0,b1, all in the same frame)
+///intersect when the edge pair forms a face of the Minkowski difference. a1xa0 and b1xb0 are the cross products of the normals,
+///arcs that miss the plane of the other arc by less than toleranceA or toleranceB count as intersecting.
+static SIMD_FORCE_INLINE bool	IsMinkowskiFace(const btVector3& a0, const btVector3& a1, const btVector3& a1xa0, btScalar toleranceA,
+	const btVector3& b0, const btVector3& b1, const btVector3& b1xb0, btScalar toleranceB)
+{
+	const btScalar cba = b0.dot(a1xa0);
+	const btScalar dba = b1.dot(a1xa0);
+	const btScalar adc = a0.dot(b1xb0);
+	const btScalar bdc = a1.dot(b1xb0);
+	//both arcs cross the plane of the other one, and not on the far side of the sphere
+	return !IsOnSameSide(cba,dba,toleranceA) && !IsOnSameSide(adc,bdc,toleranceB) && cba*bdc > -toleranceA*toleranceB;
+}
+
+///sets uniquePairs[e0*numUniqueEdgesB+e1] for the pairs of edge directions that have a pair of edges forming a face of the
+///Minkowski difference. Only the cross products of those can be the separating axis with the smallest depth.
+static void	FindMinkowskiEdgePairs(const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, btAlignedObjectArray<unsigned char>& uniquePairs)
+{
+	btFrameArena* arena = btGetThreadFrameArena();
+	btFrameArenaScope arenaScope(arena);
+	//the normals and their cross products of the edges of B, in the local space of A
+	const int numEdgesB = hullB.m_edges.size();
+	btInlineObjectArray<btVector3,64> arcsB;
+	btInlineObjectArray<btScalar,32> tolerancesB;
+	btFrameArenaReserve(arena,arcsB,numEdgesB*3);
+	btFrameArenaReserve(arena,tolerancesB,numEdgesB);
+	arcsB.resizeNoInitialize(numEdgesB*3);
+	tolerancesB.resizeNoInitialize(numEdgesB);
+	const btMatrix3x3 basisBtoA = transA.getBasis().transposeTimes(transB.getBasis());
+	for (int i=0;i<numEdgesB;i++)
+	{
+		arcsB[i*3] = -(basisBtoA*hullB.m_hullNormals[hullB.m_edges[i].m_face0]);
+		arcsB[i*3+1] = -(basisBtoA*hullB.m_hullNormals[hullB.m_edges[i].m_face1]);
+		arcsB[i*3+2] = arcsB[i*3+1].cross(arcsB[i*3]);
+		tolerancesB[i] = BT_GAUSS_MAP_TOLERANCE*arcsB[i*3+2].length();
+	}
+
+	const int numUniqueEdgesB = hullB.m_hullEdgeDirections.size();
+	for (int i=0;i<hullA.m_edges.size();i++)
+	{
+		const btPolyhedronEdge& edgeA = hullA.m_edges[i];
+		const btVector3& a0 = hullA.m_hullNormals[edgeA.m_face0];
+		const btVector3& a1 = hullA.m_hullNormals[edgeA.m_face1];
+		const btVector3 a1xa0 = a1.cross(a0);
+		const btScalar toleranceA = BT_GAUSS_MAP_TOLERANCE*a1xa0.length();
+		unsigned char* pairs = &uniquePairs[edgeA.m_direction*numUniqueEdgesB];
+		for (int j=0;j<numEdgesB;j++)
+		{
+			if (IsMinkowskiFace(a0,a1,a1xa0,toleranceA,arcsB[j*3],arcsB[j*3+1],arcsB[j*3+2],tolerancesB[j]))
+			{
+				pairs[hullB.m_edges[j].m_direction] = 1;
+			}
+		}
+	}
+}
+
+///the Gauss map test of an edge pair costs about as much as projecting this many vertices
+#define BT_MINKOWSKI_EDGE_PAIR_COST 4
+
+bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, btVector3& sep, btDiscreteCollisionDetectorInterface::Result& resultOut, btSeparatingAxisCache* axisCache)
 {
 	gActualSATPairTests++;
 
@@ -249,12 +409,55 @@ bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron&
 
 	btScalar dmin = FLT_MAX;
 	int curPlaneTests=0;
+	int bestType = btSeparatingAxisCache::AXIS_NONE;
+	int bestIndex0 = -1;
+	int bestIndex1 = -1;
+
+	int numNormalsA = GetNumSeparatingNormals(hullA);
+	int numNormalsB = GetNumSeparatingNormals(hullB);
+	const btAlignedObjectArray<btVector3>& edgesA = GetSeparatingEdges(hullA);
+	const btAlignedObjectArray<btVector3>& edgesB = GetSeparatingEdges(hullB);
+	int numUniqueEdgesA = edgesA.size();
+	int numUniqueEdgesB = edgesB.size();
+
+	// Test the axis of the previous call first, a pair that stays separated along it needs no other test.
+	// Otherwise its depth is the one to beat for the other axes.
+	if (axisCache && axisCache->m_type != btSeparatingAxisCache::AXIS_NONE)
+	{
+		btVector3 cachedAxis(0,0,0);
+		const int index0 = axisCache->m_index0;
+		const int index1 = axisCache->m_index1;
+		if (axisCache->m_type == btSeparatingAxisCache::AXIS_FACE_A && index0 < numNormalsA)
+		{
+			cachedAxis = transA.getBasis() * GetSeparatingNormal(hullA,index0);
+		} else if (axisCache->m_type == btSeparatingAxisCache::AXIS_FACE_B && index0 < numNormalsB)
+		{
+			cachedAxis = transB.getBasis() * GetSeparatingNormal(hullB,index0);
+		} else if (axisCache->m_type == btSeparatingAxisCache::AXIS_EDGES && index0 < numUniqueEdgesA && index1 < numUniqueEdgesB)
+		{
+			const btVector3 cross = (transA.getBasis() * edgesA[index0]).cross(transB.getBasis() * edgesB[index1]);
+			if (!IsAlmostZero(cross))
+				cachedAxis = cross.normalized();
+		}
+		if (!cachedAxis.isZero())
+		{
+			if (DeltaC2.dot(cachedAxis)<0)
+				cachedAxis *= -1.f;
+			btScalar d;
+			if (!TestSepAxis(hullA,hullB,transA,transB,cachedAxis,d))
+				return false;
+			dmin = d;
+			sep = cachedAxis;
+			bestType = axisCache->m_type;
+			bestIndex0 = index0;
+			bestIndex1 = index1;
+		}
+	}
 
-	int numFacesA = hullA.m_faces.size();
 	// Test normals from hullA
-	for(int i=0;i<numFacesA;i++)
+	for(int i=0;i<numNormalsA;i++)
 	{
-		const btVector3 Normal(hullA.m_faces[i].m_plane[0], hullA.m_faces[i].m_plane[1], hullA.m_faces[i].m_plane[2]);
+		const btVector3 Normal = GetSeparatingNormal(hullA,i);
 		btVector3 faceANormalWS = transA.getBasis() * Normal;
 		if (DeltaC2.dot(faceANormalWS)<0)
 			faceANormalWS*=-1.f;
@@ -268,22 +471,26 @@ bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron&
 #endif
 
 		btScalar d;
-		btVector3 wA,wB;
-		if(!TestSepAxis( hullA, hullB, transA,transB, faceANormalWS, d,wA,wB))
+		if(!TestSepAxis( hullA, hullB, transA,transB, faceANormalWS, d))
+		{
+			if (axisCache)
+				axisCache->set(btSeparatingAxisCache::AXIS_FACE_A,i);
 			return false;
+		}
 
 		if(d<dmin)
 		{
 			dmin = d;
 			sep = faceANormalWS;
+			bestType = btSeparatingAxisCache::AXIS_FACE_A;
+			bestIndex0 = i;
 		}
 	}
 
-	int numFacesB = hullB.m_faces.size();
 	// Test normals from hullB
-	for(int i=0;i<numFacesB;i++)
+	for(int i=0;i<numNormalsB;i++)
 	{
-		const btVector3 Normal(hullB.m_faces[i].m_plane[0], hullB.m_faces[i].m_plane[1], hullB.m_faces[i].m_plane[2]);
+		const btVector3 Normal = GetSeparatingNormal(hullB,i);
 		btVector3 WorldNormal = transB.getBasis() * Normal;
 		if (DeltaC2.dot(WorldNormal)<0)
 			WorldNormal *=-1.f;
@@ -297,34 +504,49 @@ bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron&
 #endif
 
 		btScalar d;
-		btVector3 wA,wB;
-		if(!TestSepAxis(hullA, hullB,transA,transB, WorldNormal,d,wA,wB))
+		if(!TestSepAxis(hullA, hullB,transA,transB, WorldNormal,d))
+		{
+			if (axisCache)
+				axisCache->set(btSeparatingAxisCache::AXIS_FACE_B,i);
 			return false;
+		}
 
 		if(d<dmin)
 		{
 			dmin = d;
 			sep = WorldNormal;
+			bestType = btSeparatingAxisCache::AXIS_FACE_B;
+			bestIndex0 = i;
 		}
 	}
 
-	btVector3 edgeAstart,edgeAend,edgeBstart,edgeBend;
-	int edgeA=-1;
-	int edgeB=-1;
-	btVector3 worldEdgeA;
-	btVector3 worldEdgeB;
-	btVector3 witnessPointA,witnessPointB;
-	
+	// Skip the edge pairs that do not form a face of the Minkowski difference, when the Gauss map test
+	// of all edge pairs is cheaper than projecting the hulls onto all pairs of unique edges
+	btFrameArena* arena = btGetThreadFrameArena();
+	btFrameArenaScope arenaScope(arena);
+	btInlineObjectArray<unsigned char,256> uniquePairs;
+	const int numEdgePairs = hullA.m_edges.size()*hullB.m_edges.size();
+	const int numUniquePairs = numUniqueEdgesA*numUniqueEdgesB;
+	const bool pruneEdgePairs = numEdgePairs && numEdgePairs*BT_MINKOWSKI_EDGE_PAIR_COST < numUniquePairs*(hullA.m_vertices.size()+hullB.m_vertices.size());
+	if (pruneEdgePairs)
+	{
+		btFrameArenaReserve(arena,uniquePairs,numUniquePairs);
+		uniquePairs.resize(numUniquePairs,0);
+		FindMinkowskiEdgePairs(hullA,hullB,transA,transB,uniquePairs);
+	}
 
 	int curEdgeEdge = 0;
 	// Test edges
-	for(int e0=0;e0<hullA.m_uniqueEdges.size();e0++)
+	for(int e0=0;e0<numUniqueEdgesA;e0++)
 	{
-		const btVector3 edge0 = hullA.m_uniqueEdges[e0];
+		const btVector3 edge0 = edgesA[e0];
 		const btVector3 WorldEdge0 = transA.getBasis() * edge0;
-		for(int e1=0;e1<hullB.m_uniqueEdges.size();e1++)
+		for(int e1=0;e1<numUniqueEdgesB;e1++)
 		{
-			const btVector3 edge1 = hullB.m_uniqueEdges[e1];
+			if (pruneEdgePairs && !uniquePairs[e0*numUniqueEdgesB+e1])
+				continue;
+
+			const btVector3 edge1 = edgesB[e1];
 			const btVector3 WorldEdge1 = transB.getBasis() * edge1;
 
 			btVector3 Cross = WorldEdge0.cross(WorldEdge1);
@@ -344,31 +566,41 @@ bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron&
 #endif
 
 				btScalar dist;
-				btVector3 wA,wB;
-				if(!TestSepAxis( hullA, hullB, transA,transB, Cross, dist,wA,wB))
+				if(!TestSepAxis( hullA, hullB, transA,transB, Cross, dist))
+				{
+					if (axisCache)
+						axisCache->set(btSeparatingAxisCache::AXIS_EDGES,e0,e1);
 					return false;
+				}
 
 				if(dist<dmin)
 				{
 					dmin = dist;
 					sep = Cross;
-					edgeA=e0;
-					edgeB=e1;
-					worldEdgeA = WorldEdge0;
-					worldEdgeB = WorldEdge1;
-					witnessPointA=wA;
-					witnessPointB=wB;
+					bestType = btSeparatingAxisCache::AXIS_EDGES;
+					bestIndex0 = e0;
+					bestIndex1 = e1;
 				}
 			}
 		}
 
 	}
 
-	if (edgeA>=0&&edgeB>=0)
+	if (axisCache)
+		axisCache->set(bestType,bestIndex0,bestIndex1);
+
+	if (bestType == btSeparatingAxisCache::AXIS_EDGES)
 	{
 //		printf("edge-edge\n");
 		//add an edge-edge contact
 
+		btVector3 worldEdgeA = transA.getBasis() * edgesA[bestIndex0];
+		btVector3 worldEdgeB = transB.getBasis() * edgesB[bestIndex1];
+		btVector3 witnessPointA(0,0,0),witnessPointB(0,0,0);
+		btScalar dist;
+		if (!TestSepAxis(hullA,hullB,transA,transB,sep,dist,witnessPointA,witnessPointB))
+			return false;
+
 		btVector3 ptsVector;
 		btVector3 offsetA;
 		btVector3 offsetB;
@@ -399,6 +631,8 @@ bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron&
 			}
 			btVector3 ptOnB = witnessPointB + offsetB;
 			btScalar distance = nl;
+			//past the faces used by the clipped contacts
+			resultOut.setFeatureId(btContactFeatureId(hullA.m_faces.size()+bestIndex0,hullB.m_faces.size()+bestIndex1,0));
 			resultOut.addContactPoint(ptsVector, ptOnB,-distance);
 		}
 
@@ -411,12 +645,31 @@ bool btPolyhedralContactClipping::findSeparatingAxis(	const btConvexPolyhedron&
 	return true;
 }
 
-void	btPolyhedralContactClipping::clipFaceAgainstHull(const btVector3& separatingNormal, const btConvexPolyhedron& hullA,  const btTransform& transA, btVertexArray& worldVertsB1, const btScalar minDist, btScalar maxDist,btDiscreteCollisionDetectorInterface::Result& resultOut)
+void	btPolyhedralContactClipping::clipFaceAgainstHull(const btVector3& separatingNormal, const btConvexPolyhedron& hullA,  const btTransform& transA, btVertexArray& worldVertsB1, const btScalar minDist, btScalar maxDist,btDiscreteCollisionDetectorInterface::Result& resultOut, int incidentFace)
 {
-	btVertexArray worldVertsB2;
+	btFrameArena* arena = btGetThreadFrameArena();
+	btFrameArenaScope arenaScope(arena);
+	btInlineObjectArray<btVector3,16> worldVertsB2;
 	btVertexArray* pVtxIn = &worldVertsB1;
 	btVertexArray* pVtxOut = &worldVertsB2;
-	pVtxOut->reserve(pVtxIn->size());
+	//clipping against a face of A adds at most one vertex per side plane
+	btFrameArenaReserve(arena,*pVtxOut,btMax(pVtxIn->capacity(),pVtxIn->size()*2));
+
+	//vertex i of the incident face sits between its edges i-1 and i, the side planes of the reference face get the labels from 0x8000
+	btInlineObjectArray<int,16> featuresB1;
+	btInlineObjectArray<int,16> featuresB2;
+	btVertexFeatureArray* pFeaturesIn = &featuresB1;
+	btVertexFeatureArray* pFeaturesOut = &featuresB2;
+	btFrameArenaReserve(arena,featuresB1,pVtxOut->capacity());
+	btFrameArenaReserve(arena,featuresB2,pVtxOut->capacity());
+	{
+		int numVerticesB = pVtxIn->size();
+		featuresB1.resizeNoInitialize(numVerticesB);
+		for (int i=0;i<numVerticesB;i++)
+		{
+			featuresB1[i] = (((i+numVerticesB-1)%numVerticesB)<<16) | i;
+		}
+	}
 
 	int closestFaceA=-1;
 	{
@@ -468,9 +721,11 @@ void	btPolyhedralContactClipping::clipFaceAgainstHull(const btVector3& separatin
 #endif
 		//clip face
 
-		clipFace(*pVtxIn, *pVtxOut,planeNormalWS,planeEqWS);
+		clipFace(*pVtxIn, *pVtxOut,planeNormalWS,planeEqWS,*pFeaturesIn,*pFeaturesOut,0x8000|e0);
 		btSwap(pVtxIn,pVtxOut);
+		btSwap(pFeaturesIn,pFeaturesOut);
 		pVtxOut->resize(0);
+		pFeaturesOut->resize(0);
 	}
 
 
@@ -509,6 +764,7 @@ void	btPolyhedralContactClipping::clipFaceAgainstHull(const btVector3& separatin
 					printf("likely wrong separatingNormal passed in\n");
 				} 
 #endif				
+				resultOut.setFeatureId(btContactFeatureId(closestFaceA,incidentFace,pFeaturesIn->at(i)));
 				resultOut.addContactPoint(separatingNormal,point,depth);
 #endif
 			}
@@ -552,10 +808,13 @@ void	btPolyhedralContactClipping::clipHullAgainstHull(const btVector3& separatin
 			}
 		}
 	}
-				btVertexArray worldVertsB1;
+				btFrameArena* arena = btGetThreadFrameArena();
+				btFrameArenaScope arenaScope(arena);
+				btInlineObjectArray<btVector3,16> worldVertsB1;
 				{
 					const btFace& polyB = hullB.m_faces[closestFaceB];
 					const int numVertices = polyB.m_indices.size();
+					btFrameArenaReserve(arena,worldVertsB1,numVertices*2);
 					for(int e0=0;e0<numVertices;e0++)
 					{
 						const btVector3& b = hullB.m_vertices[polyB.m_indices[e0]];
@@ -565,6 +824,6 @@ void	btPolyhedralContactClipping::clipHullAgainstHull(const btVector3& separatin
 
 	
 	if (closestFaceB>=0)
-		clipFaceAgainstHull(separatingNormal, hullA, transA,worldVertsB1, minDist, maxDist,resultOut);
+		clipFaceAgainstHull(separatingNormal, hullA, transA,worldVertsB1, minDist, maxDist,resultOut,closestFaceB);
 
 }
@@ -28,18 +28,61 @@ subject to the following restrictions:
 class btConvexPolyhedron;
 
 typedef btAlignedObjectArray<btVector3> btVertexArray;
+typedef btAlignedObjectArray<int> btVertexFeatureArray;
+
+///btSeparatingAxisCache keeps the axis found by findSeparatingAxis for a pair of hulls, so the next call can test it
+///first: a pair that is still separated along it returns right away, and a penetrating pair starts with its depth.
+struct btSeparatingAxisCache
+{
+	enum
+	{
+		AXIS_NONE,
+		AXIS_FACE_A,
+		AXIS_FACE_B,
+		AXIS_EDGES
+	};
+
+	int	m_type;
+	///the face, or the unique edge of A for AXIS_EDGES
+	int	m_index0;
+	///the unique edge of B for AXIS_EDGES
+	int	m_index1;
+
+	btSeparatingAxisCache()
+		:m_type(AXIS_NONE),
+		m_index0(-1),
+		m_index1(-1)
+	{
+	}
+
+	void	set(int type, int index0, int index1=-1)
+	{
+		m_type = type;
+		m_index0 = index0;
+		m_index1 = index1;
+	}
+};
 
 // Clips a face to the back of a plane
 struct btPolyhedralContactClipping
 {
 	static void clipHullAgainstHull(const btVector3& separatingNormal, const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, const btScalar minDist, btScalar maxDist, btDiscreteCollisionDetectorInterface::Result& resultOut);
-	static void	clipFaceAgainstHull(const btVector3& separatingNormal, const btConvexPolyhedron& hullA,  const btTransform& transA, btVertexArray& worldVertsB1, const btScalar minDist, btScalar maxDist,btDiscreteCollisionDetectorInterface::Result& resultOut);
+	///clips the incident face worldVertsB1 against the face of hullA closest to the separating normal.
+	///Each contact gets a feature id from the reference face, incidentFace and the edges that meet at the contact.
+	static void	clipFaceAgainstHull(const btVector3& separatingNormal, const btConvexPolyhedron& hullA,  const btTransform& transA, btVertexArray& worldVertsB1, const btScalar minDist, btScalar maxDist,btDiscreteCollisionDetectorInterface::Result& resultOut, int incidentFace=0);
 
-	static bool findSeparatingAxis(	const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, btVector3& sep, btDiscreteCollisionDetectorInterface::Result& resultOut);
+	///returns false when the hulls are separated, otherwise sep is the axis of least penetration. Only the pairs of edges
+	///that form a face of the Minkowski difference are tested. axisCache, when given, carries the axis from call to call.
+	static bool findSeparatingAxis(	const btConvexPolyhedron& hullA, const btConvexPolyhedron& hullB, const btTransform& transA,const btTransform& transB, btVector3& sep, btDiscreteCollisionDetectorInterface::Result& resultOut, btSeparatingAxisCache* axisCache=0);
 
 	///the clipFace method is used internally
 	static void clipFace(const btVertexArray& pVtxIn, btVertexArray& ppVtxOut, const btVector3& planeNormalWS,btScalar planeEqWS);
 
+	///clipFace that also tracks the features of the vertices: the labels of the polygon edges that end and start
+	///at a vertex, packed as (incoming<<16)|outgoing. Vertices created on the plane take planeLabel for its side.
+	static void clipFace(const btVertexArray& pVtxIn, btVertexArray& ppVtxOut, const btVector3& planeNormalWS,btScalar planeEqWS,
+						const btVertexFeatureArray& featuresIn, btVertexFeatureArray& featuresOut, int planeLabel);
+
 };
 
 #endif // BT_POLYHEDRAL_CONTACT_CLIPPING_H
@@ -38,7 +38,10 @@ int		gNumSplitImpulseRecoveries = 0;
 #include "BulletDynamics/Dynamics/btRigidBody.h"
 
 btSequentialImpulseConstraintSolver::btSequentialImpulseConstraintSolver()
-:m_btSeed2(0)
+:m_numSolveGroupCalls(0),
+m_numSolverRows(0),
+m_numSolverIterations(0),
+m_btSeed2(0)
 {
 
 }
@@ -586,7 +589,8 @@ void btSequentialImpulseConstraintSolver::setupContactConstraint(btSolverConstra
 																 int solverBodyIdA, int solverBodyIdB,
 																 btManifoldPoint& cp, const btContactSolverInfo& infoGlobal,
 																 btScalar& relaxation,
-																 const btVector3& rel_pos1, const btVector3& rel_pos2)
+																 const btVector3& rel_pos1, const btVector3& rel_pos2,
+																 bool speculativeContacts)
 {
 			
 			const btVector3& pos1 = cp.getPositionWorldOnA();
@@ -676,6 +680,11 @@ void btSequentialImpulseConstraintSolver::setupContactConstraint(btSolverConstra
 					{
 						restitution = 0.f;
 					};
+					//a separated speculative contact only limits the approach, the bounce follows once the objects touch
+					if (speculativeContacts && penetration > 0)
+					{
+						restitution = 0.f;
+					}
 				}
 
 
@@ -860,7 +869,8 @@ void	btSequentialImpulseConstraintSolver::convertContact(btPersistentManifold* m
 			btVector3 vel  = vel1 - vel2;
 			btScalar rel_vel = cp.m_normalWorldOnB.dot(vel);
 
-			setupContactConstraint(solverConstraint, solverBodyIdA, solverBodyIdB, cp, infoGlobal, relaxation, rel_pos1, rel_pos2);
+			setupContactConstraint(solverConstraint, solverBodyIdA, solverBodyIdB, cp, infoGlobal, relaxation, rel_pos1, rel_pos2,
+				manifold->getSpeculativeMargin() > btScalar(0.));
 
 			
 
@@ -1311,6 +1321,10 @@ btScalar btSequentialImpulseConstraintSolver::solveGroupCacheFriendlySetup(btCol
 	int numConstraintPool = m_tmpSolverContactConstraintPool.size();
 	int numFrictionPool = m_tmpSolverContactFrictionConstraintPool.size();
 
+	m_numSolverRows += numNonContactPool+numConstraintPool+numFrictionPool;
+	BT_PROFILE_COUNTER("solverBodies",m_tmpSolverBodyPool.size());
+	BT_PROFILE_COUNTER("solverRows",numNonContactPool+numConstraintPool+numFrictionPool);
+
 	///@todo: use stack allocator for such temporarily memory, same for solver bodies/constraints
 	m_orderNonContactConstraintPool.resizeNoInitialize(numNonContactPool);
 	if ((infoGlobal.m_solverMode & SOLVER_USE_2_FRICTION_DIRECTIONS))
@@ -1625,6 +1639,7 @@ btScalar btSequentialImpulseConstraintSolver::solveGroupCacheFriendlyIterations(
 		solveGroupCacheFriendlySplitImpulseIterations(bodies ,numBodies,manifoldPtr, numManifolds,constraints,numConstraints,infoGlobal,debugDrawer);
 
 		int maxIterations = m_maxOverrideNumSolverIterations > infoGlobal.m_numIterations? m_maxOverrideNumSolverIterations : infoGlobal.m_numIterations;
+		m_numSolverIterations += maxIterations;
 
 		for ( int iteration = 0 ; iteration< maxIterations ; iteration++)
 		//for ( int iteration = maxIterations-1  ; iteration >= 0;iteration--)
@@ -1727,6 +1742,7 @@ btScalar btSequentialImpulseConstraintSolver::solveGroup(btCollisionObject** bod
 
 	BT_PROFILE("solveGroup");
 	//you need to provide at least some bodies
+	m_numSolveGroupCalls++;
 	
 	solveGroupCacheFriendlySetup( bodies, numBodies, manifoldPtr,  numManifolds,constraints, numConstraints,infoGlobal,debugDrawer);
 
@@ -43,6 +43,9 @@ protected:
 	btAlignedObjectArray<btTypedConstraint::btConstraintInfo1> m_tmpConstraintSizesPool;
 	int							m_maxOverrideNumSolverIterations;
 	int m_fixedBodyId;
+	int	m_numSolveGroupCalls;
+	int	m_numSolverRows;
+	int	m_numSolverIterations;
 	void setupFrictionConstraint(	btSolverConstraint& solverConstraint, const btVector3& normalAxis,int solverBodyIdA,int  solverBodyIdB,
 									btManifoldPoint& cp,const btVector3& rel_pos1,const btVector3& rel_pos2,
 									btCollisionObject* colObj0,btCollisionObject* colObj1, btScalar relaxation, 
@@ -57,8 +60,10 @@ protected:
 	btSolverConstraint&	addRollingFrictionConstraint(const btVector3& normalAxis,int solverBodyIdA,int solverBodyIdB,int frictionIndex,btManifoldPoint& cp,const btVector3& rel_pos1,const btVector3& rel_pos2,btCollisionObject* colObj0,btCollisionObject* colObj1, btScalar relaxation, btScalar desiredVelocity=0, btScalar cfmSlip=0.f);
 
 	
+	///speculativeContacts is set for the points of a manifold with speculative contacts, see btDispatcherInfo::m_useSpeculativeContacts
 	void setupContactConstraint(btSolverConstraint& solverConstraint, int solverBodyIdA, int solverBodyIdB, btManifoldPoint& cp, 
-								const btContactSolverInfo& infoGlobal,btScalar& relaxation, const btVector3& rel_pos1, const btVector3& rel_pos2);
+								const btContactSolverInfo& infoGlobal,btScalar& relaxation, const btVector3& rel_pos1, const btVector3& rel_pos2,
+								bool speculativeContacts=false);
 
 	static void	applyAnisotropicFriction(btCollisionObject* colObj,btVector3& frictionDirection, int frictionMode);
 
@@ -136,6 +141,26 @@ public:
 	{
 		return BT_SEQUENTIAL_IMPULSE_SOLVER;
 	}
+
+	///solveGroup calls, solver rows and iterations are accumulated until resetStatistics is called
+	int	getNumSolveGroupCalls() const
+	{
+		return m_numSolveGroupCalls;
+	}
+	int	getNumSolverRows() const
+	{
+		return m_numSolverRows;
+	}
+	int	getNumSolverIterations() const
+	{
+		return m_numSolverIterations;
+	}
+	void	resetStatistics()
+	{
+		m_numSolveGroupCalls = 0;
+		m_numSolverRows = 0;
+		m_numSolverIterations = 0;
+	}
 };
 
 
@@ -40,14 +40,51 @@ subject to the following restrictions:
 
 #include "LinearMath/btIDebugDraw.h"
 #include "BulletCollision/CollisionShapes/btSphereShape.h"
+#include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+#include "BulletCollision/CollisionDispatch/btManifoldResult.h"
 
 
 #include "BulletDynamics/Dynamics/btActionInterface.h"
 #include "LinearMath/btQuickprof.h"
 #include "LinearMath/btMotionState.h"
+#include "LinearMath/btFrameArena.h"
+#include "LinearMath/btAllocatorContext.h"
 
 #include "LinearMath/btSerializer.h"
 
+extern int gNumAlignedAllocs;
+extern int gNumAlignedFree;
+
+//btClock does not depend on the profiler, so the stats are timed in BT_NO_PROFILE builds too
+static btClock gSimulationStatsClock;
+
+static unsigned long long int btGetSimulationStatsTime()
+{
+	return gSimulationStatsClock.getTimeNanoseconds();
+}
+
+///adds the time spent in its scope to a btSimulationStats stage, does nothing if stats is 0
+struct btSimulationStageTimer
+{
+	btSimulationStats*		m_stats;
+	int						m_stage;
+	unsigned long long int	m_startTime;
+
+	btSimulationStageTimer(btSimulationStats* stats, int stage)
+		:m_stats(stats),
+		m_stage(stage),
+		m_startTime(stats ? btGetSimulationStatsTime() : 0)
+	{
+	}
+	~btSimulationStageTimer()
+	{
+		if (m_stats)
+		{
+			m_stats->m_stageTime[m_stage] += float(btGetSimulationStatsTime()-m_startTime)*1e-6f;
+		}
+	}
+};
+
 #if 0
 btAlignedObjectArray<btVector3> debugContacts;
 btAlignedObjectArray<btVector3> debugNormals;
@@ -208,9 +245,15 @@ m_gravity(0,-10,0),
 m_localTime(0),
 m_synchronizeAllMotionStates(false),
 m_applySpeculativeContactRestitution(false),
+m_timeOfImpactSubstepping(false),
+m_maxTimeOfImpactSubsteps(4),
 m_profileTimings(0),
 m_fixedTimeStep(0),
-m_latencyMotionStateInterpolation(true)
+m_latencyMotionStateInterpolation(true),
+m_collectSimulationStats(false),
+m_frameArena(0),
+m_allocatorContext(0),
+m_solverSeed(0)
 
 {
 	if (!m_constraintSolver)
@@ -401,6 +444,26 @@ int	btDiscreteDynamicsWorld::stepSimulation( btScalar timeStep,int maxSubSteps,
 	BT_PROFILE("stepSimulation");
 
 	int numSimulationSubSteps = 0;
+	int numStepsTaken = 0;
+
+	btSimulationStats* stats = m_collectSimulationStats ? &m_simulationStats : 0;
+	unsigned long long int statsStartTime = 0;
+	int statsAllocs = gNumAlignedAllocs;
+	int statsFrees = gNumAlignedFree;
+	int statsAddedPairs = gAddedPairs;
+	int statsRemovedPairs = gRemovePairs;
+	getDispatchInfo().m_narrowphaseCallCounts = stats ? &m_simulationStats.m_narrowphaseCalls[0][0] : 0;
+	btAllocatorContext* prevAllocatorContext = m_allocatorContext ? btSetThreadAllocatorContext(m_allocatorContext) : 0;
+	btFrameArena* prevFrameArena = m_frameArena ? btSetThreadFrameArena(m_frameArena) : 0;
+	if (stats)
+	{
+		stats->reset();
+		statsStartTime = btGetSimulationStatsTime();
+		if (m_constraintSolver->getSolverType() & (BT_SEQUENTIAL_IMPULSE_SOLVER | BT_MLCP_SOLVER | BT_NNCG_SOLVER))
+		{
+			static_cast<btSequentialImpulseConstraintSolver*>(m_constraintSolver)->resetStatistics();
+		}
+	}
 
 	if (maxSubSteps)
 	{
@@ -450,16 +513,39 @@ int	btDiscreteDynamicsWorld::stepSimulation( btScalar timeStep,int maxSubSteps,
 		for (int i=0;i<clampedSimulationSteps;i++)
 		{
 			internalSingleStepSimulation(fixedTimeStep);
+			btSimulationStageTimer timer(stats,BT_STAGE_SYNCHRONIZE_MOTION_STATES);
 			synchronizeMotionStates();
 		}
+		numStepsTaken = clampedSimulationSteps;
 
 	} else
 	{
+		btSimulationStageTimer timer(stats,BT_STAGE_SYNCHRONIZE_MOTION_STATES);
 		synchronizeMotionStates();
 	}
 
 	clearForces();
 
+	if (m_frameArena)
+	{
+		m_frameArena->reset();
+		btSetThreadFrameArena(prevFrameArena);
+	}
+	if (m_allocatorContext)
+	{
+		btSetThreadAllocatorContext(prevAllocatorContext);
+	}
+
+	if (stats)
+	{
+		stats->m_numSubSteps = numStepsTaken;
+		stats->m_numPairsAdded = gAddedPairs - statsAddedPairs;
+		stats->m_numPairsRemoved = gRemovePairs - statsRemovedPairs;
+		stats->m_numAlignedAllocs = gNumAlignedAllocs - statsAllocs;
+		stats->m_numAlignedFrees = gNumAlignedFree - statsFrees;
+		stats->m_totalTime = float(btGetSimulationStatsTime()-statsStartTime)*1e-6f;
+	}
+
 #ifndef BT_NO_PROFILE
 	CProfileManager::Increment_Frame_Counter();
 #endif //BT_NO_PROFILE
@@ -476,8 +562,13 @@ void	btDiscreteDynamicsWorld::internalSingleStepSimulation(btScalar timeStep)
 		(*m_internalPreTickCallback)(this, timeStep);
 	}	
 
+	btSimulationStats* stats = m_collectSimulationStats ? &m_simulationStats : 0;
+
 	///apply gravity, predict motion
-	predictUnconstraintMotion(timeStep);
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_PREDICT_MOTION);
+		predictUnconstraintMotion(timeStep);
+	}
 
 	btDispatcherInfo& dispatchInfo = getDispatchInfo();
 
@@ -486,12 +577,36 @@ void	btDiscreteDynamicsWorld::internalSingleStepSimulation(btScalar timeStep)
 	dispatchInfo.m_debugDraw = getDebugDrawer();
 
 
-    createPredictiveContacts(timeStep);
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_PREDICTIVE_CONTACTS);
+		createPredictiveContacts(timeStep);
+	}
     
 	///perform collision detection
-	performDiscreteCollisionDetection();
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_COLLISION_DETECTION);
+		performDiscreteCollisionDetection();
+	}
 
-	calculateSimulationIslands();
+#ifndef BT_NO_PROFILE
+	if (CProfileManager::Is_Timeline_Enabled())
+	{
+		int numManifolds = m_dispatcher1->getNumManifolds();
+		int numContacts = 0;
+		for (int i=0;i<numManifolds;i++)
+		{
+			numContacts += m_dispatcher1->getManifoldByIndexInternal(i)->getNumContacts();
+		}
+		CProfileManager::Record_Counter("overlappingPairs",m_broadphasePairCache->getOverlappingPairCache()->getNumOverlappingPairs());
+		CProfileManager::Record_Counter("manifolds",numManifolds);
+		CProfileManager::Record_Counter("contacts",numContacts);
+	}
+#endif //BT_NO_PROFILE
+
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_SIMULATION_ISLANDS);
+		calculateSimulationIslands();
+	}
 
 	
 	getSolverInfo().m_timeStep = timeStep;
@@ -499,18 +614,35 @@ void	btDiscreteDynamicsWorld::internalSingleStepSimulation(btScalar timeStep)
 
 
 	///solve contact and other joint constraints
-	solveConstraints(getSolverInfo());
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_SOLVE_CONSTRAINTS);
+		solveConstraints(getSolverInfo());
+	}
+
+	if (stats)
+	{
+		updateSimulationStats();
+	}
 	
 	///CallbackTriggers();
 
 	///integrate transforms
 
-	integrateTransforms(timeStep);
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_INTEGRATE_TRANSFORMS);
+		integrateTransforms(timeStep);
+	}
 
 	///update vehicle simulation
-	updateActions(timeStep);
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_UPDATE_ACTIONS);
+		updateActions(timeStep);
+	}
 	
-	updateActivationState( timeStep );
+	{
+		btSimulationStageTimer timer(stats,BT_STAGE_UPDATE_ACTIVATION_STATE);
+		updateActivationState( timeStep );
+	}
 
 	if(0 != m_internalTickCallback) {
 		(*m_internalTickCallback)(this, timeStep);
@@ -720,6 +852,14 @@ void	btDiscreteDynamicsWorld::solveConstraints(btContactSolverInfo& solverInfo)
 	
 	btTypedConstraint** constraintsPtr = getNumConstraints() ? &m_sortedConstraints[0] : 0;
 	
+	//the seed belongs to the world, the solver may be shared with other worlds
+	btSequentialImpulseConstraintSolver* seededSolver = 0;
+	if (isDeterministicMode() && (m_constraintSolver->getSolverType() & (BT_SEQUENTIAL_IMPULSE_SOLVER | BT_MLCP_SOLVER | BT_NNCG_SOLVER)))
+	{
+		seededSolver = static_cast<btSequentialImpulseConstraintSolver*>(m_constraintSolver);
+		seededSolver->setRandSeed(m_solverSeed);
+	}
+
 	m_solverIslandCallback->setup(&solverInfo,constraintsPtr,m_sortedConstraints.size(),getDebugDrawer());
 	m_constraintSolver->prepareSolve(getCollisionWorld()->getNumCollisionObjects(), getCollisionWorld()->getDispatcher()->getNumManifolds());
 	
@@ -729,6 +869,11 @@ void	btDiscreteDynamicsWorld::solveConstraints(btContactSolverInfo& solverInfo)
 	m_solverIslandCallback->processConstraints();
 
 	m_constraintSolver->allSolved(solverInfo, m_debugDrawer);
+
+	if (seededSolver)
+	{
+		m_solverSeed = seededSolver->getRandSeed();
+	}
 }
 
 
@@ -967,10 +1112,194 @@ void	btDiscreteDynamicsWorld::createPredictiveContacts(btScalar timeStep)
 		}
 	}
 }
+///the earliest hit of the motion of body from its world transform to predictedTrans, as a fraction of the motion
+btScalar	btDiscreteDynamicsWorld::findTimeOfImpact(btRigidBody* body, const btTransform& predictedTrans, const btCollisionObject** hitObject, btVector3& hitPointWorld, btVector3& hitNormalWorld)
+{
+	btClosestNotMeConvexResultCallback sweepResults(body,body->getWorldTransform().getOrigin(),predictedTrans.getOrigin(),getBroadphase()->getOverlappingPairCache(),getDispatcher());
+	sweepResults.m_allowedPenetration=getDispatchInfo().m_allowedCcdPenetration;
+	sweepResults.m_collisionFilterGroup = body->getBroadphaseProxy()->m_collisionFilterGroup;
+	sweepResults.m_collisionFilterMask  = body->getBroadphaseProxy()->m_collisionFilterMask;
+
+	if (body->getCollisionShape()->isConvex())
+	{
+		//the sweep includes the rotation, so thin triangles and edges are not skipped
+		convexSweepTest(static_cast<const btConvexShape*>(body->getCollisionShape()),body->getWorldTransform(),predictedTrans,sweepResults);
+	} else
+	{
+		btSphereShape tmpSphere(body->getCcdSweptSphereRadius());
+		btTransform modifiedPredictedTrans = predictedTrans;
+		modifiedPredictedTrans.setBasis(body->getWorldTransform().getBasis());
+		convexSweepTest(&tmpSphere,body->getWorldTransform(),modifiedPredictedTrans,sweepResults);
+	}
+
+	if (sweepResults.hasHit() && (sweepResults.m_closestHitFraction < 1.f))
+	{
+		*hitObject = sweepResults.m_hitCollisionObject;
+		hitPointWorld = sweepResults.m_hitPointWorld;
+		hitNormalWorld = sweepResults.m_hitNormalWorld;
+		return sweepResults.m_closestHitFraction;
+	}
+	*hitObject = 0;
+	return btScalar(1.);
+}
+
+///generates the contacts between body and hitObject at their current transforms and solves them, changing the velocities
+void	btDiscreteDynamicsWorld::solveTimeOfImpactContact(btRigidBody* body, const btCollisionObject* hitObject, const btVector3& hitPointWorld, const btVector3& hitNormalWorld)
+{
+	btCollisionObjectWrapper obA(0,body->getCollisionShape(),body,body->getWorldTransform(),-1,-1);
+	btCollisionObjectWrapper obB(0,hitObject->getCollisionShape(),hitObject,hitObject->getWorldTransform(),-1,-1);
+
+	btCollisionAlgorithm* algorithm = m_dispatcher1->findAlgorithm(&obA,&obB);
+	if (!algorithm)
+		return;
+
+	btManifoldResult contactPointResult(&obA,&obB);
+	algorithm->processCollision(&obA,&obB,getDispatchInfo(),&contactPointResult);
+
+	btManifoldArray manifolds;
+	algorithm->getAllContactManifolds(manifolds);
+	int numContacts = 0;
+	for (int i=0;i<manifolds.size();i++)
+	{
+		numContacts += manifolds[i]->getNumContacts();
+	}
+
+	//the sweep stops short of touching, some algorithms (like convex versus triangle mesh) only report penetrations,
+	//so fall back to the contact of the sweep, like createPredictiveContacts
+	btPersistentManifold* sweepManifold = 0;
+	if (!numContacts)
+	{
+		sweepManifold = m_dispatcher1->getNewManifold(body,hitObject);
+		btManifoldPoint newPoint(body->getWorldTransform().invXform(hitPointWorld),hitObject->getWorldTransform().invXform(hitPointWorld),hitNormalWorld,btScalar(0.));
+		int index = sweepManifold->addManifoldPoint(newPoint);
+		btManifoldPoint& pt = sweepManifold->getContactPoint(index);
+		pt.m_combinedFriction = btManifoldResult::calculateCombinedFriction(body,hitObject);
+		pt.m_combinedRestitution = btManifoldResult::calculateCombinedRestitution(body,hitObject);
+		pt.m_positionWorldOnA = hitPointWorld;
+		pt.m_positionWorldOnB = hitPointWorld;
+		manifolds.resize(0);
+		manifolds.push_back(sweepManifold);
+	}
+
+	{
+		//the seed belongs to the world, see solveConstraints
+		btSequentialImpulseConstraintSolver* seededSolver = 0;
+		if (isDeterministicMode() && (m_constraintSolver->getSolverType() & (BT_SEQUENTIAL_IMPULSE_SOLVER | BT_MLCP_SOLVER | BT_NNCG_SOLVER)))
+		{
+			seededSolver = static_cast<btSequentialImpulseConstraintSolver*>(m_constraintSolver);
+			seededSolver->setRandSeed(m_solverSeed);
+		}
+
+		//a dynamic hitObject gets a solver body from its manifold
+		btCollisionObject* bodies[1] = {body};
+		m_constraintSolver->solveGroup(bodies,1,&manifolds[0],manifolds.size(),0,0,getSolverInfo(),m_debugDrawer,m_dispatcher1);
+
+		if (seededSolver)
+		{
+			m_solverSeed = seededSolver->getRandSeed();
+		}
+	}
+
+	if (sweepManifold)
+	{
+		m_dispatcher1->releaseManifold(sweepManifold);
+	}
+	algorithm->~btCollisionAlgorithm();
+	m_dispatcher1->freeCollisionAlgorithm(algorithm);
+}
+
+struct btTimeOfImpactEntry
+{
+	btRigidBody*	m_body;
+	const btCollisionObject*	m_hitObject;
+	btVector3	m_hitPointWorld;
+	btVector3	m_hitNormalWorld;
+	btScalar	m_fraction;
+	int			m_index;
+};
+
+class btSortTimeOfImpactPredicate
+{
+	public:
+
+		bool operator() ( const btTimeOfImpactEntry& a, const btTimeOfImpactEntry& b ) const
+		{
+			if (a.m_fraction != b.m_fraction)
+				return a.m_fraction < b.m_fraction;
+			return a.m_index < b.m_index;
+		}
+};
+
+///moves the fast bodies through the time step, see setTimeOfImpactSubstepping
+void	btDiscreteDynamicsWorld::integrateTimeOfImpactSubsteps(btScalar timeStep, const btAlignedObjectArray<btRigidBody*>& fastBodies)
+{
+	BT_PROFILE("integrateTimeOfImpactSubsteps");
+
+	//the first sweeps only read the world, they are independent of each other
+	btAlignedObjectArray<btTimeOfImpactEntry> impacts;
+	impacts.resize(fastBodies.size());
+	btTransform predictedTrans;
+	int i;
+	for (i=0;i<fastBodies.size();i++)
+	{
+		btTimeOfImpactEntry& impact = impacts[i];
+		impact.m_body = fastBodies[i];
+		impact.m_index = i;
+		impact.m_body->predictIntegratedTransform(timeStep, predictedTrans);
+		impact.m_fraction = findTimeOfImpact(impact.m_body,predictedTrans,&impact.m_hitObject,impact.m_hitPointWorld,impact.m_hitNormalWorld);
+	}
+
+	//solve the earliest impacts first, their impulses can change the velocity of later bodies
+	impacts.quickSort(btSortTimeOfImpactPredicate());
+
+	for (i=0;i<impacts.size();i++)
+	{
+		btRigidBody* body = impacts[i].m_body;
+		const btCollisionObject* hitObject = impacts[i].m_hitObject;
+		btVector3 hitPointWorld = impacts[i].m_hitPointWorld;
+		btVector3 hitNormalWorld = impacts[i].m_hitNormalWorld;
+		btScalar fraction = impacts[i].m_fraction;
+		btScalar remainingTime = timeStep;
+
+		for (int substep=0;;substep++)
+		{
+			if (!hitObject)
+			{
+				body->predictIntegratedTransform(remainingTime, predictedTrans);
+				body->proceedToTransform(predictedTrans);
+				break;
+			}
+
+			gNumClampedCcdMotions++;
+			body->predictIntegratedTransform(remainingTime*fraction, predictedTrans);
+			body->proceedToTransform(predictedTrans);
+			remainingTime -= remainingTime*fraction;
+			if (substep >= m_maxTimeOfImpactSubsteps)
+			{
+				//out of substeps: stay at the hit, the contact is handled next time step
+				break;
+			}
+
+			solveTimeOfImpactContact(body,hitObject,hitPointWorld,hitNormalWorld);
+
+			body->predictIntegratedTransform(remainingTime, predictedTrans);
+			btScalar squareMotion = (predictedTrans.getOrigin()-body->getWorldTransform().getOrigin()).length2();
+			if (squareMotion > body->getCcdSquareMotionThreshold())
+			{
+				fraction = findTimeOfImpact(body,predictedTrans,&hitObject,hitPointWorld,hitNormalWorld);
+			} else
+			{
+				hitObject = 0;
+			}
+		}
+	}
+}
+
 void	btDiscreteDynamicsWorld::integrateTransforms(btScalar timeStep)
 {
 	BT_PROFILE("integrateTransforms");
 	btTransform predictedTrans;
+	btAlignedObjectArray<btRigidBody*> fastBodies;
 	for ( int i=0;i<m_nonStaticRigidBodies.size();i++)
 	{
 		btRigidBody* body = m_nonStaticRigidBodies[i];
@@ -987,6 +1316,12 @@ void	btDiscreteDynamicsWorld::integrateTransforms(btScalar timeStep)
 
 			if (getDispatchInfo().m_useContinuous && body->getCcdSquareMotionThreshold() && body->getCcdSquareMotionThreshold() < squareMotion)
 			{
+				if (m_timeOfImpactSubstepping && (body->getCollisionShape()->isConvex() || body->getCcdSweptSphereRadius()>btScalar(0.)))
+				{
+					fastBodies.push_back(body);
+					continue;
+				}
+
 				BT_PROFILE("CCD motion clamping");
 				if (body->getCollisionShape()->isConvex())
 				{
@@ -1073,6 +1408,11 @@ void	btDiscreteDynamicsWorld::integrateTransforms(btScalar timeStep)
 
 	}
 
+	if (fastBodies.size())
+	{
+		integrateTimeOfImpactSubsteps(timeStep,fastBodies);
+	}
+
 	///this should probably be switched on by default, but it is not well tested yet
 	if (m_applySpeculativeContactRestitution)
 	{
@@ -1133,6 +1473,83 @@ void	btDiscreteDynamicsWorld::predictUnconstraintMotion(btScalar timeStep)
 }
 
 
+void	btDiscreteDynamicsWorld::setCollectSimulationStats(bool collect)
+{
+	m_collectSimulationStats = collect;
+	if (!collect)
+	{
+		getDispatchInfo().m_narrowphaseCallCounts = 0;
+	}
+	m_simulationStats.reset();
+}
+
+
+///called after solveConstraints, while the union find still holds the sorted islands
+void	btDiscreteDynamicsWorld::updateSimulationStats()
+{
+	btSimulationStats& stats = m_simulationStats;
+	int i;
+
+	stats.m_numOverlappingPairs = m_broadphasePairCache->getOverlappingPairCache()->getNumOverlappingPairs();
+
+	stats.m_numManifolds = m_dispatcher1->getNumManifolds();
+	stats.m_numContacts = 0;
+	for (i=0;i<stats.m_numManifolds;i++)
+	{
+		stats.m_numContacts += m_dispatcher1->getManifoldByIndexInternal(i)->getNumContacts();
+	}
+
+	stats.m_numNarrowphaseCalls = 0;
+	const int* calls = &stats.m_narrowphaseCalls[0][0];
+	for (i=0;i<MAX_BROADPHASE_COLLISION_TYPES*MAX_BROADPHASE_COLLISION_TYPES;i++)
+	{
+		stats.m_numNarrowphaseCalls += calls[i];
+	}
+
+	stats.m_numIslands = 0;
+	stats.m_largestIsland = 0;
+	for (i=0;i<BT_NUM_ISLAND_SIZE_BUCKETS;i++)
+	{
+		stats.m_islandSizeHistogram[i] = 0;
+	}
+	btUnionFind& unionFind = m_islandManager->getUnionFind();
+	int numElem = unionFind.getNumElements();
+	int endIslandIndex;
+	for (int startIslandIndex=0;startIslandIndex<numElem;startIslandIndex = endIslandIndex)
+	{
+		int islandId = unionFind.getElement(startIslandIndex).m_id;
+		int islandSize = 0;
+		for (endIslandIndex = startIslandIndex;(endIslandIndex<numElem) && (unionFind.getElement(endIslandIndex).m_id == islandId);endIslandIndex++)
+		{
+			int index = unionFind.getElement(endIslandIndex).m_sz;
+			if (index < m_collisionObjects.size() && m_collisionObjects[index]->getIslandTag() == islandId)
+			{
+				islandSize++;
+			}
+		}
+		if (islandSize)
+		{
+			int bucket = 0;
+			while ((islandSize >> (bucket+1)) && bucket < BT_NUM_ISLAND_SIZE_BUCKETS-1)
+			{
+				bucket++;
+			}
+			stats.m_islandSizeHistogram[bucket]++;
+			stats.m_numIslands++;
+			stats.m_largestIsland = btMax(stats.m_largestIsland,islandSize);
+		}
+	}
+
+	if (m_constraintSolver->getSolverType() & (BT_SEQUENTIAL_IMPULSE_SOLVER | BT_MLCP_SOLVER | BT_NNCG_SOLVER))
+	{
+		const btSequentialImpulseConstraintSolver* solver = static_cast<const btSequentialImpulseConstraintSolver*>(m_constraintSolver);
+		stats.m_numSolveGroupCalls = solver->getNumSolveGroupCalls();
+		stats.m_numSolverRows = solver->getNumSolverRows();
+		stats.m_numSolverIterations = solver->getNumSolverIterations();
+	}
+}
+
+
 void	btDiscreteDynamicsWorld::startProfiling(btScalar timeStep)
 {
 	(void)timeStep;
@@ -18,6 +18,7 @@ subject to the following restrictions:
 #define BT_DISCRETE_DYNAMICS_WORLD_H
 
 #include "btDynamicsWorld.h"
+#include "btSimulationStats.h"
 
 class btDispatcher;
 class btOverlappingPairCache;
@@ -60,6 +61,8 @@ protected:
 	bool	m_ownsConstraintSolver;
 	bool	m_synchronizeAllMotionStates;
 	bool	m_applySpeculativeContactRestitution;
+	bool	m_timeOfImpactSubstepping;
+	int		m_maxTimeOfImpactSubsteps;
 
 	btAlignedObjectArray<btActionInterface*>	m_actions;
 	
@@ -69,6 +72,16 @@ protected:
 
 	btAlignedObjectArray<btPersistentManifold*>	m_predictiveManifolds;
 
+	bool	m_collectSimulationStats;
+
+	btSimulationStats	m_simulationStats;
+
+	class btFrameArena*	m_frameArena;
+
+	class btAllocatorContext*	m_allocatorContext;
+
+	unsigned long	m_solverSeed;
+
 	virtual void	predictUnconstraintMotion(btScalar timeStep);
 	
 	virtual void	integrateTransforms(btScalar timeStep);
@@ -87,12 +100,20 @@ protected:
 
 	void	createPredictiveContacts(btScalar timeStep);
 
+	btScalar	findTimeOfImpact(btRigidBody* body, const btTransform& predictedTrans, const btCollisionObject** hitObject, btVector3& hitPointWorld, btVector3& hitNormalWorld);
+
+	void	solveTimeOfImpactContact(btRigidBody* body, const btCollisionObject* hitObject, const btVector3& hitPointWorld, const btVector3& hitNormalWorld);
+
+	void	integrateTimeOfImpactSubsteps(btScalar timeStep, const btAlignedObjectArray<btRigidBody*>& fastBodies);
+
 	virtual void	saveKinematicState(btScalar timeStep);
 
 	void	serializeRigidBodies(btSerializer* serializer);
 
 	void	serializeDynamicsWorldInfo(btSerializer* serializer);
 
+	void	updateSimulationStats();
+
 public:
 
 
@@ -216,6 +237,28 @@ public:
 		return m_applySpeculativeContactRestitution;
 	}
 
+	///With time of impact substepping, bodies moving faster than their ccd motion threshold are not clamped at the first hit
+	///of a swept sphere. Their convex shape is swept against the world, the contact at the time of impact is solved for the
+	///body and the object it hits, and the body moves on for the rest of the time step, for up to getMaxTimeOfImpactSubsteps hits.
+	///Bodies without a convex shape sweep their ccd swept sphere. It is disabled by default.
+	void	setTimeOfImpactSubstepping(bool enable)
+	{
+		m_timeOfImpactSubstepping = enable;
+	}
+	bool	getTimeOfImpactSubstepping() const
+	{
+		return m_timeOfImpactSubstepping;
+	}
+
+	void	setMaxTimeOfImpactSubsteps(int maxSubsteps)
+	{
+		m_maxTimeOfImpactSubsteps = maxSubsteps;
+	}
+	int		getMaxTimeOfImpactSubsteps() const
+	{
+		return m_maxTimeOfImpactSubsteps;
+	}
+
 	///Preliminary serialization test for Bullet 2.76. Loading those files requires a separate parser (see Bullet/Demos/SerializeDemo)
 	virtual	void	serialize(btSerializer* serializer);
 
@@ -229,6 +272,75 @@ public:
 	{
 		return m_latencyMotionStateInterpolation;
 	}
+
+	///time accumulated towards the next fixed substep, see stepSimulation
+	btScalar	getLocalTime() const
+	{
+		return m_localTime;
+	}
+	void	setLocalTime(btScalar localTime)
+	{
+		m_localTime = localTime;
+	}
+
+	///In deterministic mode the result of stepSimulation only depends on the state of the world: overlapping pairs and
+	///island manifolds are processed sorted by proxy unique ids instead of in hash table or manifold array order,
+	///and the solver random seed (see SOLVER_RANDMIZE_ORDER) is kept in the world, so worlds can share a solver.
+	///Objects must be added in the same order on all machines. Bit identical results across platforms also need the
+	///library built with BT_USE_DETERMINISTIC_MATH (cmake option USE_DETERMINISTIC_MATH). It is disabled by default.
+	void	setDeterministicMode(bool deterministic)
+	{
+		getDispatchInfo().m_deterministicOverlappingPairs = deterministic;
+	}
+	bool	isDeterministicMode() const
+	{
+		return getDispatchInfo().m_deterministicOverlappingPairs;
+	}
+
+	///random seed the solver starts the next step with in deterministic mode, it is updated after each step
+	unsigned long	getSolverSeed() const
+	{
+		return m_solverSeed;
+	}
+	void	setSolverSeed(unsigned long seed)
+	{
+		m_solverSeed = seed;
+	}
+
+	///Gather a btSimulationStats record during each stepSimulation call. It is disabled by default.
+	void	setCollectSimulationStats(bool collect);
+	bool	getCollectSimulationStats() const
+	{
+		return m_collectSimulationStats;
+	}
+	///statistics of the last stepSimulation call
+	const btSimulationStats&	getSimulationStats() const
+	{
+		return m_simulationStats;
+	}
+
+	///Transient allocations of the narrowphase and broadphase queries come from arena during stepSimulation,
+	///the arena is reset at the end of each stepSimulation call. The world does not own the arena, 0 (default) uses the heap.
+	void	setFrameArena(class btFrameArena* arena)
+	{
+		m_frameArena = arena;
+	}
+	class btFrameArena*	getFrameArena()
+	{
+		return m_frameArena;
+	}
+
+	///All btAlignedAlloc allocations during stepSimulation, including pool and array growth, come from context.
+	///Install the same context with btAllocatorContextScope while creating and destroying the world, its shapes and bodies,
+	///to account all memory of the world to it. The world does not own the context, 0 (default) uses the global allocator.
+	void	setAllocatorContext(class btAllocatorContext* context)
+	{
+		m_allocatorContext = context;
+	}
+	class btAllocatorContext*	getAllocatorContext()
+	{
+		return m_allocatorContext;
+	}
 };
 
 #endif //BT_DISCRETE_DYNAMICS_WORLD_H
@@ -287,6 +287,17 @@ public:
 	{
 		return m_totalTorque;
 	};
+
+	///overwrites the accumulated force, used to restore a btWorldSnapshot. Use applyCentralForce to add forces.
+	void	internalSetTotalForce(const btVector3& force)
+	{
+		m_totalForce = force;
+	}
+
+	void	internalSetTotalTorque(const btVector3& torque)
+	{
+		m_totalTorque = torque;
+	}
     
 	const btVector3& getInvInertiaDiagLocal() const
 	{
@@ -0,0 +1,126 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2013 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose, 
+including commercial applications, and to alter it and redistribute it freely, 
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_SIMULATION_STATS_H
+#define BT_SIMULATION_STATS_H
+
+#include "BulletCollision/BroadphaseCollision/btBroadphaseProxy.h"
+
+enum btSimulationStage
+{
+	BT_STAGE_PREDICT_MOTION=0,
+	BT_STAGE_PREDICTIVE_CONTACTS,
+	BT_STAGE_COLLISION_DETECTION,
+	BT_STAGE_SIMULATION_ISLANDS,
+	BT_STAGE_SOLVE_CONSTRAINTS,
+	BT_STAGE_INTEGRATE_TRANSFORMS,
+	BT_STAGE_UPDATE_ACTIONS,
+	BT_STAGE_UPDATE_ACTIVATION_STATE,
+	BT_STAGE_SYNCHRONIZE_MOTION_STATES,
+	BT_NUM_SIMULATION_STAGES
+};
+
+#define BT_NUM_ISLAND_SIZE_BUCKETS 16
+
+///btSimulationStats holds the counts and timings of the last btDiscreteDynamicsWorld::stepSimulation call.
+///Enable it using btDiscreteDynamicsWorld::setCollectSimulationStats.
+///Times and per-call counters are summed over all substeps, state counters (pairs, manifolds, contacts,
+///islands) are taken after the last substep. Pair and allocation counters are deltas of the global
+///gAddedPairs, gRemovePairs, gNumAlignedAllocs and gNumAlignedFree counters, so they are only exact
+///when a single world is stepped at a time.
+struct btSimulationStats
+{
+	int		m_numSubSteps;
+
+	///time in milliseconds spent in each btSimulationStage
+	float	m_stageTime[BT_NUM_SIMULATION_STAGES];
+	///time in milliseconds spent in stepSimulation
+	float	m_totalTime;
+
+	int		m_numOverlappingPairs;
+	int		m_numPairsAdded;
+	int		m_numPairsRemoved;
+
+	///number of top-level narrowphase calls, indexed by the shape types of the pair
+	int		m_narrowphaseCalls[MAX_BROADPHASE_COLLISION_TYPES][MAX_BROADPHASE_COLLISION_TYPES];
+	int		m_numNarrowphaseCalls;
+
+	int		m_numManifolds;
+	int		m_numContacts;
+
+	int		m_numIslands;
+	int		m_largestIsland;
+	///m_islandSizeHistogram[i] counts islands with 2^i up to 2^(i+1)-1 objects, the last bucket holds all larger islands
+	int		m_islandSizeHistogram[BT_NUM_ISLAND_SIZE_BUCKETS];
+
+	///only filled for solvers derived from btSequentialImpulseConstraintSolver
+	int		m_numSolveGroupCalls;
+	int		m_numSolverRows;
+	int		m_numSolverIterations;
+
+	int		m_numAlignedAllocs;
+	int		m_numAlignedFrees;
+
+	btSimulationStats()
+	{
+		reset();
+	}
+
+	void	reset()
+	{
+		int i,j;
+		m_numSubSteps = 0;
+		for (i=0;i<BT_NUM_SIMULATION_STAGES;i++)
+			m_stageTime[i] = 0.f;
+		m_totalTime = 0.f;
+		m_numOverlappingPairs = 0;
+		m_numPairsAdded = 0;
+		m_numPairsRemoved = 0;
+		for (i=0;i<MAX_BROADPHASE_COLLISION_TYPES;i++)
+			for (j=0;j<MAX_BROADPHASE_COLLISION_TYPES;j++)
+				m_narrowphaseCalls[i][j] = 0;
+		m_numNarrowphaseCalls = 0;
+		m_numManifolds = 0;
+		m_numContacts = 0;
+		m_numIslands = 0;
+		m_largestIsland = 0;
+		for (i=0;i<BT_NUM_ISLAND_SIZE_BUCKETS;i++)
+			m_islandSizeHistogram[i] = 0;
+		m_numSolveGroupCalls = 0;
+		m_numSolverRows = 0;
+		m_numSolverIterations = 0;
+		m_numAlignedAllocs = 0;
+		m_numAlignedFrees = 0;
+	}
+
+	static const char*	getStageName(int stage)
+	{
+		static const char* names[BT_NUM_SIMULATION_STAGES] = 
+		{
+			"predictUnconstraintMotion",
+			"createPredictiveContacts",
+			"performDiscreteCollisionDetection",
+			"calculateSimulationIslands",
+			"solveConstraints",
+			"integrateTransforms",
+			"updateActions",
+			"updateActivationState",
+			"synchronizeMotionStates"
+		};
+		return (stage>=0 && stage<BT_NUM_SIMULATION_STAGES) ? names[stage] : "";
+	}
+};
+
+#endif //BT_SIMULATION_STATS_H
@@ -0,0 +1,457 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btTransformStream.h"
+#include "btRigidBody.h"
+#include "BulletCollision/CollisionDispatch/btCollisionWorld.h"
+#include "BulletCollision/CollisionDispatch/btCollisionObject.h"
+#include "LinearMath/btMotionState.h"
+#include <string.h>
+
+//stream layout: frame id, baseline frame id, number of objects, number of changed objects (32 bits each),
+//then for each changed object the gap to the previous changed index (Elias gamma), its position and its orientation.
+//Position and orientation start with a changed bit, then a bit telling a small delta (deltaBits per component) from a full value.
+
+struct	btBitWriter
+{
+	unsigned char*	m_data;
+	int				m_numBytes;
+	unsigned int	m_acc;
+	int				m_numBits;
+
+	btBitWriter(unsigned char* data)
+		:m_data(data),
+		m_numBytes(0),
+		m_acc(0),
+		m_numBits(0)
+	{
+	}
+
+	void	write(unsigned int value, int numBits)
+	{
+		while (numBits > 0)
+		{
+			int chunk = numBits < 16 ? numBits : 16;
+			m_acc |= (value & ((1u<<chunk)-1)) << m_numBits;
+			m_numBits += chunk;
+			value >>= chunk;
+			numBits -= chunk;
+			while (m_numBits >= 8)
+			{
+				m_data[m_numBytes++] = (unsigned char)(m_acc & 0xff);
+				m_acc >>= 8;
+				m_numBits -= 8;
+			}
+		}
+	}
+
+	void	writeGamma(unsigned int value)
+	{
+		int n = 0;
+		while ((value >> n) > 1)
+			n++;
+		write(0,n);
+		write(1,1);
+		write(value,n);
+	}
+
+	int		flush()
+	{
+		if (m_numBits)
+		{
+			m_data[m_numBytes++] = (unsigned char)(m_acc & 0xff);
+			m_acc = 0;
+			m_numBits = 0;
+		}
+		return m_numBytes;
+	}
+};
+
+struct	btBitReader
+{
+	const unsigned char*	m_data;
+	int				m_size;
+	int				m_offset;
+	unsigned int	m_acc;
+	int				m_numBits;
+	bool			m_overflow;
+
+	btBitReader(const unsigned char* data, int size)
+		:m_data(data),
+		m_size(size),
+		m_offset(0),
+		m_acc(0),
+		m_numBits(0),
+		m_overflow(false)
+	{
+	}
+
+	unsigned int	read(int numBits)
+	{
+		unsigned int value = 0;
+		int shift = 0;
+		while (numBits > 0)
+		{
+			int chunk = numBits < 16 ? numBits : 16;
+			while (m_numBits < chunk)
+			{
+				if (m_offset >= m_size)
+				{
+					m_overflow = true;
+					return 0;
+				}
+				m_acc |= (unsigned int)m_data[m_offset++] << m_numBits;
+				m_numBits += 8;
+			}
+			value |= (m_acc & ((1u<<chunk)-1)) << shift;
+			m_acc >>= chunk;
+			m_numBits -= chunk;
+			shift += chunk;
+			numBits -= chunk;
+		}
+		return value;
+	}
+
+	unsigned int	readGamma()
+	{
+		int n = 0;
+		while (!read(1))
+		{
+			if (m_overflow || n >= 31)
+			{
+				m_overflow = true;
+				return 0;
+			}
+			n++;
+		}
+		return (1u<<n) | read(n);
+	}
+};
+
+static SIMD_FORCE_INLINE unsigned int	btQuantizeUnit(btScalar value, unsigned int maxValue)
+{
+	if (value <= btScalar(0.))
+		return 0;
+	if (value >= btScalar(1.))
+		return maxValue;
+	return (unsigned int)(value*btScalar(maxValue)+btScalar(0.5));
+}
+
+static SIMD_FORCE_INLINE bool	btFitsDelta(int delta, int deltaBits)
+{
+	int limit = 1<<(deltaBits-1);
+	return delta >= -limit && delta < limit;
+}
+
+static SIMD_FORCE_INLINE int	btSignExtend(unsigned int value, int numBits)
+{
+	unsigned int sign = 1u<<(numBits-1);
+	return (int)((value ^ sign) - sign);
+}
+
+void	btTransformQuantization::quantize(const btTransform& transform, btQuantizedTransform& out) const
+{
+	unsigned int maxPosition = (1u<<m_positionBits)-1;
+	const btVector3& origin = transform.getOrigin();
+	for (int i=0;i<3;i++)
+	{
+		out.m_position[i] = btQuantizeUnit((origin[i]-m_worldMin[i])/(m_worldMax[i]-m_worldMin[i]),maxPosition);
+	}
+
+	btQuaternion q = transform.getRotation();
+	int largest = 0;
+	for (int i=1;i<4;i++)
+	{
+		if (btFabs(q[i]) > btFabs(q[largest]))
+			largest = i;
+	}
+	if (q[largest] < btScalar(0.))
+		q = -q;
+	//the three remaining components lie in [-sqrt(1/2),sqrt(1/2)]
+	unsigned int maxOrientation = (1u<<m_orientationBits)-1;
+	int c = 0;
+	for (int i=0;i<4;i++)
+	{
+		if (i == largest)
+			continue;
+		out.m_orientation[c++] = btQuantizeUnit(q[i]*SIMDSQRT12+btScalar(0.5),maxOrientation);
+	}
+	out.m_largestComponent = largest;
+}
+
+void	btTransformQuantization::dequantize(const btQuantizedTransform& in, btTransform& transform) const
+{
+	btScalar maxPosition = btScalar((1u<<m_positionBits)-1);
+	btVector3 origin;
+	for (int i=0;i<3;i++)
+	{
+		origin[i] = m_worldMin[i] + (m_worldMax[i]-m_worldMin[i])*(btScalar(in.m_position[i])/maxPosition);
+	}
+
+	btScalar maxOrientation = btScalar((1u<<m_orientationBits)-1);
+	btScalar q[4];
+	btScalar sum = btScalar(0.);
+	int c = 0;
+	for (int i=0;i<4;i++)
+	{
+		if (i == in.m_largestComponent)
+			continue;
+		q[i] = (btScalar(in.m_orientation[c++])/maxOrientation-btScalar(0.5))*btScalar(2.)*SIMDSQRT12;
+		sum += q[i]*q[i];
+	}
+	q[in.m_largestComponent] = btSqrt(btMax(btScalar(0.),btScalar(1.)-sum));
+	btQuaternion rotation(q[0],q[1],q[2],q[3]);
+	rotation.normalize();
+	transform.setOrigin(origin);
+	transform.setRotation(rotation);
+}
+
+btTransformStreamEncoder::btTransformStreamEncoder(const btTransformQuantization& quantization)
+	:m_quantization(quantization),
+	m_numDirty(0)
+{
+	btAssert(m_quantization.m_positionBits > 0 && m_quantization.m_positionBits <= 30);
+	btAssert(m_quantization.m_orientationBits > 0 && m_quantization.m_orientationBits <= 30);
+	btAssert(m_quantization.m_deltaBits > 0 && m_quantization.m_deltaBits <= 30);
+}
+
+void	btTransformStreamEncoder::capture(const btCollisionWorld* world)
+{
+	const btCollisionObjectArray& objects = world->getCollisionObjectArray();
+	int frameId = ++m_current.m_frameId;
+	int numOld = m_current.m_transforms.size();
+	int numObjects = objects.size();
+	m_current.m_transforms.resize(numObjects);
+	m_current.m_changeFrames.resize(numObjects);
+	m_numDirty = 0;
+	for (int i=0;i<numObjects;i++)
+	{
+		btQuantizedTransform q;
+		m_quantization.quantize(objects[i]->getWorldTransform(),q);
+		if (i >= numOld || q != m_current.m_transforms[i])
+		{
+			m_current.m_transforms[i] = q;
+			m_current.m_changeFrames[i] = frameId;
+			m_numDirty++;
+		}
+	}
+}
+
+void	btTransformStreamEncoder::writeDelta(const btReplicationFrame& baseline, btAlignedObjectArray<unsigned char>& stream) const
+{
+	btAssert(baseline.m_frameId < m_current.m_frameId || m_current.m_frameId < 0);
+	int numObjects = m_current.m_transforms.size();
+	int numBaseline = baseline.m_transforms.size();
+	int numChanged = 0;
+	for (int i=0;i<numObjects;i++)
+	{
+		if (i >= numBaseline || m_current.m_changeFrames[i] > baseline.m_frameId)
+			numChanged++;
+	}
+
+	const int posBits = m_quantization.m_positionBits;
+	const int oriBits = m_quantization.m_orientationBits;
+	const int deltaBits = m_quantization.m_deltaBits;
+	//gap, then position and orientation with their mode bits
+	const int maxObjectBits = 63 + 2+3*btMax(posBits,deltaBits) + 4+3*btMax(oriBits,deltaBits);
+	int offset = stream.size();
+	stream.resize(offset + 16 + (numChanged*maxObjectBits+7)/8 + 1);
+
+	btBitWriter writer(&stream[offset]);
+	writer.write(m_current.m_frameId,32);
+	writer.write(baseline.m_frameId,32);
+	writer.write(numObjects,32);
+	writer.write(numChanged,32);
+
+	btQuantizedTransform zero;
+	memset(&zero,0,sizeof(zero));
+	int prev = -1;
+	for (int i=0;i<numObjects;i++)
+	{
+		const bool inBaseline = i < numBaseline;
+		if (inBaseline && m_current.m_changeFrames[i] <= baseline.m_frameId)
+			continue;
+		const btQuantizedTransform& cur = m_current.m_transforms[i];
+		const btQuantizedTransform& base = inBaseline ? baseline.m_transforms[i] : zero;
+		writer.writeGamma(i-prev);
+		prev = i;
+
+		int dp[3] = {int(cur.m_position[0]-base.m_position[0]),int(cur.m_position[1]-base.m_position[1]),int(cur.m_position[2]-base.m_position[2])};
+		if (dp[0] || dp[1] || dp[2])
+		{
+			writer.write(1,1);
+			if (btFitsDelta(dp[0],deltaBits) && btFitsDelta(dp[1],deltaBits) && btFitsDelta(dp[2],deltaBits))
+			{
+				writer.write(1,1);
+				for (int j=0;j<3;j++)
+					writer.write((unsigned int)dp[j],deltaBits);
+			} else
+			{
+				writer.write(0,1);
+				for (int j=0;j<3;j++)
+					writer.write(cur.m_position[j],posBits);
+			}
+		} else
+		{
+			writer.write(0,1);
+		}
+
+		int dq[3] = {int(cur.m_orientation[0]-base.m_orientation[0]),int(cur.m_orientation[1]-base.m_orientation[1]),int(cur.m_orientation[2]-base.m_orientation[2])};
+		bool sameLargest = cur.m_largestComponent == base.m_largestComponent;
+		if (dq[0] || dq[1] || dq[2] || !sameLargest)
+		{
+			writer.write(1,1);
+			if (sameLargest && btFitsDelta(dq[0],deltaBits) && btFitsDelta(dq[1],deltaBits) && btFitsDelta(dq[2],deltaBits))
+			{
+				writer.write(1,1);
+				for (int j=0;j<3;j++)
+					writer.write((unsigned int)dq[j],deltaBits);
+			} else
+			{
+				writer.write(0,1);
+				writer.write(cur.m_largestComponent,2);
+				for (int j=0;j<3;j++)
+					writer.write(cur.m_orientation[j],oriBits);
+			}
+		} else
+		{
+			writer.write(0,1);
+		}
+	}
+	stream.resize(offset + writer.flush());
+}
+
+btTransformStreamDecoder::btTransformStreamDecoder(const btTransformQuantization& quantization)
+	:m_quantization(quantization)
+{
+}
+
+int		btTransformStreamDecoder::getDeltaFrameId(const unsigned char* data, int size) const
+{
+	btBitReader reader(data,size);
+	int frameId = (int)reader.read(32);
+	return reader.m_overflow ? -1 : frameId;
+}
+
+bool	btTransformStreamDecoder::readDelta(const btReplicationFrame& baseline, const unsigned char* data, int size, btReplicationFrame& frame) const
+{
+	btBitReader reader(data,size);
+	int frameId = (int)reader.read(32);
+	int baselineId = (int)reader.read(32);
+	int numObjects = (int)reader.read(32);
+	int numChanged = (int)reader.read(32);
+	if (reader.m_overflow || baselineId != baseline.m_frameId || frameId <= baselineId || numObjects < 0 || numChanged < 0 || numChanged > numObjects)
+		return false;
+	//every change takes at least three bits and every object beyond the baseline is a change, check before allocating
+	if (numChanged > (size-16)*8/3 || numObjects-baseline.m_transforms.size() > numChanged)
+		return false;
+
+	const int posBits = m_quantization.m_positionBits;
+	const int oriBits = m_quantization.m_orientationBits;
+	const int deltaBits = m_quantization.m_deltaBits;
+	const unsigned int posMask = (1u<<posBits)-1;
+	const unsigned int oriMask = (1u<<oriBits)-1;
+	int numBaseline = baseline.m_transforms.size();
+
+	//decode into scratch arrays first, so a corrupt stream leaves frame alone, and frame may be baseline
+	btAlignedObjectArray<btQuantizedTransform>& transforms = m_transforms;
+	btAlignedObjectArray<int>& changeFrames = m_changeFrames;
+	transforms.resize(numObjects);
+	changeFrames.resize(numObjects);
+	int numCopy = btMin(numObjects,numBaseline);
+	if (numCopy)
+	{
+		memcpy(&transforms[0],&baseline.m_transforms[0],numCopy*sizeof(btQuantizedTransform));
+		memcpy(&changeFrames[0],&baseline.m_changeFrames[0],numCopy*sizeof(int));
+	}
+	btQuantizedTransform zero;
+	memset(&zero,0,sizeof(zero));
+	for (int i=numCopy;i<numObjects;i++)
+	{
+		transforms[i] = zero;
+		changeFrames[i] = frameId;
+	}
+
+	int index = -1;
+	int numNew = 0;
+	for (int c=0;c<numChanged;c++)
+	{
+		unsigned int gap = reader.readGamma();
+		if (reader.m_overflow || gap > (unsigned int)(numObjects-1-index))
+			return false;
+		index += int(gap);
+		if (index >= numBaseline)
+			numNew++;
+		btQuantizedTransform& q = transforms[index];
+		changeFrames[index] = frameId;
+
+		if (reader.read(1))
+		{
+			if (reader.read(1))
+			{
+				for (int j=0;j<3;j++)
+					q.m_position[j] = (q.m_position[j] + btSignExtend(reader.read(deltaBits),deltaBits)) & posMask;
+			} else
+			{
+				for (int j=0;j<3;j++)
+					q.m_position[j] = reader.read(posBits);
+			}
+		}
+		if (reader.read(1))
+		{
+			if (reader.read(1))
+			{
+				for (int j=0;j<3;j++)
+					q.m_orientation[j] = (q.m_orientation[j] + btSignExtend(reader.read(deltaBits),deltaBits)) & oriMask;
+			} else
+			{
+				q.m_largestComponent = (int)reader.read(2);
+				for (int j=0;j<3;j++)
+					q.m_orientation[j] = reader.read(oriBits);
+			}
+		}
+		if (reader.m_overflow)
+			return false;
+	}
+	//objects beyond the baseline are always sent
+	if (numNew != btMax(0,numObjects-numBaseline))
+		return false;
+
+	frame.m_frameId = frameId;
+	frame.m_transforms.copyFromArray(transforms);
+	frame.m_changeFrames.copyFromArray(changeFrames);
+	return true;
+}
+
+void	btTransformStreamDecoder::apply(const btReplicationFrame& frame, btCollisionWorld* world, int sinceFrameId) const
+{
+	btCollisionObjectArray& objects = world->getCollisionObjectArray();
+	int numObjects = btMin(objects.size(),frame.getNumObjects());
+	for (int i=0;i<numObjects;i++)
+	{
+		if (!frame.hasChangedSince(i,sinceFrameId))
+			continue;
+		btTransform transform;
+		m_quantization.dequantize(frame.getTransform(i),transform);
+		btCollisionObject* colObj = objects[i];
+		colObj->setWorldTransform(transform);
+		colObj->setInterpolationWorldTransform(transform);
+		btRigidBody* body = btRigidBody::upcast(colObj);
+		if (body && body->getMotionState())
+		{
+			body->getMotionState()->setWorldTransform(transform);
+		}
+	}
+}
@@ -0,0 +1,176 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_TRANSFORM_STREAM_H
+#define BT_TRANSFORM_STREAM_H
+
+#include "LinearMath/btTransform.h"
+#include "LinearMath/btAlignedObjectArray.h"
+
+class btCollisionWorld;
+
+///quantization settings, encoder and decoder must use the same ones
+struct btTransformQuantization
+{
+	///positions are clamped to this box
+	btVector3	m_worldMin;
+	btVector3	m_worldMax;
+	///bits per position axis, at most 30. 20 bits over 1000 units gives about 1 millimeter
+	int			m_positionBits;
+	///bits for each of the three smallest quaternion components, at most 30
+	int			m_orientationBits;
+	///bits per component of a delta against the baseline, larger changes are sent in full
+	int			m_deltaBits;
+
+	btTransformQuantization()
+		:m_worldMin(btScalar(-500.),btScalar(-500.),btScalar(-500.)),
+		m_worldMax(btScalar(500.),btScalar(500.),btScalar(500.)),
+		m_positionBits(20),
+		m_orientationBits(11),
+		m_deltaBits(8)
+	{
+	}
+
+	///the smallest three encoding: the largest quaternion component is dropped (made positive), the other three are stored
+	void	quantize(const btTransform& transform, struct btQuantizedTransform& out) const;
+	void	dequantize(const struct btQuantizedTransform& in, btTransform& transform) const;
+};
+
+struct btQuantizedTransform
+{
+	unsigned int	m_position[3];
+	unsigned int	m_orientation[3];
+	int				m_largestComponent;
+
+	bool	operator==(const btQuantizedTransform& other) const
+	{
+		return m_position[0] == other.m_position[0] && m_position[1] == other.m_position[1] && m_position[2] == other.m_position[2] &&
+			m_orientation[0] == other.m_orientation[0] && m_orientation[1] == other.m_orientation[1] && m_orientation[2] == other.m_orientation[2] &&
+			m_largestComponent == other.m_largestComponent;
+	}
+	bool	operator!=(const btQuantizedTransform& other) const
+	{
+		return !(*this == other);
+	}
+};
+
+///btReplicationFrame holds the quantized transforms of all collision objects of a world at one frame, indexed like the world's object array.
+///For each object it also keeps the frame in which its quantized transform last changed, its dirty state relative to any older frame.
+///A default constructed frame is the empty baseline, a delta against it contains every object.
+class btReplicationFrame
+{
+	int	m_frameId;
+	btAlignedObjectArray<btQuantizedTransform>	m_transforms;
+	btAlignedObjectArray<int>	m_changeFrames;
+
+	friend class btTransformStreamEncoder;
+	friend class btTransformStreamDecoder;
+
+public:
+
+	btReplicationFrame()
+		:m_frameId(-1)
+	{
+	}
+
+	int	getFrameId() const
+	{
+		return m_frameId;
+	}
+	int	getNumObjects() const
+	{
+		return m_transforms.size();
+	}
+	const btQuantizedTransform&	getTransform(int index) const
+	{
+		return m_transforms[index];
+	}
+	///frame in which the quantized transform of object index last changed
+	int	getChangeFrame(int index) const
+	{
+		return m_changeFrames[index];
+	}
+	bool	hasChangedSince(int index, int frameId) const
+	{
+		return m_changeFrames[index] > frameId;
+	}
+};
+
+///btTransformStreamEncoder quantizes the transforms of a world once per frame and writes compact bit-packed deltas against
+///the frame each receiver acknowledged last. Keep the frames sent to receivers (getCurrentFrame copies) until they are acknowledged.
+///A delta has a 16 byte header, unchanged objects cost nothing, a changed one a few bits for its index plus its position and orientation,
+///usually as small deltas against the baseline.
+class btTransformStreamEncoder
+{
+	btTransformQuantization	m_quantization;
+	btReplicationFrame		m_current;
+	int						m_numDirty;
+
+public:
+
+	btTransformStreamEncoder(const btTransformQuantization& quantization = btTransformQuantization());
+
+	///quantizes the transforms of all collision objects of world into the next frame, and marks the objects whose quantized transform changed
+	void	capture(const btCollisionWorld* world);
+
+	const btReplicationFrame&	getCurrentFrame() const
+	{
+		return m_current;
+	}
+	///number of objects whose quantized transform changed in the last capture
+	int		getNumDirty() const
+	{
+		return m_numDirty;
+	}
+	const btTransformQuantization&	getQuantization() const
+	{
+		return m_quantization;
+	}
+
+	///appends the changes of the current frame relative to baseline to stream. baseline must be an earlier frame of this
+	///encoder that the receiver has, or the empty frame
+	void	writeDelta(const btReplicationFrame& baseline, btAlignedObjectArray<unsigned char>& stream) const;
+};
+
+///btTransformStreamDecoder reads the deltas of btTransformStreamEncoder on the receiving side
+class btTransformStreamDecoder
+{
+	btTransformQuantization	m_quantization;
+
+	//scratch memory of readDelta, kept to avoid allocations
+	mutable btAlignedObjectArray<btQuantizedTransform>	m_transforms;
+	mutable btAlignedObjectArray<int>					m_changeFrames;
+
+public:
+
+	btTransformStreamDecoder(const btTransformQuantization& quantization = btTransformQuantization());
+
+	///reads a delta into frame. Returns false, leaving frame unchanged, when the stream is corrupt or was written against another baseline
+	bool	readDelta(const btReplicationFrame& baseline, const unsigned char* data, int size, btReplicationFrame& frame) const;
+
+	///the frame id a delta was written for, or -1 for a corrupt stream
+	int		getDeltaFrameId(const unsigned char* data, int size) const;
+
+	void	getTransform(const btReplicationFrame& frame, int index, btTransform& transform) const
+	{
+		m_quantization.dequantize(frame.getTransform(index),transform);
+	}
+
+	///sets the world transforms of the objects of world to those in frame, and passes them to the motion states of rigid bodies.
+	///Only objects that changed since sinceFrameId are touched, -1 applies all.
+	void	apply(const btReplicationFrame& frame, btCollisionWorld* world, int sinceFrameId = -1) const;
+};
+
+#endif //BT_TRANSFORM_STREAM_H
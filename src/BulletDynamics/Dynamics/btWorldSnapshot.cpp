@@ -0,0 +1,434 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btWorldSnapshot.h"
+#include "btDiscreteDynamicsWorld.h"
+#include "btRigidBody.h"
+#include "BulletCollision/BroadphaseCollision/btCollisionAlgorithm.h"
+#include "BulletCollision/BroadphaseCollision/btOverlappingPairCache.h"
+#include "BulletCollision/BroadphaseCollision/btDispatcher.h"
+#include "BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h"
+#include "BulletCollision/CollisionDispatch/btManifoldResult.h"
+#include "BulletCollision/NarrowPhaseCollision/btPersistentManifold.h"
+#include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.h"
+#include "BulletDynamics/ConstraintSolver/btTypedConstraint.h"
+
+class btSnapshotManifoldKeySortPredicate
+{
+public:
+	bool operator() ( const btSnapshotManifoldKey& lhs, const btSnapshotManifoldKey& rhs ) const
+	{
+		if (lhs.m_object0 != rhs.m_object0)
+			return lhs.m_object0 < rhs.m_object0;
+		if (lhs.m_object1 != rhs.m_object1)
+			return lhs.m_object1 < rhs.m_object1;
+		return lhs.m_index < rhs.m_index;
+	}
+};
+
+static int	btPairObjectIndex(const btBroadphaseProxy* proxy)
+{
+	return ((const btCollisionObject*)proxy->m_clientObject)->getWorldArrayIndex();
+}
+
+static void	btRestoreSnapshotManifold(btPersistentManifold* manifold, const btSnapshotManifoldState& state, const btManifoldPoint* points)
+{
+	manifold->clearManifold();
+	manifold->setNumContacts(state.m_numContacts);
+	for (int p=0;p<state.m_numContacts;p++)
+	{
+		btManifoldPoint& pt = manifold->getContactPoint(p);
+		pt = points[state.m_firstPoint+p];
+		//user data may have been destroyed since the capture
+		pt.m_userPersistentData = 0;
+	}
+	manifold->m_companionIdA = state.m_companionIdA;
+	manifold->m_companionIdB = state.m_companionIdB;
+	manifold->setContactBreakingThreshold(state.m_contactBreakingThreshold);
+	manifold->setContactProcessingThreshold(state.m_contactProcessingThreshold);
+	manifold->setSpeculativeMargin(state.m_speculativeMargin);
+}
+
+///creates the collision algorithm of a pair if needed and processes it once, which also creates the manifolds of the algorithm
+static void	btProcessSnapshotPair(btBroadphasePair& pair, btDispatcher* dispatcher, const btDispatcherInfo& dispatchInfo)
+{
+	btCollisionObject* colObj0 = (btCollisionObject*)pair.m_pProxy0->m_clientObject;
+	btCollisionObject* colObj1 = (btCollisionObject*)pair.m_pProxy1->m_clientObject;
+	btCollisionObjectWrapper obj0Wrap(0,colObj0->getCollisionShape(),colObj0,colObj0->getWorldTransform(),-1,-1);
+	btCollisionObjectWrapper obj1Wrap(0,colObj1->getCollisionShape(),colObj1,colObj1->getWorldTransform(),-1,-1);
+	if (!pair.m_algorithm)
+		pair.m_algorithm = dispatcher->findAlgorithm(&obj0Wrap,&obj1Wrap);
+	if (pair.m_algorithm)
+	{
+		btManifoldResult contactPointResult(&obj0Wrap,&obj1Wrap);
+		pair.m_algorithm->processCollision(&obj0Wrap,&obj1Wrap,dispatchInfo,&contactPointResult);
+	}
+}
+
+btWorldSnapshot::btWorldSnapshot()
+	:m_localTime(0),
+	m_solverSeed(0)
+{
+}
+
+void	btWorldSnapshot::capture(btDiscreteDynamicsWorld* world)
+{
+	const btCollisionObjectArray& objects = world->getCollisionObjectArray();
+	m_objects.resize(objects.size());
+	for (int i=0;i<objects.size();i++)
+	{
+		const btCollisionObject* obj = objects[i];
+		btSnapshotObjectState& state = m_objects[i];
+		state.m_worldTransform = obj->getWorldTransform();
+		state.m_interpolationWorldTransform = obj->getInterpolationWorldTransform();
+		state.m_interpolationLinearVelocity = obj->getInterpolationLinearVelocity();
+		state.m_interpolationAngularVelocity = obj->getInterpolationAngularVelocity();
+		state.m_hitFraction = obj->getHitFraction();
+		state.m_deactivationTime = obj->getDeactivationTime();
+		state.m_activationState = obj->getActivationState();
+		state.m_islandTag = obj->getIslandTag();
+		state.m_companionId = obj->getCompanionId();
+		state.m_broadphaseHandle = obj->getBroadphaseHandle();
+		state.m_object = obj;
+		const btRigidBody* body = btRigidBody::upcast(obj);
+		if (body)
+		{
+			state.m_linearVelocity = body->getLinearVelocity();
+			state.m_angularVelocity = body->getAngularVelocity();
+			state.m_totalForce = body->getTotalForce();
+			state.m_totalTorque = body->getTotalTorque();
+		} else
+		{
+			state.m_linearVelocity.setZero();
+			state.m_angularVelocity.setZero();
+			state.m_totalForce.setZero();
+			state.m_totalTorque.setZero();
+		}
+	}
+
+	m_constraints.resize(world->getNumConstraints());
+	for (int i=0;i<m_constraints.size();i++)
+	{
+		const btTypedConstraint* constraint = world->getConstraint(i);
+		m_constraints[i].m_appliedImpulse = constraint->getAppliedImpulse();
+		m_constraints[i].m_enabled = constraint->isEnabled() ? 1 : 0;
+		m_constraints[i].m_constraint = constraint;
+	}
+
+	m_broadphaseState.resize(0);
+	world->getBroadphase()->captureState(m_broadphaseState);
+
+	const btBroadphasePairArray& pairArray = world->getBroadphase()->getOverlappingPairCache()->getOverlappingPairArray();
+	m_pairs.resize(pairArray.size());
+	for (int i=0;i<pairArray.size();i++)
+	{
+		m_pairs[i].m_proxy0 = pairArray[i].m_pProxy0;
+		m_pairs[i].m_proxy1 = pairArray[i].m_pProxy1;
+		m_pairs[i].m_object0 = btPairObjectIndex(pairArray[i].m_pProxy0);
+		m_pairs[i].m_object1 = btPairObjectIndex(pairArray[i].m_pProxy1);
+		m_pairs[i].m_hasAlgorithm = pairArray[i].m_algorithm ? 1 : 0;
+	}
+
+	btDispatcher* dispatcher = world->getDispatcher();
+	int numManifolds = dispatcher->getNumManifolds();
+	m_manifolds.resize(numManifolds);
+	m_points.resize(0);
+	for (int i=0;i<numManifolds;i++)
+	{
+		const btPersistentManifold* manifold = dispatcher->getManifoldByIndexInternal(i);
+		btSnapshotManifoldState& state = m_manifolds[i];
+		state.m_object0 = manifold->getBody0()->getWorldArrayIndex();
+		state.m_object1 = manifold->getBody1()->getWorldArrayIndex();
+		state.m_firstPoint = m_points.size();
+		state.m_numContacts = manifold->getNumContacts();
+		state.m_companionIdA = manifold->m_companionIdA;
+		state.m_companionIdB = manifold->m_companionIdB;
+		state.m_contactBreakingThreshold = manifold->getContactBreakingThreshold();
+		state.m_contactProcessingThreshold = manifold->getContactProcessingThreshold();
+		state.m_speculativeMargin = manifold->getSpeculativeMargin();
+		for (int p=0;p<state.m_numContacts;p++)
+		{
+			m_points.push_back(manifold->getContactPoint(p));
+		}
+	}
+
+	m_localTime = world->getLocalTime();
+	btConstraintSolver* solver = world->getConstraintSolver();
+	m_solverSeed = world->getSolverSeed();
+	if (!world->isDeterministicMode() && (solver->getSolverType() & (BT_SEQUENTIAL_IMPULSE_SOLVER | BT_MLCP_SOLVER | BT_NNCG_SOLVER)))
+	{
+		m_solverSeed = static_cast<btSequentialImpulseConstraintSolver*>(solver)->getRandSeed();
+	}
+}
+
+int		btWorldSnapshot::matchManifolds(btDiscreteDynamicsWorld* world) const
+{
+	const btCollisionObjectArray& objects = world->getCollisionObjectArray();
+	btDispatcher* dispatcher = world->getDispatcher();
+	int numLive = dispatcher->getNumManifolds();
+	btPersistentManifold** manifolds = numLive ? dispatcher->getInternalManifoldPointer() : 0;
+	const btManifoldPoint* points = m_points.size() ? &m_points[0] : 0;
+	m_manifoldMatches.resize(m_manifolds.size());
+	m_liveManifoldMatched.resize(numLive);
+	for (int i=0;i<numLive;i++)
+	{
+		m_liveManifoldMatched[i] = 0;
+	}
+
+	//most manifolds are still at their stored position
+	int numUnmatched = 0;
+	for (int i=0;i<m_manifolds.size();i++)
+	{
+		const btSnapshotManifoldState& state = m_manifolds[i];
+		btPersistentManifold* manifold = i < numLive ? manifolds[i] : 0;
+		if (manifold && manifold->getBody0() == objects[state.m_object0] && manifold->getBody1() == objects[state.m_object1])
+		{
+			btRestoreSnapshotManifold(manifold,state,points);
+			m_manifoldMatches[i] = manifold;
+			m_liveManifoldMatched[i] = 1;
+		} else
+		{
+			m_manifoldMatches[i] = 0;
+			numUnmatched++;
+		}
+	}
+	if (!numUnmatched)
+		return 0;
+
+	//look up the others by object pair, in order of appearance when a pair has several manifolds
+	m_manifoldKeys.resize(0);
+	for (int i=0;i<numLive;i++)
+	{
+		if (m_liveManifoldMatched[i])
+			continue;
+		btSnapshotManifoldKey key;
+		key.m_object0 = manifolds[i]->getBody0()->getWorldArrayIndex();
+		key.m_object1 = manifolds[i]->getBody1()->getWorldArrayIndex();
+		key.m_index = i;
+		m_manifoldKeys.push_back(key);
+	}
+	m_manifoldKeys.quickSort(btSnapshotManifoldKeySortPredicate());
+	int numKeys = m_manifoldKeys.size();
+	for (int i=0;i<m_manifolds.size();i++)
+	{
+		if (m_manifoldMatches[i])
+			continue;
+		const btSnapshotManifoldState& state = m_manifolds[i];
+		int lo = 0;
+		int hi = numKeys;
+		while (lo < hi)
+		{
+			int mid = (lo+hi)/2;
+			const btSnapshotManifoldKey& key = m_manifoldKeys[mid];
+			if (key.m_object0 < state.m_object0 || (key.m_object0 == state.m_object0 && key.m_object1 < state.m_object1))
+				lo = mid+1;
+			else
+				hi = mid;
+		}
+		for (;lo<numKeys && m_manifoldKeys[lo].m_object0 == state.m_object0 && m_manifoldKeys[lo].m_object1 == state.m_object1;lo++)
+		{
+			int index = m_manifoldKeys[lo].m_index;
+			if (!m_liveManifoldMatched[index])
+			{
+				btRestoreSnapshotManifold(manifolds[index],state,points);
+				m_manifoldMatches[i] = manifolds[index];
+				m_liveManifoldMatched[index] = 1;
+				numUnmatched--;
+				break;
+			}
+		}
+	}
+	return numUnmatched;
+}
+
+bool	btWorldSnapshot::restore(btDiscreteDynamicsWorld* world) const
+{
+	btCollisionObjectArray& objects = world->getCollisionObjectArray();
+	if (objects.size() != m_objects.size() || world->getNumConstraints() != m_constraints.size())
+		return false;
+	for (int i=0;i<objects.size();i++)
+	{
+		if (objects[i] != m_objects[i].m_object)
+			return false;
+	}
+	for (int i=0;i<m_constraints.size();i++)
+	{
+		if (world->getConstraint(i) != m_constraints[i].m_constraint)
+			return false;
+	}
+
+	//the stored pair proxies can be compared directly as long as no object got a new proxy
+	bool sameProxies = true;
+	for (int i=0;i<objects.size();i++)
+	{
+		btCollisionObject* obj = objects[i];
+		const btSnapshotObjectState& state = m_objects[i];
+		obj->setWorldTransform(state.m_worldTransform);
+		obj->setInterpolationWorldTransform(state.m_interpolationWorldTransform);
+		obj->setInterpolationLinearVelocity(state.m_interpolationLinearVelocity);
+		obj->setInterpolationAngularVelocity(state.m_interpolationAngularVelocity);
+		obj->setHitFraction(state.m_hitFraction);
+		obj->setDeactivationTime(state.m_deactivationTime);
+		obj->forceActivationState(state.m_activationState);
+		obj->setIslandTag(state.m_islandTag);
+		obj->setCompanionId(state.m_companionId);
+		if (obj->getBroadphaseHandle() != state.m_broadphaseHandle)
+			sameProxies = false;
+		btRigidBody* body = btRigidBody::upcast(obj);
+		if (body)
+		{
+			body->setLinearVelocity(state.m_linearVelocity);
+			body->setAngularVelocity(state.m_angularVelocity);
+			body->internalSetTotalForce(state.m_totalForce);
+			body->internalSetTotalTorque(state.m_totalTorque);
+			//the world inertia tensor only depends on the orientation, recomputing it gives the same bits
+			body->updateInertiaTensor();
+		}
+	}
+
+	btBroadphaseInterface* broadphase = world->getBroadphase();
+	if (!broadphase->restoreState(m_broadphaseState.size() ? &m_broadphaseState[0] : 0,m_broadphaseState.size()))
+	{
+		for (int i=0;i<objects.size();i++)
+		{
+			if (objects[i]->getBroadphaseHandle())
+				world->updateSingleAabb(objects[i]);
+		}
+	}
+
+	for (int i=0;i<m_constraints.size();i++)
+	{
+		btTypedConstraint* constraint = world->getConstraint(i);
+		constraint->internalSetAppliedImpulse(m_constraints[i].m_appliedImpulse);
+		constraint->setEnabled(m_constraints[i].m_enabled != 0);
+	}
+
+	//put the pairs in the stored order. Pairs that are in place stay untouched, the others are swapped into place
+	//with their collision algorithm. Pairs that were removed since the capture are added again, and get their
+	//collision algorithm and its manifolds back by processing them once. The manifold contents are overwritten below.
+	btOverlappingPairCache* pairCache = broadphase->getOverlappingPairCache();
+	btDispatcher* dispatcher = world->getDispatcher();
+	btBroadphasePairArray& pairArray = pairCache->getOverlappingPairArray();
+	int numPairs = 0;
+	for (int i=0;i<m_pairs.size();i++)
+	{
+		const btSnapshotPairState& state = m_pairs[i];
+		btBroadphaseProxy* proxy0 = sameProxies ? const_cast<btBroadphaseProxy*>(state.m_proxy0) : objects[state.m_object0]->getBroadphaseHandle();
+		btBroadphaseProxy* proxy1 = sameProxies ? const_cast<btBroadphaseProxy*>(state.m_proxy1) : objects[state.m_object1]->getBroadphaseHandle();
+		if (!proxy0 || !proxy1)
+			continue;
+		if (numPairs >= pairArray.size() || pairArray[numPairs].m_pProxy0 != proxy0 || pairArray[numPairs].m_pProxy1 != proxy1)
+		{
+			btBroadphasePair* pair = pairCache->findPair(proxy0,proxy1);
+			if (!pair)
+				pair = pairCache->addOverlappingPair(proxy0,proxy1);
+			if (!pair)
+				continue;
+			int index = int(pair - &pairArray[0]);
+			btAssert(index >= numPairs);
+			pairCache->swapOverlappingPairs(numPairs,index);
+		}
+		if (state.m_hasAlgorithm && !pairArray[numPairs].m_algorithm)
+			btProcessSnapshotPair(pairArray[numPairs],dispatcher,world->getDispatchInfo());
+		numPairs++;
+	}
+	//the pairs that are not in the snapshot are at the end now, removing the last pair does not move the others
+	while (pairArray.size() > numPairs)
+	{
+		btBroadphasePair& pair = pairArray[pairArray.size()-1];
+		pairCache->removeOverlappingPair(pair.m_pProxy0,pair.m_pProxy1,dispatcher);
+	}
+
+	//an algorithm with several manifolds, such as a compound, can release one of them while its pair stays. Processing
+	//the pair once recreates the manifolds it has at the restored transforms, and matching again restores all contents
+	//once more. A stored manifold that is still missing then belongs to a pair that is gone, or to a compound child
+	//that no longer overlaps and would be released by the next step.
+	if (matchManifolds(world))
+	{
+		m_manifoldKeys.resize(0);
+		for (int i=0;i<m_manifolds.size();i++)
+		{
+			if (m_manifoldMatches[i])
+				continue;
+			btSnapshotManifoldKey key;
+			key.m_object0 = m_manifolds[i].m_object0;
+			key.m_object1 = m_manifolds[i].m_object1;
+			key.m_index = i;
+			m_manifoldKeys.push_back(key);
+		}
+		m_manifoldKeys.quickSort(btSnapshotManifoldKeySortPredicate());
+		for (int i=0;i<m_manifoldKeys.size();i++)
+		{
+			//each pair is processed once
+			if (i > 0 && m_manifoldKeys[i].m_object0 == m_manifoldKeys[i-1].m_object0 && m_manifoldKeys[i].m_object1 == m_manifoldKeys[i-1].m_object1)
+				continue;
+			btBroadphaseProxy* proxy0 = objects[m_manifoldKeys[i].m_object0]->getBroadphaseHandle();
+			btBroadphaseProxy* proxy1 = objects[m_manifoldKeys[i].m_object1]->getBroadphaseHandle();
+			btBroadphasePair* pair = (proxy0 && proxy1) ? pairCache->findPair(proxy0,proxy1) : 0;
+			if (pair)
+				btProcessSnapshotPair(*pair,dispatcher,world->getDispatchInfo());
+		}
+		matchManifolds(world);
+	}
+
+	//put the matched manifolds in the stored order, live manifolds without a stored counterpart are emptied
+	//and go after them, keeping their relative order. Only the manifolds that moved get a new index.
+	int numLive = dispatcher->getNumManifolds();
+	btPersistentManifold** manifolds = numLive ? dispatcher->getInternalManifoldPointer() : 0;
+	m_manifoldOrder.resize(0);
+	for (int i=0;i<m_manifolds.size();i++)
+	{
+		if (m_manifoldMatches[i])
+			m_manifoldOrder.push_back(m_manifoldMatches[i]);
+	}
+	for (int i=0;i<numLive;i++)
+	{
+		if (!m_liveManifoldMatched[i])
+		{
+			manifolds[i]->clearManifold();
+			m_manifoldOrder.push_back(manifolds[i]);
+		}
+	}
+	btAssert(m_manifoldOrder.size() == numLive);
+	for (int i=0;i<numLive;i++)
+	{
+		if (manifolds[i] != m_manifoldOrder[i])
+		{
+			manifolds[i] = m_manifoldOrder[i];
+			manifolds[i]->m_index1a = i;
+		}
+	}
+
+	world->setLocalTime(m_localTime);
+	world->setSolverSeed(m_solverSeed);
+	btConstraintSolver* solver = world->getConstraintSolver();
+	if (solver->getSolverType() & (BT_SEQUENTIAL_IMPULSE_SOLVER | BT_MLCP_SOLVER | BT_NNCG_SOLVER))
+	{
+		static_cast<btSequentialImpulseConstraintSolver*>(solver)->setRandSeed(m_solverSeed);
+	}
+	world->synchronizeMotionStates();
+	return true;
+}
+
+int		btWorldSnapshot::getSizeInBytes() const
+{
+	return m_objects.size()*int(sizeof(btSnapshotObjectState))
+		+ m_constraints.size()*int(sizeof(btSnapshotConstraintState))
+		+ m_pairs.size()*int(sizeof(btSnapshotPairState))
+		+ m_manifolds.size()*int(sizeof(btSnapshotManifoldState))
+		+ m_points.size()*int(sizeof(btManifoldPoint))
+		+ m_broadphaseState.size()
+		+ int(sizeof(btScalar)+sizeof(unsigned long));
+}
@@ -0,0 +1,173 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_WORLD_SNAPSHOT_H
+#define BT_WORLD_SNAPSHOT_H
+
+#include "LinearMath/btTransform.h"
+#include "LinearMath/btAlignedObjectArray.h"
+#include "BulletCollision/NarrowPhaseCollision/btManifoldPoint.h"
+
+class btDiscreteDynamicsWorld;
+class btCollisionObject;
+class btTypedConstraint;
+struct btBroadphaseProxy;
+
+///dynamic state of one collision object, rigid body fields stay zero for other objects
+struct btSnapshotObjectState
+{
+	btTransform	m_worldTransform;
+	btTransform	m_interpolationWorldTransform;
+	btVector3	m_interpolationLinearVelocity;
+	btVector3	m_interpolationAngularVelocity;
+	btVector3	m_linearVelocity;
+	btVector3	m_angularVelocity;
+	btVector3	m_totalForce;
+	btVector3	m_totalTorque;
+	btScalar	m_hitFraction;
+	btScalar	m_deactivationTime;
+	int			m_activationState;
+	int			m_islandTag;
+	int			m_companionId;
+	///only compared with the live proxy, to find out whether the stored pair proxies are still valid
+	const btBroadphaseProxy*	m_broadphaseHandle;
+	///only compared with the object at the same index at restore time
+	const btCollisionObject*	m_object;
+
+	btSnapshotObjectState()
+		:m_worldTransform(btTransform::getIdentity()),
+		m_interpolationWorldTransform(btTransform::getIdentity()),
+		m_interpolationLinearVelocity(0,0,0),
+		m_interpolationAngularVelocity(0,0,0),
+		m_linearVelocity(0,0,0),
+		m_angularVelocity(0,0,0),
+		m_totalForce(0,0,0),
+		m_totalTorque(0,0,0),
+		m_hitFraction(btScalar(1.)),
+		m_deactivationTime(btScalar(0.)),
+		m_activationState(0),
+		m_islandTag(-1),
+		m_companionId(-1),
+		m_broadphaseHandle(0),
+		m_object(0)
+	{
+	}
+};
+
+struct btSnapshotConstraintState
+{
+	btScalar	m_appliedImpulse;
+	int			m_enabled;
+	///only compared with the constraint at the same index at restore time
+	const btTypedConstraint*	m_constraint;
+};
+
+///an overlapping pair, as indices into the collision object array of the world. The proxies are only compared with live proxies.
+struct btSnapshotPairState
+{
+	const btBroadphaseProxy*	m_proxy0;
+	const btBroadphaseProxy*	m_proxy1;
+	int	m_object0;
+	int	m_object1;
+	int	m_hasAlgorithm;
+};
+
+struct btSnapshotManifoldState
+{
+	int			m_object0;
+	int			m_object1;
+	int			m_firstPoint;
+	int			m_numContacts;
+	int			m_companionIdA;
+	int			m_companionIdB;
+	btScalar	m_contactBreakingThreshold;
+	btScalar	m_contactProcessingThreshold;
+	btScalar	m_speculativeMargin;
+};
+
+///a live manifold during restore, sorted by object pair to find the manifold matching a stored one
+struct btSnapshotManifoldKey
+{
+	int	m_object0;
+	int	m_object1;
+	int	m_index;
+};
+
+///btWorldSnapshot copies the dynamic state of a btDiscreteDynamicsWorld into flat arrays and restores it, for rollback networking.
+///It covers the state of all collision objects and rigid bodies (including activation and accumulated forces), the applied impulse
+///of constraints, the overlapping pair cache in its original order, persistent manifolds with their contact points and warm starting
+///impulses, the solver random seed and the time accumulated towards the next fixed substep.
+///Objects and constraints are identified by their index in the world, so the world must contain the same objects and constraints
+///in the same order at restore time. The static configuration (shapes, masses, friction, gravity, constraint frames) is not stored.
+///The broadphase stores its own internal state through btBroadphaseInterface::captureState, btDbvtBroadphase keeps its trees and btAxisSweep3
+///its sorted edge lists there, so later steps find new pairs in the same order. Broadphases without such state get their aabbs updated from the restored transforms.
+///Restoring reuses the live proxies, pairs, collision algorithms and manifolds. Only pairs and manifolds that changed since the capture
+///are moved, added or removed, pairs removed in between get their collision algorithm and manifolds back.
+///Not covered are soft bodies, actions such as vehicles and collision algorithm state other than the manifolds, such as the
+///separating axis that btConvexConvexAlgorithm keeps between frames.
+///The arrays keep their capacity, so capturing into the same snapshot every frame does not allocate once it has grown.
+class btWorldSnapshot
+{
+	btAlignedObjectArray<btSnapshotObjectState>		m_objects;
+	btAlignedObjectArray<btSnapshotConstraintState>	m_constraints;
+	btAlignedObjectArray<btSnapshotPairState>		m_pairs;
+	btAlignedObjectArray<btSnapshotManifoldState>	m_manifolds;
+	btAlignedObjectArray<btManifoldPoint>			m_points;
+	btAlignedObjectArray<unsigned char>				m_broadphaseState;
+	btScalar		m_localTime;
+	unsigned long	m_solverSeed;
+
+	//scratch memory of restore, kept to avoid allocations
+	mutable btAlignedObjectArray<class btPersistentManifold*>	m_manifoldMatches;
+	mutable btAlignedObjectArray<unsigned char>					m_liveManifoldMatched;
+	mutable btAlignedObjectArray<btSnapshotManifoldKey>			m_manifoldKeys;
+	mutable btAlignedObjectArray<class btPersistentManifold*>	m_manifoldOrder;
+
+	///finds the live manifold of each stored manifold and restores its contents, returns the number of stored manifolds without one
+	int		matchManifolds(btDiscreteDynamicsWorld* world) const;
+
+public:
+
+	btWorldSnapshot();
+
+	///stores the current state of world
+	void	capture(btDiscreteDynamicsWorld* world);
+
+	///restores world to the captured state. Returns false, and leaves world unchanged, unless world holds the captured collision objects
+	///and constraints at the same indices.
+	bool	restore(btDiscreteDynamicsWorld* world) const;
+
+	int		getNumObjects() const
+	{
+		return m_objects.size();
+	}
+	int		getNumManifolds() const
+	{
+		return m_manifolds.size();
+	}
+	int		getNumPairs() const
+	{
+		return m_pairs.size();
+	}
+	int		getNumConstraints() const
+	{
+		return m_constraints.size();
+	}
+
+	///number of bytes of state held by the snapshot
+	int		getSizeInBytes() const;
+};
+
+#endif //BT_WORLD_SNAPSHOT_H
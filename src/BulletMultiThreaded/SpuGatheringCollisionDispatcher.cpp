@@ -202,7 +202,7 @@ void	SpuGatheringCollisionDispatcher::dispatchAllCollisionPairs(btOverlappingPai
 			{
 				btSpuCollisionPairCallback	collisionCallback(dispatchInfo,this);
 
-				pairCache->processAllOverlappingPairs(&collisionCallback,dispatcher);
+				pairCache->processAllOverlappingPairs(&collisionCallback,dispatcher,dispatchInfo);
 			}
 		}
 
@@ -18,6 +18,7 @@ subject to the following restrictions:
 #ifdef USE_WIN32_THREADING
 
 #include <windows.h>
+#include "LinearMath/btQuickprof.h"
 
 #include "SpuCollisionTaskProcess.h"
 
@@ -68,6 +69,10 @@ DWORD WINAPI Thread_no_1( LPVOID lpParam )
 		} else
 		{
 			//exit Thread
+#ifndef BT_NO_PROFILE
+			//Windows threads have no exit hook for the profiler, give its slot to the next thread
+			CProfileManager::Release_Thread();
+#endif
 			status->m_status = 3;
 			printf("Thread with taskId %i with handle %p exiting\n",status->m_taskId, status->m_threadHandle);
 			SetEvent(status->m_eventCompletetHandle);
@@ -1172,6 +1172,150 @@ void			btSoftBody::randomizeConstraints()
 #undef NEXTRAND
 }
 
+//
+static inline unsigned	btSoftBodySpreadBits(unsigned x)
+{
+	x=(x|(x<<16))&0x030000FF;
+	x=(x|(x<<8))&0x0300F00F;
+	x=(x|(x<<4))&0x030C30C3;
+	x=(x|(x<<2))&0x09249249;
+	return(x);
+}
+
+//
+struct	btSoftBodyNodeKey
+{
+	unsigned	m_code;
+	int			m_index;
+};
+
+//
+struct	btSoftBodyNodeKeyPredicate
+{
+	bool operator() ( const btSoftBodyNodeKey& a, const btSoftBodyNodeKey& b ) const
+	{
+		return(a.m_code<b.m_code || (a.m_code==b.m_code && a.m_index<b.m_index));
+	}
+};
+
+//
+struct	btSoftBodyLinkPredicate
+{
+	bool operator() ( const btSoftBody::Link& a, const btSoftBody::Link& b ) const
+	{
+		const btSoftBody::Node*	a0=btMin(a.m_n[0],a.m_n[1]);
+		const btSoftBody::Node*	b0=btMin(b.m_n[0],b.m_n[1]);
+		return(a0<b0 || (a0==b0 && btMax(a.m_n[0],a.m_n[1])<btMax(b.m_n[0],b.m_n[1])));
+	}
+};
+
+//
+struct	btSoftBodyFacePredicate
+{
+	bool operator() ( const btSoftBody::Face& a, const btSoftBody::Face& b ) const
+	{
+		return(btMin(btMin(a.m_n[0],a.m_n[1]),a.m_n[2])<btMin(btMin(b.m_n[0],b.m_n[1]),b.m_n[2]));
+	}
+};
+
+//
+struct	btSoftBodyTetraPredicate
+{
+	bool operator() ( const btSoftBody::Tetra& a, const btSoftBody::Tetra& b ) const
+	{
+		return(	btMin(btMin(a.m_n[0],a.m_n[1]),btMin(a.m_n[2],a.m_n[3]))<
+				btMin(btMin(b.m_n[0],b.m_n[1]),btMin(b.m_n[2],b.m_n[3])));
+	}
+};
+
+//
+void			btSoftBody::optimizeMemoryLayout()
+{
+	const int	nnodes=m_nodes.size();
+	int			i,ni;
+	if(nnodes==0) return;
+	/* Morton keys		*/ 
+	btVector3	lo=m_nodes[0].m_x;
+	btVector3	hi=m_nodes[0].m_x;
+	for(i=1;i<nnodes;++i)
+	{
+		lo.setMin(m_nodes[i].m_x);
+		hi.setMax(m_nodes[i].m_x);
+	}
+	const btVector3	extent=hi-lo;
+	const btVector3	scale(	extent.x()>SIMD_EPSILON?1023/extent.x():0,
+							extent.y()>SIMD_EPSILON?1023/extent.y():0,
+							extent.z()>SIMD_EPSILON?1023/extent.z():0);
+	btAlignedObjectArray<btSoftBodyNodeKey>	keys;
+	keys.resize(nnodes);
+	for(i=0;i<nnodes;++i)
+	{
+		const btVector3	q=(m_nodes[i].m_x-lo)*scale;
+		keys[i].m_code	=	btSoftBodySpreadBits((unsigned)q.x())|
+							(btSoftBodySpreadBits((unsigned)q.y())<<1)|
+							(btSoftBodySpreadBits((unsigned)q.z())<<2);
+		keys[i].m_index	=	i;
+	}
+	keys.quickSort(btSoftBodyNodeKeyPredicate());
+	/* Old to new map	*/ 
+	btAlignedObjectArray<int>	map;
+	map.resize(nnodes);
+	for(i=0;i<nnodes;++i)
+	{
+		map[keys[i].m_index]=i;
+	}
+	/* Clusters			*/ 
+	Node*	base=&m_nodes[0];
+	for(i=0,ni=m_clusters.size();i<ni;++i)
+	{
+		Cluster&	c=*m_clusters[i];
+		for(int j=0;j<c.m_nodes.size();++j)
+		{
+			c.m_nodes[j]=base+map[int(c.m_nodes[j]-base)];
+		}
+	}
+	/* Contacts are rebuilt by the next collision pass	*/ 
+	m_rcontacts.resize(0);
+	m_scontacts.resize(0);
+	/* Permute nodes	*/ 
+	pointersToIndices();
+	{
+		tNodeArray	nodes;
+		nodes.resize(nnodes);
+		for(i=0;i<nnodes;++i) nodes[i]=m_nodes[keys[i].m_index];
+		for(i=0;i<nnodes;++i) m_nodes[i]=nodes[i];
+	}
+	if(m_pose.m_pos.size()==nnodes)
+	{
+		tVector3Array	pos;
+		tScalarArray	wgh;
+		pos.resize(nnodes);
+		wgh.resize(nnodes);
+		for(i=0;i<nnodes;++i)
+		{
+			pos[i]=m_pose.m_pos[keys[i].m_index];
+			wgh[i]=m_pose.m_wgh[keys[i].m_index];
+		}
+		for(i=0;i<nnodes;++i)
+		{
+			m_pose.m_pos[i]=pos[i];
+			m_pose.m_wgh[i]=wgh[i];
+		}
+	}
+	indicesToPointers(&map[0]);
+	/* Sort constraints	*/ 
+	m_links.quickSort(btSoftBodyLinkPredicate());
+	m_faces.quickSort(btSoftBodyFacePredicate());
+	m_tetras.quickSort(btSoftBodyTetraPredicate());
+	for(i=0,ni=m_faces.size();i<ni;++i)
+	{
+		if(m_faces[i].m_leaf)
+		{
+			m_faces[i].m_leaf->data=&m_faces[i];
+		}
+	}
+}
+
 //
 void			btSoftBody::releaseCluster(int index)
 {
@@ -2080,6 +2224,13 @@ void				btSoftBody::pointersToIndices()
 			m_faces[i].m_leaf->data=*(void**)&i;
 		}
 	}
+	for(i=0,ni=m_tetras.size();i<ni;++i)
+	{
+		for(int j=0;j<4;++j)
+		{
+			m_tetras[i].m_n[j]=PTR2IDX(m_tetras[i].m_n[j],base);
+		}
+	}
 	for(i=0,ni=m_anchors.size();i<ni;++i)
 	{
 		m_anchors[i].m_node=PTR2IDX(m_anchors[i].m_node,base);
@@ -2124,6 +2275,13 @@ void				btSoftBody::indicesToPointers(const int* map)
 			m_faces[i].m_leaf->data=&m_faces[i];
 		}
 	}
+	for(i=0,ni=m_tetras.size();i<ni;++i)
+	{
+		for(int j=0;j<4;++j)
+		{
+			m_tetras[i].m_n[j]=IDX2PTR(m_tetras[i].m_n[j],base);
+		}
+	}
 	for(i=0,ni=m_anchors.size();i<ni;++i)
 	{
 		m_anchors[i].m_node=IDX2PTR(m_anchors[i].m_node,base);
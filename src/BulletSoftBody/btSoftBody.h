@@ -846,6 +846,11 @@ public:
 		Material* mat=0);
 	/* Randomize constraints to reduce solver bias							*/ 
 	void				randomizeConstraints();
+	/* Reorder nodes, links, faces and tetras for cache locality			*/ 
+	///optimizeMemoryLayout sorts nodes along a Morton (Z-order) curve and sorts links, faces
+	///and tetras by their lowest node index. This undoes randomizeConstraints.
+	///Call it before the soft body is added to the world.
+	void				optimizeMemoryLayout();
 	/* Release clusters														*/ 
 	void				releaseCluster(int index);
 	void				releaseClusters();
@@ -14,6 +14,7 @@ subject to the following restrictions:
 */
 
 #include "btAlignedAllocator.h"
+#include "btAllocatorContext.h"
 
 int gNumAlignedAllocs = 0;
 int gNumAlignedFree = 0;
@@ -156,11 +157,54 @@ void    btAlignedFreeInternal   (void* ptr,int line,char* filename)
 
 #else //BT_DEBUG_MEMORY_ALLOCATIONS
 
+#if !defined (BT_HAS_ALIGNED_ALLOCATOR) && !defined(__CELLOS_LV2__)
+//btAlignedAllocDefault stores the pointer returned by sAllocFunc right in front of the aligned memory
+#define BT_ALIGNED_ALLOC_DEFAULT_STORES_BASE
+#endif
+
+///blocks of a btAllocatorContext start with a header right in front of the returned memory, it records the context
+///that owns the block. The base pointer in front of the memory is tagged with the lowest bit, a block of btAlignedAllocDefault
+///has the untagged pointer from sAllocFunc there, so those need no header. Blocks of other aligned allocators always have one.
+struct btAlignedBlockHeader
+{
+	btAllocatorContext*	m_context;
+	size_t				m_taggedBase;
+};
+
+static bool	btAlignedAllocNeedsHeader()
+{
+#ifdef BT_ALIGNED_ALLOC_DEFAULT_STORES_BASE
+	return sAlignedAllocFunc != btAlignedAllocDefault;
+#else
+	return true;
+#endif
+}
+
 void*	btAlignedAllocInternal	(size_t size, int alignment)
 {
 	gNumAlignedAllocs++;
-	void* ptr;
-	ptr = sAlignedAllocFunc(size, alignment);
+	btAllocatorContext* context = btGetThreadAllocatorContext();
+	if (!context && !btAlignedAllocNeedsHeader())
+	{
+		void* ptr = sAlignedAllocFunc(size, alignment);
+		btAssert(!ptr || !(*((size_t*)ptr-1) & 1));
+		return ptr;
+	}
+
+	if (alignment < int(sizeof(void*)))
+		alignment = int(sizeof(void*));
+	//the header size is a multiple of the alignment, so the returned memory keeps the alignment of the block
+	size_t headerSize = (sizeof(btAlignedBlockHeader)+alignment-1) & ~size_t(alignment-1);
+
+	char* base = context ? (char*)context->allocate(size+headerSize,alignment) : (char*)sAlignedAllocFunc(size+headerSize,alignment);
+	if (!base)
+	{
+		return 0;
+	}
+	void* ptr = base+headerSize;
+	btAlignedBlockHeader* header = (btAlignedBlockHeader*)ptr-1;
+	header->m_context = context;
+	header->m_taggedBase = size_t(base) | 1;
 //	printf("btAlignedAllocInternal %d, %x\n",size,ptr);
 	return ptr;
 }
@@ -174,7 +218,20 @@ void	btAlignedFreeInternal	(void* ptr)
 
 	gNumAlignedFree++;
 //	printf("btAlignedFreeInternal %x\n",ptr);
-	sAlignedFreeFunc(ptr);
+	btAlignedBlockHeader* header = (btAlignedBlockHeader*)ptr-1;
+	if (!(header->m_taggedBase & 1))
+	{
+		sAlignedFreeFunc(ptr);
+		return;
+	}
+	void* base = (void*)(header->m_taggedBase & ~size_t(1));
+	if (header->m_context)
+	{
+		header->m_context->freeMemory(base);
+	} else
+	{
+		sAlignedFreeFunc(base);
+	}
 }
 
 #endif //BT_DEBUG_MEMORY_ALLOCATIONS
@@ -53,6 +53,7 @@ typedef void (btFreeFunc)(void *memblock);
 void btAlignedAllocSetCustom(btAllocFunc *allocFunc, btFreeFunc *freeFunc);
 ///If the developer has already an custom aligned allocator, then btAlignedAllocSetCustomAligned can be used. The default aligned allocator pre-allocates extra memory using the non-aligned allocator, and instruments it.
 void btAlignedAllocSetCustomAligned(btAlignedAllocFunc *allocFunc, btAlignedFreeFunc *freeFunc);
+///Allocations made while a btAllocatorContext is installed for the calling thread use that context instead of the global allocator, see btAllocatorContext.h
 
 
 ///The btAlignedAllocator is a portable class for aligned memory allocations.
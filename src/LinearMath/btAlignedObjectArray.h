@@ -71,6 +71,11 @@ protected:
 		{
 			return (size ? size*2 : 1);
 		}
+		///the current storage, also when the array is empty
+		SIMD_FORCE_INLINE	const T*	getStorage() const
+		{
+			return m_data;
+		}
 		SIMD_FORCE_INLINE	void	copy(int start,int end, T* dest) const
 		{
 			int i;
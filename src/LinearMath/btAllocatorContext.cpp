@@ -0,0 +1,190 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btAllocatorContext.h"
+#include <stdlib.h>
+
+#if defined(_WIN32) && !defined(_XBOX)
+#include <windows.h>
+#endif
+
+#if defined(_MSC_VER)
+#define BT_ALLOCATOR_CONTEXT_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) && !defined(__CELLOS_LV2__)
+#define BT_ALLOCATOR_CONTEXT_THREAD_LOCAL __thread
+#else
+//no thread local storage: all threads share one context pointer, only single threaded use is safe
+#define BT_ALLOCATOR_CONTEXT_THREAD_LOCAL
+#endif
+
+static BT_ALLOCATOR_CONTEXT_THREAD_LOCAL btAllocatorContext* gThreadAllocatorContext = 0;
+
+btAllocatorContext*	btGetThreadAllocatorContext()
+{
+	return gThreadAllocatorContext;
+}
+
+btAllocatorContext*	btSetThreadAllocatorContext(btAllocatorContext* context)
+{
+	btAllocatorContext* prev = gThreadAllocatorContext;
+	gThreadAllocatorContext = context;
+	return prev;
+}
+
+btAllocatorContext::btAllocatorContext(size_t budget)
+	:m_blocks(0),
+	m_bytesInUse(0),
+	m_peakBytes(0),
+	m_budget(budget),
+	m_numAllocs(0),
+	m_numFrees(0),
+	m_numBudgetViolations(0),
+	m_lock(0)
+{
+}
+
+btAllocatorContext::~btAllocatorContext()
+{
+	btAssert(!m_blocks);
+	//an installed context must outlive its scope
+	btAssert(gThreadAllocatorContext != this);
+}
+
+void*	btAllocatorContext::allocateBlock(size_t size)
+{
+	return ::malloc(size);
+}
+
+void	btAllocatorContext::freeBlock(void* ptr)
+{
+	::free(ptr);
+}
+
+bool	btAllocatorContext::budgetExceeded(size_t size)
+{
+	(void)size;
+	return true;
+}
+
+void	btAllocatorContext::lock()
+{
+#if defined(_WIN32) && !defined(_XBOX)
+	while (InterlockedExchange((volatile LONG*)&m_lock,1))
+	{
+	}
+#elif defined(__GNUC__)
+	while (__sync_lock_test_and_set(&m_lock,1))
+	{
+	}
+#endif
+}
+
+void	btAllocatorContext::unlock()
+{
+#if defined(_WIN32) && !defined(_XBOX)
+	InterlockedExchange((volatile LONG*)&m_lock,0);
+#elif defined(__GNUC__)
+	__sync_lock_release(&m_lock);
+#endif
+}
+
+void*	btAllocatorContext::allocate(size_t size, int alignment)
+{
+	//the bytes are reserved before the block is allocated, so concurrent allocations can't pass the budget together
+	lock();
+	m_bytesInUse += size;
+	bool overBudget = m_budget && m_bytesInUse > m_budget;
+	if (overBudget)
+		m_numBudgetViolations++;
+	unlock();
+	if (overBudget && !budgetExceeded(size))
+	{
+		lock();
+		m_bytesInUse -= size;
+		unlock();
+		return 0;
+	}
+
+	//the block header is followed by the pointer to the start of the block, right in front of the aligned memory
+	char* real = (char*)allocateBlock(sizeof(btAllocatorBlock)+sizeof(void*)+(alignment-1)+size);
+	if (!real)
+	{
+		lock();
+		m_bytesInUse -= size;
+		unlock();
+		return 0;
+	}
+	void* ret = btAlignPointer(real+sizeof(btAllocatorBlock)+sizeof(void*),alignment);
+	*((void**)(ret)-1) = (void*)real;
+
+	btAllocatorBlock* block = (btAllocatorBlock*)real;
+	block->m_size = size;
+	block->m_prev = 0;
+
+	lock();
+	block->m_next = m_blocks;
+	if (m_blocks)
+		m_blocks->m_prev = block;
+	m_blocks = block;
+	m_numAllocs++;
+	if (m_bytesInUse > m_peakBytes)
+		m_peakBytes = m_bytesInUse;
+	unlock();
+	return ret;
+}
+
+void	btAllocatorContext::freeMemory(void* ptr)
+{
+	if (!ptr)
+		return;
+	btAllocatorBlock* block = (btAllocatorBlock*)*((void**)(ptr)-1);
+
+	lock();
+	if (block->m_prev)
+		block->m_prev->m_next = block->m_next;
+	else
+		m_blocks = block->m_next;
+	if (block->m_next)
+		block->m_next->m_prev = block->m_prev;
+	m_numFrees++;
+	m_bytesInUse -= block->m_size;
+	unlock();
+
+	freeBlock(block);
+}
+
+void	btAllocatorContext::resetPeakBytes()
+{
+	lock();
+	m_peakBytes = m_bytesInUse;
+	unlock();
+}
+
+void	btAllocatorContext::releaseAll()
+{
+	lock();
+	btAllocatorBlock* block = m_blocks;
+	m_blocks = 0;
+	m_numFrees = m_numAllocs;
+	m_bytesInUse = 0;
+	unlock();
+
+	while (block)
+	{
+		btAllocatorBlock* next = block->m_next;
+		freeBlock(block);
+		block = next;
+	}
+}
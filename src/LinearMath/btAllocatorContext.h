@@ -0,0 +1,141 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_ALLOCATOR_CONTEXT_H
+#define BT_ALLOCATOR_CONTEXT_H
+
+#include "btScalar.h"
+#include <stddef.h>
+
+///btAllocatorContext owns all btAlignedAlloc memory allocated while it is installed for the calling thread.
+///This covers btAlignedObjectArray storage, btPoolAllocator chunks and objects using BT_DECLARE_ALIGNED_ALLOCATOR,
+///such as collision shapes, rigid bodies and the world itself. A block is always returned to the context that allocated it,
+///even when it is freed while another context, or none, is installed.
+///Each context keeps its own memory accounting and an optional budget. Derive from it and override allocateBlock/freeBlock
+///to use a separate (for example NUMA-local) heap per context.
+///releaseAll frees every block still owned by the context at once, without running any destructors.
+class btAllocatorContext
+{
+	struct btAllocatorBlock
+	{
+		btAllocatorBlock*	m_prev;
+		btAllocatorBlock*	m_next;
+		size_t				m_size;
+	};
+
+	btAllocatorBlock*	m_blocks;
+	size_t		m_bytesInUse;
+	size_t		m_peakBytes;
+	size_t		m_budget;
+	int			m_numAllocs;
+	int			m_numFrees;
+	int			m_numBudgetViolations;
+	volatile int	m_lock;
+
+	void	lock();
+	void	unlock();
+
+	btAllocatorContext(const btAllocatorContext&);
+	btAllocatorContext& operator=(const btAllocatorContext&);
+
+protected:
+
+	///returns size bytes from the heap of this context, the default uses malloc
+	virtual void*	allocateBlock(size_t size);
+
+	///returns a block from allocateBlock to the heap of this context, the default uses free
+	virtual void	freeBlock(void* ptr);
+
+	///called when an allocation of size bytes would bring getBytesInUse above the budget.
+	///Return true to allow the allocation anyway (the default), false to make it return 0.
+	virtual bool	budgetExceeded(size_t size);
+
+public:
+
+	///budget is the maximum number of bytes in use, 0 means unlimited
+	btAllocatorContext(size_t budget = 0);
+
+	///the context must not own any blocks anymore, call releaseAll to drop the remaining ones
+	virtual ~btAllocatorContext();
+
+	///returns size bytes aligned to alignment (a power of two). The memory is accounted to this context.
+	void*	allocate(size_t size, int alignment);
+
+	///frees a pointer returned by allocate
+	void	freeMemory(void* ptr);
+
+	///frees all blocks still owned by this context. No destructors are run, nothing allocated from it may be used afterwards.
+	void	releaseAll();
+
+	size_t	getBytesInUse() const
+	{
+		return m_bytesInUse;
+	}
+	///largest value of getBytesInUse since construction or the last resetPeakBytes
+	size_t	getPeakBytes() const
+	{
+		return m_peakBytes;
+	}
+	void	resetPeakBytes();
+	size_t	getBudget() const
+	{
+		return m_budget;
+	}
+	void	setBudget(size_t budget)
+	{
+		m_budget = budget;
+	}
+	int		getNumAllocations() const
+	{
+		return m_numAllocs;
+	}
+	int		getNumFrees() const
+	{
+		return m_numFrees;
+	}
+	int		getNumBlocks() const
+	{
+		return m_numAllocs-m_numFrees;
+	}
+	///number of allocations that went over the budget
+	int		getNumBudgetViolations() const
+	{
+		return m_numBudgetViolations;
+	}
+};
+
+///returns the allocator context installed for the calling thread, or 0 when btAlignedAlloc uses the global allocator
+btAllocatorContext*	btGetThreadAllocatorContext();
+
+///installs context for the calling thread and returns the previous one, 0 restores the global allocator
+btAllocatorContext*	btSetThreadAllocatorContext(btAllocatorContext* context);
+
+///btAllocatorContextScope installs a context for the calling thread and restores the previous one when it goes out of scope
+class btAllocatorContextScope
+{
+	btAllocatorContext*	m_prevContext;
+
+public:
+	btAllocatorContextScope(btAllocatorContext* context)
+	{
+		m_prevContext = btSetThreadAllocatorContext(context);
+	}
+	~btAllocatorContextScope()
+	{
+		btSetThreadAllocatorContext(m_prevContext);
+	}
+};
+
+#endif //BT_ALLOCATOR_CONTEXT_H
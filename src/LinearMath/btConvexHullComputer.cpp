@@ -2627,6 +2627,120 @@ bool btConvexHullInternal::shiftFace(Face* face, btScalar amount, btAlignedObjec
 }
 
 
+//inputs of at least this many points are culled first, see cullInteriorPoints
+static const int CULL_INTERIOR_POINTS_THRESHOLD = 1024;
+
+//Drops the points that lie deep inside the hull of the extreme points along 13 directions. The hull and the
+//quantization of the remaining points do not change, so the exact algorithm below gives the same result, but only
+//has to sort and merge the points near the surface. Returns false for a flat input, which is left to the exact algorithm.
+static bool cullInteriorPoints(const void* coords, bool doubleCoords, int stride, int count, btAlignedObjectArray<btVector3>& remaining)
+{
+	btAlignedObjectArray<btVector3> points;
+	points.resize(count);
+	btVector3 min(btScalar(1e30), btScalar(1e30), btScalar(1e30)), max(btScalar(-1e30), btScalar(-1e30), btScalar(-1e30));
+	const char* ptr = (const char*) coords;
+	for (int i = 0; i < count; i++)
+	{
+		if (doubleCoords)
+		{
+			const double* v = (const double*) ptr;
+			points[i].setValue((btScalar) v[0], (btScalar) v[1], (btScalar) v[2]);
+		}
+		else
+		{
+			const float* v = (const float*) ptr;
+			points[i].setValue(v[0], v[1], v[2]);
+		}
+		ptr += stride;
+		min.setMin(points[i]);
+		max.setMax(points[i]);
+	}
+
+	//the extreme points span a polytope inside the hull
+	static const btScalar directions[13][3] =
+	{
+		{1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+		{1, 1, 0}, {1, -1, 0}, {1, 0, 1}, {1, 0, -1}, {0, 1, 1}, {0, 1, -1},
+		{1, 1, 1}, {1, 1, -1}, {1, -1, 1}, {1, -1, -1}
+	};
+	btAlignedObjectArray<int> extremeIndices;
+	for (int i = 0; i < 13; i++)
+	{
+		const btVector3 dir(directions[i][0], directions[i][1], directions[i][2]);
+		btScalar dot;
+		const int indices[2] = {(int) dir.maxDot(&points[0], count, dot), (int) dir.minDot(&points[0], count, dot)};
+		for (int j = 0; j < 2; j++)
+		{
+			if (extremeIndices.findLinearSearch(indices[j]) == extremeIndices.size())
+			{
+				extremeIndices.push_back(indices[j]);
+			}
+		}
+	}
+	btAlignedObjectArray<btVector3> extremePoints;
+	for (int i = 0; i < extremeIndices.size(); i++)
+	{
+		extremePoints.push_back(points[extremeIndices[i]]);
+	}
+	btConvexHullComputer polytope;
+	polytope.compute(&extremePoints[0].getX(), sizeof(btVector3), extremePoints.size(), 0, 0);
+	if (polytope.faces.size() < 4)
+	{
+		return false;
+	}
+
+	//the exact algorithm rounds the points to 10216 steps along each axis of the bounding box, a point has to be inside
+	//the polytope by more than a few steps to stay inside after rounding
+	const btScalar margin = btScalar(4) * (max - min).length() / btScalar(10216);
+	btAlignedObjectArray<btVector3> normals;
+	btAlignedObjectArray<btScalar> offsets;
+	for (int i = 0; i < polytope.faces.size(); i++)
+	{
+		//Newell's method, the faces are counter-clockwise seen from the outside
+		const btConvexHullComputer::Edge* firstEdge = &polytope.edges[polytope.faces[i]];
+		const btConvexHullComputer::Edge* edge = firstEdge;
+		btVector3 normal(0, 0, 0);
+		do
+		{
+			const btVector3& a = polytope.vertices[edge->getSourceVertex()];
+			const btVector3& b = polytope.vertices[edge->getTargetVertex()];
+			normal += (a - b).cross(a + b);
+			edge = edge->getNextEdgeOfFace();
+		} while (edge != firstEdge);
+		const btScalar length = normal.length();
+		if (length <= SIMD_EPSILON)
+		{
+			return false;
+		}
+		normal /= length;
+		normals.push_back(normal);
+		offsets.push_back(normal.dot(polytope.vertices[firstEdge->getSourceVertex()]) - margin);
+	}
+
+	remaining.resize(0);
+	const int numPlanes = normals.size();
+	int lastSeparatingPlane = 0;
+	for (int i = 0; i < count; i++)
+	{
+		const btVector3& p = points[i];
+		//neighbouring points tend to lie outside the same plane
+		bool inside = normals[lastSeparatingPlane].dot(p) < offsets[lastSeparatingPlane];
+		for (int j = 0; inside && j < numPlanes; j++)
+		{
+			if (normals[j].dot(p) >= offsets[j])
+			{
+				lastSeparatingPlane = j;
+				inside = false;
+			}
+		}
+		if (!inside)
+		{
+			remaining.push_back(p);
+		}
+	}
+	return true;
+}
+
 static int getVertexCopy(btConvexHullInternal::Vertex* vertex, btAlignedObjectArray<btConvexHullInternal::Vertex*>& vertices)
 {
 	int index = vertex->copy;
@@ -2653,7 +2767,19 @@ btScalar btConvexHullComputer::compute(const void* coords, bool doubleCoords, in
 	}
 
 	btConvexHullInternal hull;
-	hull.compute(coords, doubleCoords, stride, count);
+	btAlignedObjectArray<btVector3> remaining;
+	if ((count >= CULL_INTERIOR_POINTS_THRESHOLD) && cullInteriorPoints(coords, doubleCoords, stride, count, remaining))
+	{
+#ifdef BT_USE_DOUBLE_PRECISION
+		hull.compute(&remaining[0].getX(), true, sizeof(btVector3), remaining.size());
+#else
+		hull.compute(&remaining[0].getX(), false, sizeof(btVector3), remaining.size());
+#endif
+	}
+	else
+	{
+		hull.compute(coords, doubleCoords, stride, count);
+	}
 
 	btScalar shift = 0;
 	if ((shrink > 0) && ((shift = hull.shrink(shrink, shrinkClamp)) < 0))
@@ -0,0 +1,115 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btFrameArena.h"
+#include "btMinMax.h"
+
+#if defined(_MSC_VER)
+#define BT_FRAME_ARENA_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) && !defined(__CELLOS_LV2__)
+#define BT_FRAME_ARENA_THREAD_LOCAL __thread
+#else
+//no thread local storage: all threads share one arena pointer, only single threaded use is safe
+#define BT_FRAME_ARENA_THREAD_LOCAL
+#endif
+
+static BT_FRAME_ARENA_THREAD_LOCAL btFrameArena* gThreadFrameArena = 0;
+
+btFrameArena*	btGetThreadFrameArena()
+{
+	return gThreadFrameArena;
+}
+
+btFrameArena*	btSetThreadFrameArena(btFrameArena* arena)
+{
+	btFrameArena* prev = gThreadFrameArena;
+	gThreadFrameArena = arena;
+	return prev;
+}
+
+btFrameArena::btFrameArena(int initialSize)
+	:m_currentChunk(0),
+	m_offset(0),
+	m_usedBefore(0),
+	m_highWaterMark(0),
+	m_numOverflows(0)
+{
+	addChunk(btMax(initialSize,1024));
+}
+
+btFrameArena::~btFrameArena()
+{
+	freeChunks();
+}
+
+void	btFrameArena::addChunk(int size)
+{
+	btFrameArenaChunk chunk;
+	chunk.m_data = (unsigned char*)btAlignedAlloc(size,16);
+	chunk.m_size = size;
+	m_chunks.push_back(chunk);
+}
+
+void	btFrameArena::freeChunks()
+{
+	for (int i=0;i<m_chunks.size();i++)
+	{
+		btAlignedFree(m_chunks[i].m_data);
+	}
+	m_chunks.clear();
+}
+
+void*	btFrameArena::allocateOverflow(int size, int alignment)
+{
+	m_usedBefore += m_offset;
+	m_offset = 0;
+	m_currentChunk++;
+	if (m_currentChunk == m_chunks.size())
+	{
+		m_numOverflows++;
+		addChunk(btMax(size+alignment,m_chunks[m_currentChunk-1].m_size*2));
+	} else if (m_chunks[m_currentChunk].m_size < size+alignment)
+	{
+		//a chunk left from an earlier rewind is too small, replace it. Chunks after it are unused at this point.
+		btAlignedFree(m_chunks[m_currentChunk].m_data);
+		m_chunks[m_currentChunk].m_size = btMax(size+alignment,m_chunks[m_currentChunk].m_size*2);
+		m_chunks[m_currentChunk].m_data = (unsigned char*)btAlignedAlloc(m_chunks[m_currentChunk].m_size,16);
+	}
+	return allocate(size,alignment);
+}
+
+void	btFrameArena::reset()
+{
+	if (m_chunks.size()>1)
+	{
+		//merge all chunks into one that fits the largest step seen so far
+		int size = btMax(getCapacity(),m_highWaterMark+16*m_chunks.size());
+		freeChunks();
+		addChunk(size);
+	}
+	m_currentChunk = 0;
+	m_offset = 0;
+	m_usedBefore = 0;
+}
+
+int	btFrameArena::getCapacity() const
+{
+	int capacity = 0;
+	for (int i=0;i<m_chunks.size();i++)
+	{
+		capacity += m_chunks[i].m_size;
+	}
+	return capacity;
+}
@@ -0,0 +1,166 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_FRAME_ARENA_H
+#define BT_FRAME_ARENA_H
+
+#include "btScalar.h"
+#include "btAlignedAllocator.h"
+#include "btAlignedObjectArray.h"
+
+///btFrameArena is a linear (bump) allocator for data that only lives during one simulation step.
+///Memory is never freed individually: reset releases everything in O(1), getMarker/rewind release
+///everything allocated after the marker, in LIFO order like btStackAlloc blocks.
+///When a step needs more than the current chunk, extra chunks are added. The next reset merges them
+///into a single chunk of the high-water size, so a steady-state simulation does no heap allocations.
+///A btFrameArena is not thread-safe, each thread uses its own arena, see btSetThreadFrameArena.
+class btFrameArena
+{
+	struct btFrameArenaChunk
+	{
+		unsigned char*	m_data;
+		int				m_size;
+	};
+
+	btAlignedObjectArray<btFrameArenaChunk>	m_chunks;
+	int		m_currentChunk;
+	int		m_offset;
+	///bytes in use in all chunks before m_currentChunk
+	int		m_usedBefore;
+	int		m_highWaterMark;
+	int		m_numOverflows;
+
+	void	addChunk(int size);
+	void	freeChunks();
+
+public:
+
+	struct	Marker
+	{
+		int	m_chunk;
+		int	m_offset;
+		int	m_usedBefore;
+	};
+
+	btFrameArena(int initialSize = 256*1024);
+
+	~btFrameArena();
+
+	///returns size bytes aligned to alignment (a power of two, at most 16 bytes for the default chunk alignment)
+	void*	allocate(int size, int alignment = 16)
+	{
+		int start = (m_offset + alignment-1) & ~(alignment-1);
+		if (start+size <= m_chunks[m_currentChunk].m_size)
+		{
+			m_offset = start+size;
+			int used = m_usedBefore+m_offset;
+			if (used > m_highWaterMark)
+				m_highWaterMark = used;
+			return m_chunks[m_currentChunk].m_data+start;
+		}
+		return allocateOverflow(size,alignment);
+	}
+
+	///moves to the next chunk, adding one when needed
+	void*	allocateOverflow(int size, int alignment);
+
+	Marker	getMarker() const
+	{
+		Marker m;
+		m.m_chunk = m_currentChunk;
+		m.m_offset = m_offset;
+		m.m_usedBefore = m_usedBefore;
+		return m;
+	}
+
+	///releases all allocations made after the marker was taken
+	void	rewind(const Marker& marker)
+	{
+		m_currentChunk = marker.m_chunk;
+		m_offset = marker.m_offset;
+		m_usedBefore = marker.m_usedBefore;
+	}
+
+	///releases all allocations, call it at the end of each step
+	void	reset();
+
+	///lets array use count elements of arena memory. The array still grows on the heap if it outgrows them.
+	template <typename T>
+	void	attach(btAlignedObjectArray<T>& array, int count)
+	{
+		void* mem = allocate(int(sizeof(T))*count);
+		array.initializeFromBuffer(mem,0,count);
+	}
+
+	int	getUsedBytes() const
+	{
+		return m_usedBefore+m_offset;
+	}
+
+	///total size of all chunks
+	int	getCapacity() const;
+
+	///largest number of bytes in use at the same time since construction
+	int	getHighWaterMark() const
+	{
+		return m_highWaterMark;
+	}
+
+	///number of times a step outgrew the arena and an extra chunk was needed
+	int	getNumOverflows() const
+	{
+		return m_numOverflows;
+	}
+};
+
+///btFrameArenaScope rewinds the arena to the state at construction when it goes out of scope, for temporaries inside a step
+class btFrameArenaScope
+{
+	btFrameArena*			m_arena;
+	btFrameArena::Marker	m_marker;
+
+public:
+	btFrameArenaScope(btFrameArena* arena)
+		:m_arena(arena),
+		m_marker(arena ? arena->getMarker() : btFrameArena::Marker())
+	{
+	}
+	~btFrameArenaScope()
+	{
+		if (m_arena)
+			m_arena->rewind(m_marker);
+	}
+};
+
+///returns the arena installed for the calling thread, or 0 when transient allocations should use the heap
+btFrameArena*	btGetThreadFrameArena();
+
+///installs arena for the calling thread and returns the previous one
+btFrameArena*	btSetThreadFrameArena(btFrameArena* arena);
+
+///reserves count elements in array, from the thread arena if there is one, otherwise from the heap.
+///Nothing happens when the array already has room, for example in the inline storage of a btInlineObjectArray.
+template <typename T>
+SIMD_FORCE_INLINE void	btFrameArenaReserve(btFrameArena* arena, btAlignedObjectArray<T>& array, int count)
+{
+	if (array.capacity() >= count)
+		return;
+	if (arena)
+		arena->attach(array,count);
+	else
+		array.reserve(count);
+}
+
+#endif //BT_FRAME_ARENA_H
@@ -395,6 +395,12 @@ protected:
 		return &m_valueArray[index];
 	}
 
+	const Key&	getKeyAtIndex(int index) const
+	{
+		btAssert(index < m_keyArray.size());
+		return m_keyArray[index];
+	}
+
 	Value* operator[](const Key& key) {
 		return find(key);
 	}
@@ -0,0 +1,87 @@
+/*
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2014 Erwin Coumans  http://bulletphysics.org
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_INLINE_OBJECT_ARRAY_H
+#define BT_INLINE_OBJECT_ARRAY_H
+
+#include "btAlignedObjectArray.h"
+
+///btInlineObjectArray is a btAlignedObjectArray with room for N elements inside the object itself.
+///Up to N elements no heap memory is used, beyond that it grows on the heap like any btAlignedObjectArray.
+///It can be passed wherever a btAlignedObjectArray<T>& is expected. Use it for short-lived local arrays on hot paths.
+template <typename T, int N>
+class btInlineObjectArray : public btAlignedObjectArray<T>
+{
+	ATTRIBUTE_ALIGNED16(char	m_inlineStorage[N*sizeof(T)]);
+
+	void	initInline()
+	{
+		this->initializeFromBuffer(m_inlineStorage,0,N);
+	}
+
+public:
+
+	btInlineObjectArray()
+	{
+		initInline();
+	}
+
+	btInlineObjectArray(const btInlineObjectArray& otherArray)
+		:btAlignedObjectArray<T>()
+	{
+		initInline();
+		this->copyFromArray(otherArray);
+	}
+
+	btInlineObjectArray(const btAlignedObjectArray<T>& otherArray)
+	{
+		initInline();
+		this->copyFromArray(otherArray);
+	}
+
+	~btInlineObjectArray()
+	{
+		//destroy the elements while the inline storage is still alive
+		btAlignedObjectArray<T>::clear();
+	}
+
+	btInlineObjectArray& operator=(const btInlineObjectArray& otherArray)
+	{
+		this->copyFromArray(otherArray);
+		return *this;
+	}
+
+	btInlineObjectArray& operator=(const btAlignedObjectArray<T>& otherArray)
+	{
+		this->copyFromArray(otherArray);
+		return *this;
+	}
+
+	///clears the array, frees any heap memory and returns to the inline storage
+	void	clear()
+	{
+		btAlignedObjectArray<T>::clear();
+		initInline();
+	}
+
+	///returns true while the elements live in the inline storage. A btAlignedObjectArray::clear through a base reference
+	///frees the storage, and the array then grows on the heap until btInlineObjectArray::clear is called.
+	bool	isInline() const
+	{
+		return (const void*)this->getStorage() == (const void*)m_inlineStorage;
+	}
+};
+
+#endif //BT_INLINE_OBJECT_ARRAY_H
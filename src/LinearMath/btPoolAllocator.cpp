@@ -0,0 +1,144 @@
+/*
+Copyright (c) 2003-2014 Gino van den Bergen / Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btPoolAllocator.h"
+#include "btMinMax.h"
+
+#ifdef _XBOX
+#include <Xtl.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#elif !defined(__GNUC__) && !defined(BT_POOL_ALLOCATOR_SINGLE_THREADED)
+//without an atomic exchange the batch functions and btPoolAllocatorThreadCache would silently lose thread safety
+#error "btPoolAllocator has no lock for this compiler, add one to lock and unlock or define BT_POOL_ALLOCATOR_SINGLE_THREADED"
+#endif
+
+btPoolAllocator::btPoolAllocator(int elemSize, int maxElements, int growElements)
+	:m_elemSize(elemSize),
+	m_maxElements(0),
+	m_freeCount(0),
+	m_firstFree(0),
+	m_pool(0),
+	m_growElements(growElements),
+	m_highWaterMark(0),
+	m_numGrowths(0),
+	m_lock(0)
+{
+	//the free list is stored inside the elements
+	btAssert(m_elemSize >= int(sizeof(void*)));
+	addChunk(btMax(maxElements,1));
+	m_pool = m_chunks[0];
+	m_numGrowths = 0;
+}
+
+btPoolAllocator::~btPoolAllocator()
+{
+	for (int i=0;i<m_chunks.size();i++)
+	{
+		btAlignedFree(m_chunks[i]);
+	}
+}
+
+void	btPoolAllocator::addChunk(int numElements)
+{
+	unsigned char* chunk = (unsigned char*) btAlignedAlloc( static_cast<unsigned int>(m_elemSize*numElements),16);
+	m_chunks.push_back(chunk);
+	m_chunkElements.push_back(numElements);
+
+	//link the new elements in front of the current free list
+	unsigned char* p = chunk;
+	int count = numElements;
+	while (--count) {
+		*(void**)p = (p + m_elemSize);
+		p += m_elemSize;
+	}
+	*(void**)p = m_firstFree;
+	m_firstFree = chunk;
+	m_freeCount += numElements;
+	m_maxElements += numElements;
+	m_numGrowths++;
+}
+
+void	btPoolAllocator::lock()
+{
+#if defined(_WIN32) || defined(_XBOX)
+	while (InterlockedExchange((volatile LONG*)&m_lock,1))
+	{
+	}
+#elif defined(__GNUC__)
+	while (__sync_lock_test_and_set(&m_lock,1))
+	{
+	}
+#endif
+}
+
+void	btPoolAllocator::unlock()
+{
+#if defined(_WIN32) || defined(_XBOX)
+	InterlockedExchange((volatile LONG*)&m_lock,0);
+#elif defined(__GNUC__)
+	__sync_lock_release(&m_lock);
+#endif
+}
+
+int		btPoolAllocator::allocateBatch(int count, void*& firstOut)
+{
+	lock();
+	if (m_freeCount < count && m_growElements>0)
+	{
+		addChunk(btMax(m_growElements,count-m_freeCount));
+	}
+	int numTaken = btMin(count,m_freeCount);
+	void* first = 0;
+	if (numTaken)
+	{
+		first = m_firstFree;
+		void* last = first;
+		for (int i=1;i<numTaken;i++)
+			last = *(void**)last;
+		m_firstFree = *(void**)last;
+		*(void**)last = firstOut;
+		m_freeCount -= numTaken;
+		if (getUsedCount() > m_highWaterMark)
+			m_highWaterMark = getUsedCount();
+		firstOut = first;
+	}
+	unlock();
+	return numTaken;
+}
+
+void	btPoolAllocator::freeBatch(void* first, void* last, int count)
+{
+	if (!count)
+		return;
+	lock();
+	*(void**)last = m_firstFree;
+	m_firstFree = first;
+	m_freeCount += count;
+	unlock();
+}
+
+void	btPoolAllocatorThreadCache::release(int count)
+{
+	count = btMin(count,m_freeCount);
+	if (!count)
+		return;
+	void* first = m_firstFree;
+	void* last = first;
+	for (int i=1;i<count;i++)
+		last = *(void**)last;
+	m_firstFree = *(void**)last;
+	m_freeCount -= count;
+	m_pool->freeBatch(first,last,count);
+}
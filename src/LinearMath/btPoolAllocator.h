@@ -18,8 +18,12 @@ subject to the following restrictions:
 
 #include "btScalar.h"
 #include "btAlignedAllocator.h"
+#include "btAlignedObjectArray.h"
 
 ///The btPoolAllocator class allows to efficiently allocate a large pool of objects, instead of dynamically allocating them separately.
+///The pool starts with a single contiguous chunk of maxElements. When growElements is non-zero, an exhausted pool adds
+///another chunk of growElements, existing elements never move. getPoolAddress only covers the first chunk.
+///allocate and freeMemory are not thread-safe. Threads that share a pool should each use a btPoolAllocatorThreadCache.
 class btPoolAllocator
 {
 	int				m_elemSize;
@@ -28,29 +32,23 @@ class btPoolAllocator
 	void*			m_firstFree;
 	unsigned char*	m_pool;
 
-public:
+	int				m_growElements;
+	int				m_highWaterMark;
+	int				m_numGrowths;
+	btAlignedObjectArray<unsigned char*>	m_chunks;
+	btAlignedObjectArray<int>				m_chunkElements;
+	volatile int	m_lock;
 
-	btPoolAllocator(int elemSize, int maxElements)
-		:m_elemSize(elemSize),
-		m_maxElements(maxElements)
-	{
-		m_pool = (unsigned char*) btAlignedAlloc( static_cast<unsigned int>(m_elemSize*m_maxElements),16);
+	void	addChunk(int numElements);
 
-		unsigned char* p = m_pool;
-        m_firstFree = p;
-        m_freeCount = m_maxElements;
-        int count = m_maxElements;
-        while (--count) {
-            *(void**)p = (p + m_elemSize);
-            p += m_elemSize;
-        }
-        *(void**)p = 0;
-    }
+	void	lock();
+	void	unlock();
 
-	~btPoolAllocator()
-	{
-		btAlignedFree( m_pool);
-	}
+public:
+
+	btPoolAllocator(int elemSize, int maxElements, int growElements = 0);
+
+	~btPoolAllocator();
 
 	int	getFreeCount() const
 	{
@@ -62,30 +60,85 @@ public:
 		return m_maxElements - m_freeCount;
 	}
 
+	///total number of elements over all chunks
 	int getMaxCount() const
 	{
 		return m_maxElements;
 	}
 
+	///number of elements added when the pool runs out, 0 for a fixed size pool
+	int	getGrowSize() const
+	{
+		return m_growElements;
+	}
+
+	void	setGrowSize(int growElements)
+	{
+		m_growElements = growElements;
+	}
+
+	///returns true if allocate will succeed, either from the free list or by growing
+	bool	canAllocate() const
+	{
+		return m_freeCount>0 || m_growElements>0;
+	}
+
+	///largest number of elements in use at the same time since construction or resetHighWaterMark
+	int	getHighWaterMark() const
+	{
+		return m_highWaterMark;
+	}
+
+	void	resetHighWaterMark()
+	{
+		m_highWaterMark = getUsedCount();
+	}
+
+	int	getNumChunks() const
+	{
+		return m_chunks.size();
+	}
+
+	///number of times the pool ran out and added a chunk
+	int	getNumGrowths() const
+	{
+		return m_numGrowths;
+	}
+
 	void*	allocate(int size)
 	{
 		// release mode fix
 		(void)size;
 		btAssert(!size || size<=m_elemSize);
-		btAssert(m_freeCount>0);
+		if (!m_freeCount)
+		{
+			btAssert(m_growElements>0);
+			if (m_growElements<=0)
+				return 0;
+			addChunk(m_growElements);
+		}
         void* result = m_firstFree;
         m_firstFree = *(void**)m_firstFree;
         --m_freeCount;
+		if (getUsedCount() > m_highWaterMark)
+			m_highWaterMark = getUsedCount();
         return result;
 	}
 
 	bool validPtr(void* ptr)
 	{
 		if (ptr) {
-			if (((unsigned char*)ptr >= m_pool && (unsigned char*)ptr < m_pool + m_maxElements * m_elemSize))
+			if (((unsigned char*)ptr >= m_pool && (unsigned char*)ptr < m_pool + m_chunkElements[0] * m_elemSize))
 			{
 				return true;
 			}
+			for (int i=1;i<m_chunks.size();i++)
+			{
+				if ((unsigned char*)ptr >= m_chunks[i] && (unsigned char*)ptr < m_chunks[i] + m_chunkElements[i] * m_elemSize)
+				{
+					return true;
+				}
+			}
 		}
 		return false;
 	}
@@ -93,7 +146,7 @@ public:
 	void	freeMemory(void* ptr)
 	{
 		 if (ptr) {
-            btAssert((unsigned char*)ptr >= m_pool && (unsigned char*)ptr < m_pool + m_maxElements * m_elemSize);
+            btAssert(validPtr(ptr));
 
             *(void**)ptr = m_firstFree;
             m_firstFree = ptr;
@@ -101,6 +154,12 @@ public:
         }
 	}
 
+	///takes up to count elements under the pool lock, linked through their first pointer. Returns the number of elements taken.
+	int		allocateBatch(int count, void*& firstOut);
+
+	///returns a list of count elements, linked through their first pointer from first to last, under the pool lock
+	void	freeBatch(void* first, void* last, int count);
+
 	int	getElementSize() const
 	{
 		return m_elemSize;
@@ -118,4 +177,73 @@ public:
 
 };
 
+///btPoolAllocatorThreadCache keeps a private free list for one thread. It refills from and returns to the
+///shared btPoolAllocator in batches, so the pool lock is taken once per batch instead of once per element.
+///Elements held by a cache count as used in the pool statistics.
+///Bullet does not create thread caches itself, they are meant for applications that allocate from a shared pool on several threads.
+class btPoolAllocatorThreadCache
+{
+	btPoolAllocator*	m_pool;
+	void*				m_firstFree;
+	int					m_freeCount;
+	int					m_batchSize;
+
+public:
+
+	btPoolAllocatorThreadCache(btPoolAllocator* pool, int batchSize = 32)
+		:m_pool(pool),
+		m_firstFree(0),
+		m_freeCount(0),
+		m_batchSize(batchSize)
+	{
+	}
+
+	~btPoolAllocatorThreadCache()
+	{
+		flush();
+	}
+
+	void*	allocate(int size)
+	{
+		(void)size;
+		btAssert(!size || size<=m_pool->getElementSize());
+		if (!m_firstFree)
+		{
+			m_freeCount += m_pool->allocateBatch(m_batchSize,m_firstFree);
+			if (!m_firstFree)
+				return 0;
+		}
+		void* result = m_firstFree;
+		m_firstFree = *(void**)m_firstFree;
+		--m_freeCount;
+		return result;
+	}
+
+	void	freeMemory(void* ptr)
+	{
+		if (ptr)
+		{
+			*(void**)ptr = m_firstFree;
+			m_firstFree = ptr;
+			++m_freeCount;
+			if (m_freeCount >= 2*m_batchSize)
+				release(m_batchSize);
+		}
+	}
+
+	///returns count elements of the private free list to the pool
+	void	release(int count);
+
+	///returns all cached elements to the pool
+	void	flush()
+	{
+		release(m_freeCount);
+	}
+
+	int	getFreeCount() const
+	{
+		return m_freeCount;
+	}
+};
+
 #endif //_BT_POOL_ALLOCATOR_H
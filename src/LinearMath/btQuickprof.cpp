@@ -15,11 +15,6 @@
 
 #include "btQuickprof.h"
 
-#ifndef BT_NO_PROFILE
-
-
-static btClock gProfileClock;
-
 
 #ifdef __CELLOS_LV2__
 #include <sys/sys_time.h>
@@ -50,6 +45,10 @@ static btClock gProfileClock;
 
 #else //_WIN32
 #include <sys/time.h>
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__NetBSD__)
+#define BT_USE_CLOCK_GETTIME
+#include <time.h>
+#endif
 #endif //_WIN32
 
 #define mymin(a,b) (a > b ? a : b)
@@ -67,6 +66,9 @@ struct btClockData
 	uint64_t	mStartTime;
 #else
 	struct timeval mStartTime;
+#ifdef BT_USE_CLOCK_GETTIME
+	struct timespec mStartTimeNs;
+#endif
 #endif
 #endif //__CELLOS_LV2__
 
@@ -117,6 +119,9 @@ void btClock::reset()
 	m_data->mStartTime = newTime;
 #else
 	gettimeofday(&m_data->mStartTime, 0);
+#ifdef BT_USE_CLOCK_GETTIME
+	clock_gettime(CLOCK_MONOTONIC, &m_data->mStartTimeNs);
+#endif
 #endif
 #endif
 }
@@ -235,13 +240,57 @@ unsigned long int btClock::getTimeMicroseconds()
 #endif 
 }
 
+	/// Returns the time in ns since the last call to reset or since 
+	/// the Clock was created.
+unsigned long long int btClock::getTimeNanoseconds() const
+{
+#ifdef BT_USE_WINDOWS_TIMERS
+		LARGE_INTEGER currentTime;
+		QueryPerformanceCounter(&currentTime);
+		LONGLONG elapsedTime = currentTime.QuadPart - 
+			m_data->mStartTime.QuadPart;
+		LONGLONG freq = m_data->mClockFrequency.QuadPart;
+		// Split into seconds and remainder to avoid overflowing 64 bits.
+		return (unsigned long long int)((elapsedTime / freq) * 1000000000 + 
+			((elapsedTime % freq) * 1000000000) / freq);
+#else
+
+#ifdef __CELLOS_LV2__
+		uint64_t freq=sys_time_get_timebase_frequency();
+		double dFreq=((double) freq)/ 1000000000.0;
+		typedef uint64_t  ClockSize;
+		ClockSize newTime;
+		SYS_TIMEBASE_GET( newTime );
+
+		return (unsigned long long int)((double(newTime-m_data->mStartTime)) / dFreq);
+#else
+#ifdef BT_USE_CLOCK_GETTIME
+		struct timespec currentTime;
+		clock_gettime(CLOCK_MONOTONIC, &currentTime);
+		return (unsigned long long int)(currentTime.tv_sec - m_data->mStartTimeNs.tv_sec) * 1000000000 + 
+			(currentTime.tv_nsec - m_data->mStartTimeNs.tv_nsec);
+#else
+		struct timeval currentTime;
+		gettimeofday(&currentTime, 0);
+		return ((unsigned long long int)(currentTime.tv_sec - m_data->mStartTime.tv_sec) * 1000000 + 
+			(currentTime.tv_usec - m_data->mStartTime.tv_usec)) * 1000;
+#endif //BT_USE_CLOCK_GETTIME
+#endif//__CELLOS_LV2__
+#endif 
+}
+
 
 
+#ifndef BT_NO_PROFILE
+
+
+static btClock gProfileClock;
 
 
 inline void Profile_Get_Ticks(unsigned long int * ticks)
 {
-	*ticks = gProfileClock.getTimeMicroseconds();
+	//getTimeNanoseconds doesn't modify the clock, so this is safe to call from any thread
+	*ticks = (unsigned long int)(gProfileClock.getTimeNanoseconds()/1000);
 }
 
 inline float Profile_Get_Tick_Rate(void)
@@ -423,9 +472,190 @@ void	CProfileIterator::Enter_Parent( void )
 ***************************************************************************************************/
 
 CProfileNode	CProfileManager::Root( "Root", NULL );
-CProfileNode *	CProfileManager::CurrentNode = &CProfileManager::Root;
 int				CProfileManager::FrameCounter = 0;
 unsigned long int			CProfileManager::ResetTime = 0;
+bool			CProfileManager::TimelineEnabled = false;
+
+
+/***************************************************************************************************
+**
+** Per-thread profile state
+**
+** Every thread claims a free slot the first time it enters a profile scope. A slot is only written by
+** its owning thread, so no locks are needed on the hot path. Thread 0 uses CProfileManager::Root.
+** The slot is freed when the thread calls Release_Thread or, with pthreads, when it exits, and the
+** next thread to claim it continues its profile tree and timeline.
+**
+***************************************************************************************************/
+
+#define BT_MAX_PROFILE_THREADS 64
+#define BT_MAX_PROFILE_DEPTH 64
+#define BT_PROFILE_TIMELINE_CAPACITY (64*1024)
+
+#if defined(_MSC_VER)
+#define BT_PROFILE_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) && !defined(__CELLOS_LV2__)
+#define BT_PROFILE_THREAD_LOCAL __thread
+#else
+//no thread local storage: all threads share the first slot, only single threaded use is safe
+#define BT_PROFILE_THREAD_LOCAL
+#endif
+
+#if defined(__GNUC__) && !defined(__CELLOS_LV2__) && !defined(_WIN32)
+//a pthread key destructor frees the slot of a thread when it exits
+#define BT_PROFILE_USE_PTHREAD_KEY
+#include <pthread.h>
+#endif
+
+static bool btProfileAtomicCompareExchange(volatile int* value, int oldValue, int newValue)
+{
+#if defined(BT_USE_WINDOWS_TIMERS) && !defined(_XBOX)
+	return InterlockedCompareExchange((volatile LONG*)value,newValue,oldValue) == oldValue;
+#elif defined(__GNUC__)
+	return __sync_bool_compare_and_swap(value,oldValue,newValue);
+#else
+	if (*value != oldValue)
+		return false;
+	*value = newValue;
+	return true;
+#endif
+}
+
+static void btProfileAtomicStore(volatile int* value, int newValue)
+{
+#if defined(BT_USE_WINDOWS_TIMERS) && !defined(_XBOX)
+	InterlockedExchange((volatile LONG*)value,newValue);
+#elif defined(__GNUC__)
+	__sync_synchronize();
+	*value = newValue;
+#else
+	*value = newValue;
+#endif
+}
+
+enum btProfileEventType
+{
+	BT_PROFILE_EVENT_SCOPE,
+	BT_PROFILE_EVENT_COUNTER
+};
+
+struct btProfileEvent
+{
+	const char*				m_name;
+	unsigned long long int	m_startTime;
+	unsigned long long int	m_endTime;
+	int						m_value;
+	int						m_type;
+};
+
+struct btProfileThreadData
+{
+	int						m_threadIndex;
+	CProfileNode*			m_root;
+	CProfileNode*			m_currentNode;
+	btProfileEvent*			m_events;
+	///total number of events written, the buffer wraps around after BT_PROFILE_TIMELINE_CAPACITY
+	volatile unsigned int	m_numEvents;
+	int						m_depth;
+	unsigned long long int	m_scopeStart[BT_MAX_PROFILE_DEPTH];
+};
+
+static btClock gTimelineClock;
+static btProfileThreadData* gProfileThreads[BT_MAX_PROFILE_THREADS];
+static volatile int gProfileThreadInUse[BT_MAX_PROFILE_THREADS];
+///one past the highest slot claimed so far
+static volatile int gNumProfileThreads = 0;
+///CleanupMemory deletes the slots, a thread whose generation is older claims a new one
+static volatile int gProfileGeneration = 0;
+static BT_PROFILE_THREAD_LOCAL btProfileThreadData* gCurrentProfileThread = 0;
+static BT_PROFILE_THREAD_LOCAL int gCurrentProfileGeneration = 0;
+static BT_PROFILE_THREAD_LOCAL bool gProfileThreadOverflow = false;
+
+#ifdef BT_PROFILE_USE_PTHREAD_KEY
+static pthread_key_t gProfileThreadKey;
+static pthread_once_t gProfileThreadKeyOnce = PTHREAD_ONCE_INIT;
+
+static void btProfileThreadExit(void*)
+{
+	CProfileManager::Release_Thread();
+}
+
+static void btCreateProfileThreadKey()
+{
+	pthread_key_create(&gProfileThreadKey,btProfileThreadExit);
+}
+#endif //BT_PROFILE_USE_PTHREAD_KEY
+
+static btProfileThreadData* btGetCurrentProfileThreadData()
+{
+	return gCurrentProfileGeneration == gProfileGeneration ? gCurrentProfileThread : 0;
+}
+
+static btProfileThreadData* btGetProfileThreadData()
+{
+	if (gCurrentProfileGeneration == gProfileGeneration)
+	{
+		if (gCurrentProfileThread || gProfileThreadOverflow)
+			return gCurrentProfileThread;
+	}
+	gCurrentProfileThread = 0;
+	gCurrentProfileGeneration = gProfileGeneration;
+	gProfileThreadOverflow = false;
+
+	for (int index=0;index<BT_MAX_PROFILE_THREADS;index++)
+	{
+		if (!btProfileAtomicCompareExchange(&gProfileThreadInUse[index],0,1))
+			continue;
+
+		btProfileThreadData* data = gProfileThreads[index];
+		if (!data)
+		{
+			data = new btProfileThreadData;
+			data->m_threadIndex = index;
+			data->m_root = index ? new CProfileNode("Root", NULL) : 0;
+			data->m_events = 0;
+			data->m_numEvents = 0;
+			gProfileThreads[index] = data;
+		}
+		data->m_currentNode = 0;
+		data->m_depth = 0;
+
+		int numThreads = gNumProfileThreads;
+		while (numThreads <= index && !btProfileAtomicCompareExchange(&gNumProfileThreads,numThreads,index+1))
+		{
+			numThreads = gNumProfileThreads;
+		}
+#ifdef BT_PROFILE_USE_PTHREAD_KEY
+		pthread_once(&gProfileThreadKeyOnce,btCreateProfileThreadKey);
+		pthread_setspecific(gProfileThreadKey,data);
+#endif
+		gCurrentProfileThread = data;
+		return data;
+	}
+	//out of slots, this thread won't be profiled
+	gProfileThreadOverflow = true;
+	return 0;
+}
+
+static void btRecordProfileEvent(btProfileThreadData* data, const char* name, unsigned long long int startTime, unsigned long long int endTime, int value, int type)
+{
+	if (!data->m_events)
+	{
+		data->m_events = new btProfileEvent[BT_PROFILE_TIMELINE_CAPACITY];
+	}
+	btProfileEvent& evt = data->m_events[data->m_numEvents % BT_PROFILE_TIMELINE_CAPACITY];
+	evt.m_name = name;
+	evt.m_startTime = startTime;
+	evt.m_endTime = endTime;
+	evt.m_value = value;
+	evt.m_type = type;
+	data->m_numEvents = data->m_numEvents+1;
+}
+
+static int btGetNumProfileThreads()
+{
+	return gNumProfileThreads;
+}
 
 
 /***********************************************************************************************
@@ -443,11 +673,26 @@ unsigned long int			CProfileManager::ResetTime = 0;
  *=============================================================================================*/
 void	CProfileManager::Start_Profile( const char * name )
 {
-	if (name != CurrentNode->Get_Name()) {
-		CurrentNode = CurrentNode->Get_Sub_Node( name );
+	btProfileThreadData* data = btGetProfileThreadData();
+	if (!data)
+		return;
+	if (!data->m_currentNode)
+	{
+		data->m_currentNode = data->m_root ? data->m_root : &Root;
+	}
+
+	if (name != data->m_currentNode->Get_Name()) {
+		data->m_currentNode = data->m_currentNode->Get_Sub_Node( name );
 	} 
 	
-	CurrentNode->Call();
+	data->m_currentNode->Call();
+
+	if (data->m_depth < BT_MAX_PROFILE_DEPTH)
+	{
+		//a zero start time marks a scope that was entered while the timeline was disabled
+		data->m_scopeStart[data->m_depth] = TimelineEnabled ? gTimelineClock.getTimeNanoseconds()+1 : 0;
+	}
+	data->m_depth++;
 }
 
 
@@ -456,11 +701,70 @@ void	CProfileManager::Start_Profile( const char * name )
  *=============================================================================================*/
 void	CProfileManager::Stop_Profile( void )
 {
+	btProfileThreadData* data = btGetCurrentProfileThreadData();
+	if (!data || !data->m_currentNode)
+		return;
+
+	if (data->m_depth > 0)
+	{
+		data->m_depth--;
+		if (data->m_depth < BT_MAX_PROFILE_DEPTH && data->m_scopeStart[data->m_depth] && TimelineEnabled)
+		{
+			btRecordProfileEvent(data, data->m_currentNode->Get_Name(), data->m_scopeStart[data->m_depth]-1, gTimelineClock.getTimeNanoseconds(), 0, BT_PROFILE_EVENT_SCOPE);
+		}
+	}
+
 	// Return will indicate whether we should back up to our parent (we may
 	// be profiling a recursive function)
-	if (CurrentNode->Return()) {
-		CurrentNode = CurrentNode->Get_Parent();
+	if (data->m_currentNode->Return()) {
+		data->m_currentNode = data->m_currentNode->Get_Parent();
+	}
+}
+
+
+void	CProfileManager::CleanupMemory(void)
+{
+	Root.CleanupMemory();
+	for (int i=0;i<BT_MAX_PROFILE_THREADS;i++)
+	{
+		btProfileThreadData* data = gProfileThreads[i];
+		if (data)
+		{
+			if (data->m_root)
+			{
+				data->m_root->CleanupMemory();
+				delete data->m_root;
+			}
+			delete [] data->m_events;
+			delete data;
+			gProfileThreads[i] = 0;
+		}
+		gProfileThreadInUse[i] = 0;
 	}
+	gNumProfileThreads = 0;
+	btProfileAtomicStore(&gProfileGeneration,gProfileGeneration+1);
+}
+
+
+/***********************************************************************************************
+ * CProfileManager::Release_Thread -- Free the profile slot of the calling thread              *
+ *                                                                                             *
+ * The next thread that enters a profile scope reuses the slot. With pthreads this is called   *
+ * automatically when a thread exits, elsewhere call it before a profiled thread exits.        *
+ *=============================================================================================*/
+void	CProfileManager::Release_Thread( void )
+{
+	btProfileThreadData* data = btGetCurrentProfileThreadData();
+	gCurrentProfileThread = 0;
+	gProfileThreadOverflow = false;
+	if (!data)
+		return;
+	data->m_currentNode = 0;
+	data->m_depth = 0;
+#ifdef BT_PROFILE_USE_PTHREAD_KEY
+	pthread_setspecific(gProfileThreadKey,0);
+#endif
+	btProfileAtomicStore(&gProfileThreadInUse[data->m_threadIndex],0);
 }
 
 
@@ -474,11 +778,75 @@ void	CProfileManager::Reset( void )
 	gProfileClock.reset();
 	Root.Reset();
     Root.Call();
+	int numThreads = btGetNumProfileThreads();
+	for (int i=0;i<numThreads;i++)
+	{
+		if (gProfileThreads[i] && gProfileThreads[i]->m_root)
+		{
+			gProfileThreads[i]->m_root->Reset();
+			gProfileThreads[i]->m_root->Call();
+		}
+	}
 	FrameCounter = 0;
 	Profile_Get_Ticks(&ResetTime);
 }
 
 
+int		CProfileManager::Get_Num_Threads( void )
+{
+	return btGetNumProfileThreads();
+}
+
+
+CProfileIterator *	CProfileManager::Get_Thread_Iterator( int threadIndex )
+{
+	if (threadIndex < 0 || threadIndex >= btGetNumProfileThreads() || !gProfileThreads[threadIndex])
+		return 0;
+	btProfileThreadData* data = gProfileThreads[threadIndex];
+	return new CProfileIterator( data->m_root ? data->m_root : &Root );
+}
+
+
+/***********************************************************************************************
+ * CProfileManager::Set_Timeline_Enabled -- Start or stop recording scopes and counters        *
+ *=============================================================================================*/
+void	CProfileManager::Set_Timeline_Enabled( bool enabled )
+{
+	TimelineEnabled = enabled;
+}
+
+
+/***********************************************************************************************
+ * CProfileManager::Clear_Timeline -- Discard all recorded timeline events                     *
+ *                                                                                             *
+ * WARNINGS:                                                                                   *
+ * Only call this while no other thread is recording.                                          *
+ *=============================================================================================*/
+void	CProfileManager::Clear_Timeline( void )
+{
+	int numThreads = btGetNumProfileThreads();
+	for (int i=0;i<numThreads;i++)
+	{
+		if (gProfileThreads[i])
+		{
+			gProfileThreads[i]->m_numEvents = 0;
+		}
+	}
+}
+
+
+void	CProfileManager::Record_Counter( const char * name, int value )
+{
+	if (!TimelineEnabled)
+		return;
+	btProfileThreadData* data = btGetProfileThreadData();
+	if (!data)
+		return;
+	unsigned long long int time = gTimelineClock.getTimeNanoseconds();
+	btRecordProfileEvent(data, name, time, time, value, BT_PROFILE_EVENT_COUNTER);
+}
+
+
 /***********************************************************************************************
  * CProfileManager::Increment_Frame_Counter -- Increment the frame counter                    *
  *=============================================================================================*/
@@ -561,6 +929,69 @@ void	CProfileManager::dumpAll()
 }
 
 
+static void	btWriteJsonString(FILE* f, const char* str)
+{
+	fputc('"',f);
+	for (const char* c = str; *c; c++)
+	{
+		if (*c == '"' || *c == '\\')
+		{
+			fputc('\\',f);
+			fputc(*c,f);
+		} else if ((unsigned char)*c >= 0x20)
+		{
+			fputc(*c,f);
+		}
+	}
+	fputc('"',f);
+}
+
+
+bool	CProfileManager::dumpChromeTrace(const char* fileName)
+{
+	FILE* f = fopen(fileName,"w");
+	if (!f)
+		return false;
+
+	fprintf(f,"{\"traceEvents\":[\n");
+	bool first = true;
+	int numThreads = btGetNumProfileThreads();
+	for (int t=0;t<numThreads;t++)
+	{
+		const btProfileThreadData* data = gProfileThreads[t];
+		if (!data)
+			continue;
+
+		fprintf(f,"%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"bullet thread %d\"}}",first ? "" : ",\n",t,t);
+		first = false;
+
+		if (!data->m_events)
+			continue;
+		unsigned int numEvents = data->m_numEvents;
+		unsigned int start = numEvents > BT_PROFILE_TIMELINE_CAPACITY ? numEvents - BT_PROFILE_TIMELINE_CAPACITY : 0;
+		for (unsigned int i=start;i<numEvents;i++)
+		{
+			const btProfileEvent& evt = data->m_events[i % BT_PROFILE_TIMELINE_CAPACITY];
+			//timestamps are written in microseconds
+			fprintf(f,",\n{\"name\":");
+			btWriteJsonString(f,evt.m_name);
+			if (evt.m_type == BT_PROFILE_EVENT_COUNTER)
+			{
+				fprintf(f,",\"ph\":\"C\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%d}}",
+					t,double(evt.m_startTime)*0.001,evt.m_value);
+			} else
+			{
+				fprintf(f,",\"cat\":\"bullet\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+					t,double(evt.m_startTime)*0.001,double(evt.m_endTime-evt.m_startTime)*0.001);
+			}
+		}
+	}
+	fprintf(f,"\n]}\n");
+	fclose(f);
+	return true;
+}
+
+
 
 
 #endif //BT_NO_PROFILE
@@ -17,7 +17,6 @@
 
 //To disable built-in profiling, please comment out next line
 //#define BT_NO_PROFILE 1
-#ifndef BT_NO_PROFILE
 #include <stdio.h>//@todo remove this, backwards compatibility
 #include "btScalar.h"
 #include "btAlignedAllocator.h"
@@ -32,6 +31,7 @@
 #ifdef USE_BT_CLOCK
 
 ///The btClock is a portable basic clock that measures accurate time in seconds, use for profiling.
+///It is available with BT_NO_PROFILE as well, only the profiler below is compiled out.
 class btClock
 {
 public:
@@ -52,12 +52,18 @@ public:
 	/// Returns the time in us since the last call to reset or since 
 	/// the Clock was created.
 	unsigned long int getTimeMicroseconds();
+
+	/// Returns the time in ns since the last call to reset or since 
+	/// the Clock was created. Unlike the other queries this call does not modify
+	/// the clock, so a single btClock can be shared between threads.
+	unsigned long long int getTimeNanoseconds() const;
 private:
 	struct btClockData* m_data;
 };
 
 #endif //USE_BT_CLOCK
 
+#ifndef BT_NO_PROFILE
 
 
 
@@ -138,16 +144,21 @@ protected:
 
 
 ///The Manager for the Profile system
+///Each thread that enters a BT_PROFILE scope gets its own profile tree, the first thread is
+///reported through Get_Iterator and dumpAll. Optionally every scope and counter can also be
+///recorded into a per-thread timeline that is exported with dumpChromeTrace.
 class	CProfileManager {
 public:
 	static	void						Start_Profile( const char * name );
 	static	void						Stop_Profile( void );
 
-	static	void						CleanupMemory(void)
-	{
-		Root.CleanupMemory();
-	}
+	///CleanupMemory frees the profile trees and timelines of all threads, call it while no other thread is profiling
+	static	void						CleanupMemory(void);
+	///frees the profile slot of the calling thread for reuse by the next thread, call it before a profiled
+	///thread exits. With pthreads this happens automatically.
+	static	void						Release_Thread( void );
 
+	///Reset clears the timing data of all threads, call it while worker threads are idle
 	static	void						Reset( void );
 	static	void						Increment_Frame_Counter( void );
 	static	int						Get_Frame_Count_Since_Reset( void )		{ return FrameCounter; }
@@ -160,15 +171,31 @@ public:
 	}
 	static	void						Release_Iterator( CProfileIterator * iterator ) { delete ( iterator); }
 
+	///number of thread slots used so far, thread 0 owns the Root tree
+	static	int						Get_Num_Threads( void );
+	///returns 0 if threadIndex is out of range
+	static	CProfileIterator *	Get_Thread_Iterator( int threadIndex );
+
+	///timeline recording is disabled by default, it costs two clock reads per scope when enabled
+	static	void						Set_Timeline_Enabled( bool enabled );
+	static	bool						Is_Timeline_Enabled( void )	{ return TimelineEnabled; }
+	static	void						Clear_Timeline( void );
+	///record a named counter value (pairs, manifolds, solver rows...) into the calling thread's timeline
+	static	void						Record_Counter( const char * name, int value );
+
 	static void	dumpRecursive(CProfileIterator* profileIterator, int spacing);
 
 	static void	dumpAll();
 
+	///write the recorded timelines as Chrome trace event JSON, readable by chrome://tracing and Perfetto.
+	///Call this while no other thread is inside a profile scope.
+	static bool	dumpChromeTrace(const char* fileName);
+
 private:
 	static	CProfileNode			Root;
-	static	CProfileNode *			CurrentNode;
 	static	int						FrameCounter;
 	static	unsigned long int					ResetTime;
+	static	bool					TimelineEnabled;
 };
 
 
@@ -189,10 +216,12 @@ public:
 
 
 #define	BT_PROFILE( name )			CProfileSample __profile( name )
+#define	BT_PROFILE_COUNTER( name, value )	do { if (CProfileManager::Is_Timeline_Enabled()) CProfileManager::Record_Counter( name, value ); } while (0)
 
 #else
 
 #define	BT_PROFILE( name )
+#define	BT_PROFILE_COUNTER( name, value )
 
 #endif //#ifndef BT_NO_PROFILE
 
@@ -24,6 +24,20 @@ subject to the following restrictions:
 
 
 #include <math.h>
+
+#ifdef BT_USE_DETERMINISTIC_MATH
+///BT_USE_DETERMINISTIC_MATH disables the SSE and NEON code paths, so every platform runs the same scalar code.
+///The compiler must not contract a*b+c into fused multiply-adds or keep intermediates in extended precision,
+///the USE_DETERMINISTIC_MATH cmake option sets the flags for that. btSqrt is exact, but btSin, btCos, btAcos, btAtan2,
+///btExp and btPow come from the C library, which has to give the same results on all platforms involved.
+#if (defined(_M_IX86) && (!defined(_M_IX86_FP) || _M_IX86_FP < 2)) || (defined(__i386__) && !defined(__SSE2_MATH__))
+#error "BT_USE_DETERMINISTIC_MATH needs SSE2 floating point math on 32 bit x86 (-msse2 -mfpmath=sse or /arch:SSE2)"
+#endif
+#ifdef __FAST_MATH__
+#error "BT_USE_DETERMINISTIC_MATH cannot be combined with -ffast-math"
+#endif
+#endif //BT_USE_DETERMINISTIC_MATH
+
 #include <stdlib.h>//size_t for MSVC 6.0
 #include <float.h>
 
@@ -67,7 +81,7 @@ inline int	btGetVersion()
  			#define btFsel(a,b,c) __fsel((a),(b),(c))
 		#else
 
-#if (defined (_WIN32) && (_MSC_VER) && _MSC_VER >= 1400) && (!defined (BT_USE_DOUBLE_PRECISION))
+#if (defined (_WIN32) && (_MSC_VER) && _MSC_VER >= 1400) && (!defined (BT_USE_DOUBLE_PRECISION)) && (!defined (BT_USE_DETERMINISTIC_MATH))
 			#if _MSC_VER>1400
 				#define BT_USE_SIMD_VECTOR3
 			#endif
@@ -161,7 +175,7 @@ inline int	btGetVersion()
 #else
 	//non-windows systems
 
-#if (defined (__APPLE__) && (!defined (BT_USE_DOUBLE_PRECISION)))
+#if (defined (__APPLE__) && (!defined (BT_USE_DOUBLE_PRECISION)) && (!defined (BT_USE_DETERMINISTIC_MATH)))
     #if defined (__i386__) || defined (__x86_64__)
 		#define BT_USE_SIMD_VECTOR3
 		#define BT_USE_SSE